@@ -0,0 +1,302 @@
+/*
+ * _deploy_parse - optional C accelerator for deploy-log line parsing
+ *
+ * Built by scripts/setup_python_runtime.js against the bundled CPython
+ * headers (python_runtime/include/python3.12). backend/monitor.py imports
+ * this module opportunistically and falls back to the pure-Python regex
+ * path when it is absent, so the extension is never required.
+ *
+ * parse_line(line) mirrors the semantics of monitor.py's
+ * DEPLOY_LINE_PATTERN / CWD_SUFFIX_PATTERN / EXIT_CODE_SUFFIX_PATTERN:
+ *
+ *   "<timestamp> DEPLOY: <command> [CWD: <path>]"
+ *   "<timestamp> DEPLOY_COMPLETE: <command> [EXIT_CODE: <code>]"
+ *
+ * and returns (event_kind, timestamp, command, cwd_or_None,
+ * exit_code_or_None) with event_kind 0 for DEPLOY and 1 for
+ * DEPLOY_COMPLETE, or None for lines that are not deploy events.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <string.h>
+#include <stdlib.h>
+
+#define EVENT_DEPLOY 0
+#define EVENT_DEPLOY_COMPLETE 1
+
+static int
+is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' ||
+           c == '\v' || c == '\f';
+}
+
+/* Trim [start, end) to exclude leading/trailing ASCII whitespace */
+static void
+trim(const char **start, const char **end)
+{
+    while (*start < *end && is_space(**start)) {
+        (*start)++;
+    }
+    while (*end > *start && is_space(*(*end - 1))) {
+        (*end)--;
+    }
+}
+
+/* Find the first occurrence of needle inside [start, end) */
+static const char *
+find_in(const char *start, const char *end, const char *needle)
+{
+    size_t needle_len = strlen(needle);
+    const char *p;
+
+    if ((size_t)(end - start) < needle_len) {
+        return NULL;
+    }
+    for (p = start; p <= end - needle_len; p++) {
+        if (memcmp(p, needle, needle_len) == 0) {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Parse one stripped line starting at [line, line_end).
+ * Returns a new reference to the result tuple, Py_None for non-events,
+ * or NULL on error.
+ */
+static PyObject *
+parse_line_core(const char *line, const char *line_end)
+{
+    const char *p = line;
+    const char *ts_start;
+    double timestamp;
+    int event_kind;
+    const char *rest;
+    const char *rest_end;
+    PyObject *command_obj = NULL;
+    PyObject *cwd_obj = NULL;
+    PyObject *exit_code_obj = NULL;
+    PyObject *result;
+
+    trim(&line, &line_end);
+    p = line;
+
+    /* Timestamp: digits with an optional fractional part */
+    ts_start = p;
+    while (p < line_end && *p >= '0' && *p <= '9') {
+        p++;
+    }
+    if (p == ts_start) {
+        Py_RETURN_NONE;
+    }
+    if (p < line_end && *p == '.') {
+        const char *frac_start = ++p;
+        while (p < line_end && *p >= '0' && *p <= '9') {
+            p++;
+        }
+        if (p == frac_start) {
+            Py_RETURN_NONE;
+        }
+    }
+    if (p >= line_end || !is_space(*p)) {
+        Py_RETURN_NONE;
+    }
+    timestamp = strtod(ts_start, NULL);
+
+    while (p < line_end && is_space(*p)) {
+        p++;
+    }
+
+    /* Event marker: DEPLOY_COMPLETE must be checked before its prefix */
+    if ((size_t)(line_end - p) >= 16 &&
+        memcmp(p, "DEPLOY_COMPLETE:", 16) == 0) {
+        event_kind = EVENT_DEPLOY_COMPLETE;
+        p += 16;
+    }
+    else if ((size_t)(line_end - p) >= 7 && memcmp(p, "DEPLOY:", 7) == 0) {
+        event_kind = EVENT_DEPLOY;
+        p += 7;
+    }
+    else {
+        Py_RETURN_NONE;
+    }
+
+    while (p < line_end && is_space(*p)) {
+        p++;
+    }
+    rest = p;
+    rest_end = line_end;
+
+    if (event_kind == EVENT_DEPLOY) {
+        /* Optional "[CWD: <path>]" suffix anchored at end of line */
+        const char *marker = find_in(rest, rest_end, "[CWD:");
+
+        if (marker != NULL && rest_end > rest && *(rest_end - 1) == ']') {
+            const char *cmd_end = marker;
+            const char *cwd_start = marker + 5;
+            const char *cwd_end = rest_end - 1;
+
+            trim(&rest, &cmd_end);
+            trim(&cwd_start, &cwd_end);
+            command_obj = PyUnicode_DecodeUTF8(rest, cmd_end - rest,
+                                               "replace");
+            if (command_obj == NULL) {
+                return NULL;
+            }
+            cwd_obj = PyUnicode_DecodeUTF8(cwd_start, cwd_end - cwd_start,
+                                           "replace");
+            if (cwd_obj == NULL) {
+                Py_DECREF(command_obj);
+                return NULL;
+            }
+        }
+    }
+    else {
+        /* Optional "[EXIT_CODE: <digits>]" suffix anchored at end of line */
+        const char *marker = find_in(rest, rest_end, "[EXIT_CODE:");
+
+        if (marker != NULL && rest_end > rest && *(rest_end - 1) == ']') {
+            const char *cmd_end = marker;
+            const char *code_start = marker + 11;
+            const char *code_end = rest_end - 1;
+            const char *digit;
+            long exit_code = 0;
+
+            while (code_start < code_end && is_space(*code_start)) {
+                code_start++;
+            }
+            if (code_start < code_end) {
+                int all_digits = 1;
+
+                for (digit = code_start; digit < code_end; digit++) {
+                    if (*digit < '0' || *digit > '9') {
+                        all_digits = 0;
+                        break;
+                    }
+                    exit_code = exit_code * 10 + (*digit - '0');
+                }
+                if (all_digits) {
+                    trim(&rest, &cmd_end);
+                    command_obj = PyUnicode_DecodeUTF8(rest, cmd_end - rest,
+                                                       "replace");
+                    if (command_obj == NULL) {
+                        return NULL;
+                    }
+                    exit_code_obj = PyLong_FromLong(exit_code);
+                    if (exit_code_obj == NULL) {
+                        Py_DECREF(command_obj);
+                        return NULL;
+                    }
+                }
+            }
+        }
+    }
+
+    if (command_obj == NULL) {
+        /* No recognized suffix: the whole remainder is the command */
+        trim(&rest, &rest_end);
+        command_obj = PyUnicode_DecodeUTF8(rest, rest_end - rest, "replace");
+        if (command_obj == NULL) {
+            return NULL;
+        }
+    }
+
+    result = Py_BuildValue("(idOOO)",
+                           event_kind,
+                           timestamp,
+                           command_obj,
+                           cwd_obj ? cwd_obj : Py_None,
+                           exit_code_obj ? exit_code_obj : Py_None);
+    Py_DECREF(command_obj);
+    Py_XDECREF(cwd_obj);
+    Py_XDECREF(exit_code_obj);
+    return result;
+}
+
+static PyObject *
+deploy_parse_line(PyObject *self, PyObject *args)
+{
+    const char *line;
+    Py_ssize_t line_len;
+
+    if (!PyArg_ParseTuple(args, "s#:parse_line", &line, &line_len)) {
+        return NULL;
+    }
+    return parse_line_core(line, line + line_len);
+}
+
+/*
+ * parse_buffer(data: bytes-like) -> list of parse_line tuples.
+ * Scans the buffer line by line without creating intermediate string
+ * objects, which is what keeps megabyte log bursts off the interpreter.
+ */
+static PyObject *
+deploy_parse_buffer(PyObject *self, PyObject *args)
+{
+    Py_buffer view;
+    const char *cursor;
+    const char *buffer_end;
+    PyObject *events;
+
+    if (!PyArg_ParseTuple(args, "y*:parse_buffer", &view)) {
+        return NULL;
+    }
+
+    events = PyList_New(0);
+    if (events == NULL) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    cursor = (const char *)view.buf;
+    buffer_end = cursor + view.len;
+
+    while (cursor < buffer_end) {
+        const char *newline = memchr(cursor, '\n', buffer_end - cursor);
+        const char *line_end = newline ? newline : buffer_end;
+        PyObject *event = parse_line_core(cursor, line_end);
+
+        if (event == NULL) {
+            Py_DECREF(events);
+            PyBuffer_Release(&view);
+            return NULL;
+        }
+        if (event != Py_None && PyList_Append(events, event) < 0) {
+            Py_DECREF(event);
+            Py_DECREF(events);
+            PyBuffer_Release(&view);
+            return NULL;
+        }
+        Py_DECREF(event);
+
+        cursor = newline ? newline + 1 : buffer_end;
+    }
+
+    PyBuffer_Release(&view);
+    return events;
+}
+
+static PyMethodDef deploy_parse_methods[] = {
+    {"parse_line", deploy_parse_line, METH_VARARGS,
+     "Parse one deploy log line; returns an event tuple or None."},
+    {"parse_buffer", deploy_parse_buffer, METH_VARARGS,
+     "Parse a byte buffer of deploy log lines; returns a list of event tuples."},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef deploy_parse_module = {
+    PyModuleDef_HEAD_INIT,
+    "_deploy_parse",
+    "C accelerator for deploy-log parsing (see backend/monitor.py).",
+    -1,
+    deploy_parse_methods
+};
+
+PyMODINIT_FUNC
+PyInit__deploy_parse(void)
+{
+    return PyModule_Create(&deploy_parse_module);
+}
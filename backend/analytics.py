@@ -7,22 +7,50 @@ Phase 1: Task Selection Analytics & Learning ✅
 Phase 2: Comprehensive Productivity Analytics (Deploy Sessions, Time Saved, Patterns) 🚧
 """
 
-import json
+import gzip
+import jsoncodec
 import asyncio
+import sqlite3
+import sys
+import threading
 import time
+from concurrent.futures import ProcessPoolExecutor, ThreadPoolExecutor
 from datetime import datetime, timedelta
+from functools import partial
 from pathlib import Path
 from typing import Dict, List, Optional, Any, Tuple
-from dataclasses import dataclass
+from collections import deque
+from dataclasses import dataclass, fields
 import hashlib
 import logging
 
+from supervisor import task_supervisor
+
 # Configure logging
 logger = logging.getLogger(__name__)
 
-@dataclass
+def _intern(value: Optional[str]) -> Optional[str]:
+    """Intern a record field drawn from a small repeated vocabulary.
+
+    Project names, app names, commands and interaction types recur across
+    thousands of records during a busy session; interning makes every record
+    share one string object instead of allocating a fresh copy each time.
+    """
+    return sys.intern(value) if value else value
+
+
+def _encode_record_line(record: Dict[str, Any]) -> bytes:
+    """Encode one record to its JSONL wire line.
+
+    Hot recording paths call this exactly once per record and hand the bytes
+    through to the writer thread, so a record is never serialized twice.
+    """
+    return (jsoncodec.dumps(record) + "\n").encode("utf-8")
+
+
+@dataclass(frozen=True, slots=True)
 class TaskSuggestion:
-    """Data class for task suggestion events"""
+    """Write-once record for one task suggestion event"""
     id: str
     task_id: str
     task_text: str
@@ -34,9 +62,29 @@ class TaskSuggestion:
     context_data: Dict[str, Any]
     project_name: str
 
-@dataclass
+    def __post_init__(self):
+        object.__setattr__(self, "suggested_app", _intern(self.suggested_app))
+        object.__setattr__(self, "deploy_command", _intern(self.deploy_command))
+        object.__setattr__(self, "project_name", _intern(self.project_name))
+        object.__setattr__(self, "task_tags", [_intern(t) for t in self.task_tags])
+
+    def to_record(self) -> Dict[str, Any]:
+        """The persisted shape (project_name travels in the file path, not the record)"""
+        return {
+            "id": self.id,
+            "task_id": self.task_id,
+            "task_text": self.task_text,
+            "task_tags": self.task_tags,
+            "suggested_app": self.suggested_app,
+            "suggestion_timestamp": self.suggestion_timestamp,
+            "deploy_command": self.deploy_command,
+            "timer_duration": self.timer_duration,
+            "context_data": self.context_data
+        }
+
+@dataclass(frozen=True, slots=True)
 class UserInteraction:
-    """Data class for user interaction events"""
+    """Write-once record for one user interaction event"""
     suggestion_id: str
     interaction_type: str  # accepted, ignored, snoozed, dismissed
     interaction_timestamp: str
@@ -46,7 +94,22 @@ class UserInteraction:
     time_in_app_seconds: Optional[int] = None
     productivity_score: Optional[float] = None
 
-@dataclass
+    def __post_init__(self):
+        object.__setattr__(self, "interaction_type", _intern(self.interaction_type))
+
+    def to_record(self) -> Dict[str, Any]:
+        return {
+            "suggestion_id": self.suggestion_id,
+            "interaction_type": self.interaction_type,
+            "interaction_timestamp": self.interaction_timestamp,
+            "response_time_seconds": self.response_time_seconds,
+            "completion_detected": self.completion_detected,
+            "completion_method": self.completion_method,
+            "time_in_app_seconds": self.time_in_app_seconds,
+            "productivity_score": self.productivity_score
+        }
+
+@dataclass(slots=True)
 class DeploySession:
     """
     📊 PHASE 2: Data class for deployment session tracking
@@ -67,10 +130,36 @@ class DeploySession:
     session_status: str = "active"  # active, completed, cancelled
     productivity_score: Optional[float] = None
 
-@dataclass  
+    def __post_init__(self):
+        # Sessions mutate across their lifetime, so the class keeps plain
+        # slots (not frozen); the repeated-vocabulary fields still intern
+        self.project_name = _intern(self.project_name)
+        self.deploy_command = _intern(self.deploy_command)
+        self.session_status = _intern(self.session_status)
+
+    def to_record(self) -> Dict[str, Any]:
+        """Flat snapshot shape - restorable via DeploySession(**record)"""
+        return {
+            "session_id": self.session_id,
+            "project_name": self.project_name,
+            "deploy_command": self.deploy_command,
+            "session_start": self.session_start,
+            "session_end": self.session_end,
+            "timer_duration_seconds": self.timer_duration_seconds,
+            "cloud_propagation_time_seconds": self.cloud_propagation_time_seconds,
+            "tasks_suggested": self.tasks_suggested,
+            "tasks_accepted": self.tasks_accepted,
+            "switch_button_pressed": self.switch_button_pressed,
+            "switch_timestamp": self.switch_timestamp,
+            "estimated_time_saved_seconds": self.estimated_time_saved_seconds,
+            "session_status": self.session_status,
+            "productivity_score": self.productivity_score
+        }
+
+@dataclass(frozen=True, slots=True)
 class DeployPattern:
     """
-    📊 PHASE 2: Data class for deploy pattern analytics
+    📊 PHASE 2: Write-once record for deploy pattern analytics
     Tracks deployment frequency and command patterns
     """
     project_name: str
@@ -78,8 +167,248 @@ class DeployPattern:
     deploy_timestamp: str
     time_of_day: str  # morning, afternoon, evening, night
     day_of_week: str
+    hour: int = -1  # 0-23, bucketed at write time; -1 on legacy records
     deploy_frequency_score: float = 0.0  # Calculated based on recent deploys
 
+    def __post_init__(self):
+        object.__setattr__(self, "project_name", _intern(self.project_name))
+        object.__setattr__(self, "deploy_command", _intern(self.deploy_command))
+        object.__setattr__(self, "time_of_day", _intern(self.time_of_day))
+        object.__setattr__(self, "day_of_week", _intern(self.day_of_week))
+
+    def to_record(self) -> Dict[str, Any]:
+        return {
+            "project_name": self.project_name,
+            "deploy_command": self.deploy_command,
+            "deploy_timestamp": self.deploy_timestamp,
+            "time_of_day": self.time_of_day,
+            "day_of_week": self.day_of_week,
+            "hour": self.hour,
+            "deploy_frequency_score": self.deploy_frequency_score
+        }
+
+
+def _record_hour(record: Dict[str, Any], ts_field: str) -> int:
+    """Hour bucket for one record - stored field first, timestamp slice for
+    legacy records (ISO format means the hour is always characters 11-12)"""
+    hour = record.get("hour", -1)
+    if isinstance(hour, int) and 0 <= hour <= 23:
+        return hour
+    try:
+        return int(record[ts_field][11:13])
+    except (KeyError, ValueError, IndexError):
+        return -1
+
+# Helper script for the shared app-focus event stream. Runs as a single
+# co-process and prints the frontmost application name whenever it changes:
+# an NSWorkspace activation subscription when PyObjC is available, otherwise
+# one low-rate osascript poll shared by every monitor.
+_FOCUS_STREAM_HELPER = '''
+import sys
+
+def emit(name):
+    sys.stdout.write(name + "\\n")
+    sys.stdout.flush()
+
+def run_event_loop():
+    from AppKit import NSWorkspace, NSWorkspaceDidActivateApplicationNotification
+    from Foundation import NSObject
+    from PyObjCTools import AppHelper
+
+    class FocusObserver(NSObject):
+        def appActivated_(self, notification):
+            app = notification.userInfo().get("NSWorkspaceApplicationKey")
+            if app is not None:
+                emit(str(app.localizedName()))
+
+    observer = FocusObserver.alloc().init()
+    NSWorkspace.sharedWorkspace().notificationCenter().addObserver_selector_name_object_(
+        observer, b"appActivated:", NSWorkspaceDidActivateApplicationNotification, None
+    )
+    AppHelper.runConsoleEventLoop(installInterrupt=True)
+
+def run_poll_loop():
+    import subprocess
+    import time
+    script = ('tell application "System Events" to get name of first '
+              'application process whose frontmost is true')
+    last = None
+    while True:
+        try:
+            result = subprocess.run(["osascript", "-e", script],
+                                    capture_output=True, text=True, timeout=5)
+            name = result.stdout.strip()
+            if name and name != last:
+                last = name
+                emit(name)
+        except Exception:
+            pass
+        time.sleep(2)
+
+try:
+    run_event_loop()
+except Exception:
+    run_poll_loop()
+'''
+
+# AGGREGATION WORKER FUNCTIONS
+#
+# The pure-Python summarization below holds the GIL for the whole pass, so
+# for big ranges it runs in a small persistent worker process pool (see
+# _offload_aggregation) instead of on the event loop's thread. Module-level
+# plain functions over plain data keep them picklable for the pool; they
+# must not touch manager state or log.
+
+def _pool_warmup() -> bool:
+    """No-op job submitted at pool creation so workers pay their module
+    import before the first real query arrives"""
+    return True
+
+
+def _build_analytics_summary(suggestions: List[Dict],
+                             interactions: List[Dict],
+                             task_text: str = None,
+                             last_n_days: int = 30) -> Dict[str, Any]:
+    """Build task analytics summary from raw suggestion/interaction records"""
+
+    # Filter by task text if specified
+    if task_text:
+        suggestions = [s for s in suggestions if s["task_text"] == task_text]
+
+    # Create suggestion ID mapping
+    suggestion_ids = {s["id"] for s in suggestions}
+
+    # Filter interactions for our suggestions
+    relevant_interactions = [
+        i for i in interactions
+        if i["suggestion_id"] in suggestion_ids
+    ]
+
+    # Calculate metrics
+    total_suggestions = len(suggestions)
+    accepted = len([i for i in relevant_interactions if i["interaction_type"] == "accepted"])
+    ignored = len([i for i in relevant_interactions if i["interaction_type"] == "ignored"])
+    snoozed = len([i for i in relevant_interactions if i["interaction_type"] == "snoozed"])
+
+    # Recent ignores (last 30 days)
+    cutoff_date = datetime.now() - timedelta(days=last_n_days)
+    recent_ignores = len([
+        i for i in relevant_interactions
+        if i["interaction_type"] == "ignored" and
+        datetime.fromisoformat(i["interaction_timestamp"].replace('Z', '+00:00')) >= cutoff_date
+    ])
+
+    # Completion metrics
+    completed_tasks = len([i for i in relevant_interactions if i["completion_detected"]])
+
+    # Response time metrics
+    response_times = [i["response_time_seconds"] for i in relevant_interactions if i["response_time_seconds"]]
+    avg_response_time = sum(response_times) / len(response_times) if response_times else 0.0
+
+    # Calculate rates
+    acceptance_rate = accepted / total_suggestions if total_suggestions > 0 else 0.0
+    completion_rate = completed_tasks / accepted if accepted > 0 else 0.0
+
+    return {
+        "suggestions_count": total_suggestions,
+        "accepted": accepted,
+        "ignored": ignored,
+        "snoozed": snoozed,
+        "recent_ignores_30d": recent_ignores,
+        "acceptance_rate": acceptance_rate,
+        "completion_rate": completion_rate,
+        "avg_response_time": avg_response_time,
+        "task_patterns": {
+            "total_completed": completed_tasks,
+            "avg_completion_time": sum([
+                i["time_in_app_seconds"] for i in relevant_interactions
+                if i["time_in_app_seconds"]
+            ]) / max(1, completed_tasks),
+            "avg_productivity_score": sum([
+                i["productivity_score"] for i in relevant_interactions
+                if i["productivity_score"]
+            ]) / max(1, completed_tasks)
+        }
+    }
+
+
+def _build_deploy_summary(project_name: str,
+                          sessions: List[Dict],
+                          patterns: List[Dict],
+                          last_n_days: int = 30) -> Dict[str, Any]:
+    """Build deploy analytics summary from raw session/pattern records"""
+
+    total_sessions = len(sessions)
+    total_deploys = len(patterns)
+
+    # Time saved metrics
+    total_time_saved = sum(s.get("estimated_time_saved_seconds", 0) for s in sessions)
+    sessions_with_switch = len([s for s in sessions if s.get("switch_button_pressed", False)])
+    switch_rate = (sessions_with_switch / total_sessions) if total_sessions > 0 else 0.0
+
+    # Deploy frequency metrics
+    if patterns:
+        # Most common deploy commands
+        command_counts = {}
+        for pattern in patterns:
+            cmd = pattern["deploy_command"]
+            command_counts[cmd] = command_counts.get(cmd, 0) + 1
+
+        most_common_commands = sorted(command_counts.items(), key=lambda x: x[1], reverse=True)[:5]
+
+        # Temporal analysis from the buckets stored on each record at write
+        # time - no timestamp parsing in this loop
+        time_of_day_counts = {}
+        hour_counts = {}
+        day_counts = {}
+        for pattern in patterns:
+            tod = pattern["time_of_day"]
+            time_of_day_counts[tod] = time_of_day_counts.get(tod, 0) + 1
+            hour = _record_hour(pattern, "deploy_timestamp")
+            if hour >= 0:
+                hour_counts[str(hour)] = hour_counts.get(str(hour), 0) + 1
+            day = pattern.get("day_of_week")
+            if day:
+                day_counts[day] = day_counts.get(day, 0) + 1
+
+        # Calculate average frequency
+        avg_deploys_per_day = total_deploys / last_n_days
+    else:
+        most_common_commands = []
+        time_of_day_counts = {}
+        hour_counts = {}
+        day_counts = {}
+        avg_deploys_per_day = 0.0
+
+    # Productivity scores
+    productivity_scores = [s.get("productivity_score", 0) for s in sessions if s.get("productivity_score")]
+    avg_productivity_score = sum(productivity_scores) / len(productivity_scores) if productivity_scores else 0.0
+
+    return {
+        "project_name": project_name,
+        "analysis_period_days": last_n_days,
+        "timestamp": datetime.now().isoformat(),
+
+        # Session metrics
+        "total_sessions": total_sessions,
+        "total_time_saved_minutes": total_time_saved / 60,
+        "switch_button_usage_rate": switch_rate,
+        "avg_productivity_score": avg_productivity_score,
+
+        # Deploy pattern metrics
+        "total_deploys": total_deploys,
+        "avg_deploys_per_day": avg_deploys_per_day,
+        "most_common_commands": most_common_commands,
+        "deploy_time_patterns": time_of_day_counts,
+        "deploy_hour_histogram": hour_counts,
+        "deploy_day_patterns": day_counts,
+
+        # Efficiency metrics
+        "avg_time_saved_per_session_minutes": (total_time_saved / total_sessions / 60) if total_sessions > 0 else 0.0,
+        "productivity_improvement_rate": switch_rate * 100  # Percentage of sessions where user engaged
+    }
+
+
 class AnalyticsManager:
     """
     Manages analytics data collection and storage for DeployBot
@@ -93,16 +422,229 @@ class AnalyticsManager:
         self.projects_root = projects_root or Path(__file__).parent.parent / "projects"
         
         # 📊 PHASE 2: Enhanced session management
+        # active_sessions is the source of truth while a session runs -
+        # mid-session updates mutate these objects with zero I/O and the
+        # session is persisted to storage exactly once when it ends
         self.active_sessions: Dict[str, DeploySession] = {}
         self.app_focus_monitoring: Dict[str, Dict[str, Any]] = {}
+
+        # project -> active session id, maintained on session start/end so
+        # the per-deploy lookups from timer and notification code are dict
+        # hits instead of scans over active_sessions
+        self._project_active_sessions: Dict[str, str] = {}
+
+        # Content-addressed suggestion dedup: rapid back-to-back deploys
+        # re-suggest the same task; repeats within the window bump a counter
+        # instead of appending another full record to the monthly file
+        self.suggestion_dedup_window = 600.0  # Seconds a repeat counts as the same suggestion
+        self._recent_suggestions: Dict[str, Dict[str, Any]] = {}  # content hash -> {id, at, repeats}
+
+        # Context interning: suggestion records from one session carry nearly
+        # identical context_data blobs, so the first write of a blob defines
+        # it under a content-derived id and later writes reference the id.
+        # This set only tracks what this process has defined per monthly
+        # segment - after a restart a blob is simply defined again, which
+        # readers treat as a harmless re-registration
+        self._defined_context_ids: Dict[Tuple[str, str], set] = {}  # (dir, month) -> ids
+
+        # Single shared focus-event stream: one helper process publishes
+        # frontmost-app changes and every active suggestion monitor folds
+        # them in, so cost scales with focus changes rather than with
+        # suggestion count × poll rate
+        self._focus_stream_proc: Optional[Any] = None
+        self._focus_stream_task: Optional[asyncio.Task] = None
+        self._focus_events_seen = False
+        self._current_focus_app: Optional[str] = None
+        self.focus_completion_threshold = 600  # Seconds of focus (or elapsed fallback)
+        self.focus_monitor_timeout = 7200  # Drop monitors that never complete
+        self.focus_sweep_interval = 5.0  # Completion sweeps are rate-limited
+        self._last_focus_sweep = 0.0
+
+        # ⏱️ Dispatch-to-focus probes: each successful redirect registers one
+        # and the focus stream resolves it into per-app, per-strategy latency
+        # stats, so the redirector can learn which strategy actually gets the
+        # target app focused fastest on this machine
+        self._pending_focus_probes: list = []
+        self.focus_probe_timeout = 15.0  # Unresolved probes are dropped after this
+        self._redirect_latency: Optional[Dict[str, Dict[str, Any]]] = None
+        self.redirect_latency_file = Path.home() / ".deploybot" / "redirect_latency.json"
+
+        # Write-behind snapshot of active sessions for crash recovery:
+        # flushes coalesce so bursts of task-count updates cost one write
+        self.session_flush_interval = 5.0  # Seconds between snapshot writes
+        self._last_session_flush = 0.0
+        self._restore_active_sessions()
         
         # Cache for analytics data (last 30 days)
         self.analytics_cache: Dict[str, Dict[str, Any]] = {}
         self.cache_expiry: Dict[str, datetime] = {}
+
+        # In-memory copy of per-project running aggregates (aggregates.json),
+        # updated at record time so summary queries are dictionary lookups
+        self._aggregates_cache: Dict[str, Dict[str, Any]] = {}
+
+        # Months older than this are rewritten as compact gzip segments with
+        # a summary header; readers treat .json and .json.gz identically
+        self.compress_months_after = 3
+
+        # Incremental cross-project rollup: projects whose analytics changed
+        # are re-summarized by a low-priority background task, so the
+        # productivity overview answers from a precomputed document instead
+        # of walking every project directory on demand
+        self.rollup_interval = 300.0  # Seconds between rollup passes
+        self.rollup_period_days = 30
+        self._rollup_dirty: set = set()
+        self._rollup_task: Optional[asyncio.Task] = None
+        self._overview_rollup: Dict[str, Any] = {}
+
+        # Optional SQLite backend: one indexed DB instead of per-project
+        # monthly JSON files, so cross-project time-range queries are single
+        # indexed scans. Enable via use_sqlite; migrate with migrate_json_to_sqlite()
+        self.use_sqlite = False
+        self._db_conn: Optional[sqlite3.Connection] = None
+        self._db_lock = threading.Lock()
+
+        # In-memory rolling index of recent deploy timestamps per project so
+        # frequency scoring on the deploy-detection hot path never reads
+        # pattern files; warmed lazily from storage on first use
+        self.pattern_index_window_days = 7
+        self._pattern_index: Dict[str, deque] = {}
+        self._pattern_index_warmed: set = set()
+
+        # Dedicated writer thread: persistence is queued here so disk latency
+        # never stalls the event loop (timer ticks and WebSocket handling).
+        # The single worker serializes all writes, which also keeps the
+        # aggregates cache and SQLite access race-free.
+        self._io_executor = ThreadPoolExecutor(max_workers=1, thread_name_prefix="analytics-io")
+        self._pending_io = 0
+        self._max_pending_io = 1000
+
+        # Persistent worker pool for GIL-bound aggregation passes. Created
+        # lazily on the first query big enough to warrant a process round
+        # trip, then kept warm so later queries skip worker startup
+        self._agg_pool = None
+        self.agg_pool_min_records = 5000  # Below this, inline is cheaper than pickling
         
         logger.info("📊 [ANALYTICS] AnalyticsManager initialized with Phase 2 enhancements", 
                    projects_root=str(self.projects_root))
     
+    # WRITER THREAD
+
+    def _queue_io(self, persist_fn):
+        """
+        Queue a persistence function on the writer thread (fire-and-forget).
+
+        Falls back to running inline if the queue is saturated so memory
+        stays bounded under a pathological write storm.
+        """
+        if self._pending_io >= self._max_pending_io:
+            logger.warning("⚠️ [ANALYTICS] Writer queue saturated, writing inline",
+                         pending=self._pending_io)
+            persist_fn()
+            return
+
+        self._pending_io += 1
+
+        def run():
+            try:
+                persist_fn()
+            except Exception as e:
+                logger.error("❌ [ANALYTICS] Queued analytics write failed", error=str(e))
+            finally:
+                self._pending_io -= 1
+
+        self._io_executor.submit(run)
+
+    async def _run_io(self, fn):
+        """Run a blocking function on the writer thread and await the result"""
+        return await asyncio.get_running_loop().run_in_executor(self._io_executor, fn)
+
+    # AGGREGATION WORKER POOL
+
+    async def _offload_aggregation(self, fn, *args, record_count: int = 0):
+        """
+        Run a pure aggregation function over raw records, in the worker
+        pool when the record volume justifies a process round trip and
+        inline otherwise. Falls back to inline on any pool failure so a
+        dead worker never breaks an analytics query.
+        """
+        if record_count < self.agg_pool_min_records:
+            return fn(*args)
+
+        if self._agg_pool is None:
+            self._agg_pool = ProcessPoolExecutor(max_workers=2)
+            # Pay worker startup now, once, off the query path
+            for _ in range(2):
+                self._agg_pool.submit(_pool_warmup)
+            logger.info("🏭 [ANALYTICS] Aggregation worker pool started")
+
+        try:
+            return await asyncio.get_running_loop().run_in_executor(
+                self._agg_pool, partial(fn, *args))
+        except Exception as e:
+            logger.warning("⚠️ [ANALYTICS] Aggregation pool failed, computing inline",
+                          error=str(e), records=record_count)
+            return fn(*args)
+
+    def shutdown_aggregation_pool(self):
+        """Tear down the worker pool (backend shutdown)"""
+        if self._agg_pool is not None:
+            self._agg_pool.shutdown(wait=False)
+            self._agg_pool = None
+
+    # ACTIVE SESSION WRITE-BEHIND SNAPSHOT
+
+    def _active_sessions_file(self) -> Path:
+        """Path of the crash-recovery snapshot for in-flight sessions"""
+        return self.projects_root / "active_sessions.json"
+
+    def _snapshot_active_sessions(self, force: bool = False):
+        """
+        Write the active sessions snapshot, coalescing frequent updates.
+
+        Mid-session mutations call this instead of touching the monthly
+        store; at most one snapshot write happens per flush interval.
+        """
+        now = time.monotonic()
+        if not force and now - self._last_session_flush < self.session_flush_interval:
+            return
+
+        # Capture state on the event loop, write on the writer thread
+        snapshot = {sid: session.to_record() for sid, session in self.active_sessions.items()}
+        self._last_session_flush = now
+
+        def persist():
+            self.projects_root.mkdir(parents=True, exist_ok=True)
+            snapshot_file = self._active_sessions_file()
+            tmp_file = snapshot_file.with_suffix('.json.tmp')
+            with open(tmp_file, 'w') as f:
+                jsoncodec.dump(snapshot, f)
+            tmp_file.replace(snapshot_file)
+
+        self._queue_io(persist)
+
+    def _restore_active_sessions(self):
+        """Restore in-flight sessions from the snapshot after a restart"""
+        snapshot_file = self._active_sessions_file()
+        if not snapshot_file.exists():
+            return
+
+        try:
+            with open(snapshot_file, 'r') as f:
+                snapshot = jsoncodec.load(f)
+
+            for session_id, session_data in snapshot.items():
+                session = DeploySession(**session_data)
+                self.active_sessions[session_id] = session
+                if session.session_status == "active":
+                    self._project_active_sessions[session.project_name] = session_id
+
+            if self.active_sessions:
+                logger.info("🔁 [ANALYTICS] Restored active sessions from snapshot",
+                           count=len(self.active_sessions))
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Failed to restore active sessions", error=str(e))
+
     def _get_current_month_key(self) -> str:
         """Get current month key for file indexing (YYYY-MM format)"""
         return datetime.now().strftime("%Y-%m")
@@ -114,10 +656,665 @@ class AnalyticsManager:
         analytics_dir.mkdir(parents=True, exist_ok=True)
         return analytics_dir
     
+    # JSONL STORAGE ENGINE
+    # Hot-path writes are O(1) appends to a monthly .jsonl segment; segments
+    # from finished months get compacted back into the consolidated JSON
+    # format the readers already understand.
+
+    def _jsonl_path(self, analytics_dir: Path, prefix: str, month_key: str) -> Path:
+        """Path of the append-only segment for a record type and month"""
+        return analytics_dir / f"{prefix}_{month_key}.jsonl"
+
+    def _append_record(self, analytics_dir: Path, prefix: str, legacy_key: str,
+                       record):
+        """Append one record to the current month's JSONL segment.
+
+        Accepts either a record dict or a line pre-encoded with
+        _encode_record_line - the recording paths encode once up front.
+        """
+        month_key = self._get_current_month_key()
+        jsonl_file = self._jsonl_path(analytics_dir, prefix, month_key)
+
+        # First record of a new month: fold finished segments into the
+        # consolidated JSON format before starting the new one
+        if not jsonl_file.exists():
+            self._compact_finished_segments(analytics_dir, prefix, legacy_key, month_key)
+
+        line = record if isinstance(record, bytes) else _encode_record_line(record)
+        with open(jsonl_file, 'ab') as f:
+            f.write(line)
+
+    def _context_blob_id(self, context: Dict[str, Any]) -> str:
+        """Content-derived id for a context blob (stable across restarts)"""
+        canonical = jsoncodec.dumps(dict(sorted(context.items())))
+        return hashlib.sha1(canonical.encode('utf-8')).hexdigest()[:8]
+
+    def _intern_record_context(self, analytics_dir: Path,
+                               record: Dict[str, Any]) -> Dict[str, Any]:
+        """
+        Intern a record's context_data before it is appended.
+
+        The first record carrying a given blob this month keeps the blob and
+        is tagged with its context_id; every later record drops the blob and
+        carries a context_ref instead, so near-identical per-session context
+        is stored once per file rather than once per record.
+        """
+        context = record.get("context_data")
+        if not isinstance(context, dict) or not context:
+            return record
+
+        context_id = self._context_blob_id(context)
+        month_key = self._get_current_month_key()
+        defined = self._defined_context_ids.setdefault(
+            (str(analytics_dir), month_key), set())
+
+        slim = dict(record)
+        if context_id in defined:
+            del slim["context_data"]
+            slim["context_ref"] = context_id
+        else:
+            defined.add(context_id)
+            slim["context_id"] = context_id
+        return slim
+
+    def _read_jsonl(self, jsonl_file: Path) -> List[Dict[str, Any]]:
+        """Read all records from a JSONL segment, skipping corrupt lines"""
+        records = []
+        # Interned context: definitions (context_id + blob) precede any
+        # record that references them, so one forward pass resolves refs
+        context_table = {}
+        try:
+            with open(jsonl_file, 'r') as f:
+                for line in f:
+                    line = line.strip()
+                    if not line:
+                        continue
+                    try:
+                        record = jsoncodec.loads(line)
+                    except jsoncodec.JSONDecodeError:
+                        logger.warning("⚠️ [ANALYTICS] Skipping corrupt JSONL line",
+                                     file=str(jsonl_file))
+                        continue
+                    if "context_id" in record and "context_data" in record:
+                        context_table[record["context_id"]] = record["context_data"]
+                    elif "context_ref" in record:
+                        record["context_data"] = context_table.get(
+                            record.pop("context_ref"), {})
+                    records.append(record)
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Failed to read JSONL segment",
+                        file=str(jsonl_file), error=str(e))
+        return records
+
+    def _load_month_records(self, analytics_dir: Path, prefix: str, legacy_key: str,
+                            month_key: str) -> List[Dict[str, Any]]:
+        """Load one month's records from both the legacy JSON file and the JSONL segment"""
+        records = []
+
+        legacy_file = analytics_dir / f"{prefix}_{month_key}.json"
+        if legacy_file.exists():
+            try:
+                with open(legacy_file, 'r') as f:
+                    records.extend(self._resolve_legacy_contexts(
+                        jsoncodec.load(f), legacy_key))
+            except Exception as e:
+                logger.error("❌ [ANALYTICS] Failed to load legacy file",
+                            file=str(legacy_file), error=str(e))
+
+        # Aged months live as compact gzip segments - same content, ~10x smaller
+        gz_file = analytics_dir / f"{prefix}_{month_key}.json.gz"
+        if gz_file.exists():
+            try:
+                with gzip.open(gz_file, 'rt') as f:
+                    records.extend(self._resolve_legacy_contexts(
+                        jsoncodec.loads(f.read()), legacy_key))
+            except Exception as e:
+                logger.error("❌ [ANALYTICS] Failed to load compressed month",
+                            file=str(gz_file), error=str(e))
+
+        jsonl_file = self._jsonl_path(analytics_dir, prefix, month_key)
+        if jsonl_file.exists():
+            records.extend(self._read_jsonl(jsonl_file))
+
+        return records
+
+    def _resolve_legacy_contexts(self, payload: Dict[str, Any],
+                                 legacy_key: str) -> List[Dict[str, Any]]:
+        """Expand context_ref entries from a consolidated file's context table"""
+        records = payload.get(legacy_key, [])
+        table = payload.get("context_table")
+        if table:
+            for record in records:
+                if "context_ref" in record and "context_data" not in record:
+                    record["context_data"] = table.get(
+                        record.pop("context_ref"), {})
+        return records
+
+    def _intern_legacy_contexts(self, data: Dict[str, Any], legacy_key: str):
+        """
+        Intern repeated context blobs into a consolidated file's context
+        table. Compaction expands JSONL records before folding them in, so
+        this is where the month's file gets its final deduplicated form.
+        """
+        table = data.setdefault("context_table", {})
+        for record in data.get(legacy_key, []):
+            context = record.get("context_data")
+            if not isinstance(context, dict) or not context:
+                continue
+            context_id = self._context_blob_id(context)
+            table.setdefault(context_id, context)
+            del record["context_data"]
+            record.pop("context_id", None)
+            record["context_ref"] = context_id
+        if not table:
+            del data["context_table"]
+
+    def _compact_finished_segments(self, analytics_dir: Path, prefix: str,
+                                   legacy_key: str, current_month_key: str):
+        """Merge JSONL segments from past months into consolidated JSON files"""
+        try:
+            for jsonl_file in analytics_dir.glob(f"{prefix}_*.jsonl"):
+                month_key = jsonl_file.stem[len(prefix) + 1:]
+                if month_key == current_month_key:
+                    continue
+
+                records = self._read_jsonl(jsonl_file)
+                legacy_file = analytics_dir / f"{prefix}_{month_key}.json"
+
+                if legacy_file.exists():
+                    with open(legacy_file, 'r') as f:
+                        data = jsoncodec.load(f)
+                else:
+                    data = {"month": month_key, legacy_key: []}
+
+                data[legacy_key].extend(records)
+                self._intern_legacy_contexts(data, legacy_key)
+
+                tmp_file = legacy_file.with_suffix('.json.tmp')
+                with open(tmp_file, 'w') as f:
+                    jsoncodec.dump(data, f)
+                tmp_file.replace(legacy_file)
+                jsonl_file.unlink()
+
+                logger.info("🗜️ [ANALYTICS] Compacted JSONL segment",
+                           file=str(jsonl_file), records=len(records))
+
+            # Month rollover is also the moment to push old consolidated
+            # months down into compressed storage
+            self._compress_aged_months(analytics_dir, prefix, legacy_key, current_month_key)
+
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Failed to compact JSONL segments",
+                        prefix=prefix, error=str(e))
+
+    def _month_age(self, month_key: str, current_month_key: str) -> int:
+        """Whole months between a segment's month and the current month"""
+        try:
+            year, month = (int(p) for p in month_key.split("-"))
+            cur_year, cur_month = (int(p) for p in current_month_key.split("-"))
+            return (cur_year - year) * 12 + (cur_month - month)
+        except ValueError:
+            return 0
+
+    def _compress_aged_months(self, analytics_dir: Path, prefix: str,
+                              legacy_key: str, current_month_key: str):
+        """
+        Rewrite consolidated months older than compress_months_after as
+        compact gzip segments with a summary header. Readers pick the .gz
+        form up transparently in _load_month_records, so this only trades
+        a rare decompression for ~10x less disk and faster historical scans.
+        """
+        try:
+            for legacy_file in analytics_dir.glob(f"{prefix}_*.json"):
+                month_key = legacy_file.stem[len(prefix) + 1:]
+                if self._month_age(month_key, current_month_key) < self.compress_months_after:
+                    continue
+
+                with open(legacy_file, 'r') as f:
+                    data = jsoncodec.load(f)
+                records = data.get(legacy_key, [])
+
+                # Summary header lets future scans answer count/range
+                # questions without touching the record array
+                timestamps = [r.get("timestamp") for r in records if r.get("timestamp")]
+                data["summary"] = {
+                    "record_count": len(records),
+                    "first_timestamp": min(timestamps) if timestamps else None,
+                    "last_timestamp": max(timestamps) if timestamps else None,
+                    "compressed_at": datetime.now().isoformat()
+                }
+
+                gz_file = analytics_dir / f"{prefix}_{month_key}.json.gz"
+                tmp_file = gz_file.with_suffix('.gz.tmp')
+                with gzip.open(tmp_file, 'wt') as f:
+                    f.write(jsoncodec.dumps(data))
+                tmp_file.replace(gz_file)
+                legacy_file.unlink()
+
+                logger.info("🗜️ [ANALYTICS] Compressed aged month",
+                           file=str(gz_file), records=len(records))
+
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Failed to compress aged months",
+                        prefix=prefix, error=str(e))
+
+    # RUNNING AGGREGATES
+    # Counters are bumped as each record is written and persisted next to the
+    # raw files, so the summary endpoints don't re-scan a month of records
+    # every time the dashboard polls.
+
+    def _load_aggregates(self, analytics_dir: Path) -> Dict[str, Any]:
+        """Load (and cache) the running aggregates for a project"""
+        cache_key = str(analytics_dir)
+        if cache_key in self._aggregates_cache:
+            return self._aggregates_cache[cache_key]
+
+        aggregates_file = analytics_dir / "aggregates.json"
+        aggregates = {"months": {}}
+        if aggregates_file.exists():
+            try:
+                with open(aggregates_file, 'r') as f:
+                    aggregates = jsoncodec.load(f)
+            except Exception as e:
+                logger.error("❌ [ANALYTICS] Failed to load aggregates, starting fresh",
+                            file=str(aggregates_file), error=str(e))
+                aggregates = {"months": {}}
+
+        self._aggregates_cache[cache_key] = aggregates
+        return aggregates
+
+    def _save_aggregates(self, analytics_dir: Path, aggregates: Dict[str, Any]):
+        """Persist the running aggregates (atomic write)"""
+        aggregates_file = analytics_dir / "aggregates.json"
+        try:
+            aggregates["updated_at"] = datetime.now().isoformat()
+            tmp_file = aggregates_file.with_suffix('.json.tmp')
+            with open(tmp_file, 'w') as f:
+                jsoncodec.dump(aggregates, f)
+            tmp_file.replace(aggregates_file)
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Failed to save aggregates",
+                        file=str(aggregates_file), error=str(e))
+
+    def _month_aggregates(self, aggregates: Dict[str, Any], month_key: str) -> Dict[str, Any]:
+        """Get (creating if needed) one month's aggregate bucket"""
+        return aggregates.setdefault("months", {}).setdefault(month_key, {
+            "suggestions": 0,
+            "interactions": {"accepted": 0, "ignored": 0, "snoozed": 0, "dismissed": 0},
+            "completions": 0,
+            "time_in_app_sum": 0,
+            "completion_productivity_sum": 0.0,
+            "response_time_sum": 0.0,
+            "response_time_count": 0,
+            "suggestions_per_hour": {},
+            "sessions": {
+                "count": 0,
+                "time_saved_seconds": 0,
+                "switch_pressed": 0,
+                "productivity_score_sum": 0.0,
+                "productivity_score_count": 0
+            },
+            "deploys": {"count": 0, "commands": {}, "time_of_day": {},
+                        "hours": {}, "days": {}}
+        })
+
+    def _bump_aggregates(self, analytics_dir: Path, update_fn):
+        """Apply an update to the current month's aggregates and persist"""
+        try:
+            aggregates = self._load_aggregates(analytics_dir)
+            update_fn(self._month_aggregates(aggregates, self._get_current_month_key()))
+            self._save_aggregates(analytics_dir, aggregates)
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Failed to update aggregates", error=str(e))
+
+    # SQLITE BACKEND (optional)
+    # A single DB with one generic records table, indexed on
+    # project/type/timestamp, replaces the monthly JSON files when enabled.
+
+    def _get_db(self) -> sqlite3.Connection:
+        """Get (creating schema on first use) the analytics database connection"""
+        if self._db_conn is None:
+            db_path = self.projects_root / "analytics.db"
+            self.projects_root.mkdir(parents=True, exist_ok=True)
+            # The connection is shared between the event loop (reads) and the
+            # writer thread (writes); _db_lock serializes access
+            self._db_conn = sqlite3.connect(str(db_path), check_same_thread=False)
+            self._db_conn.execute("""
+                CREATE TABLE IF NOT EXISTS records (
+                    id INTEGER PRIMARY KEY AUTOINCREMENT,
+                    project_name TEXT NOT NULL,
+                    record_type TEXT NOT NULL,
+                    record_key TEXT,
+                    timestamp TEXT NOT NULL,
+                    time_saved_seconds INTEGER DEFAULT 0,
+                    switch_pressed INTEGER DEFAULT 0,
+                    data TEXT NOT NULL
+                )
+            """)
+            self._db_conn.execute("""
+                CREATE INDEX IF NOT EXISTS idx_records_project_type_ts
+                ON records (project_name, record_type, timestamp)
+            """)
+            self._db_conn.execute("""
+                CREATE INDEX IF NOT EXISTS idx_records_type_ts
+                ON records (record_type, timestamp)
+            """)
+            self._db_conn.commit()
+            logger.info("🗄️ [ANALYTICS] SQLite backend opened", db_path=str(db_path))
+        return self._db_conn
+
+    def _db_insert(self, project_name: str, record_type: str, timestamp: str,
+                   record: Dict[str, Any], record_key: Optional[str] = None,
+                   time_saved_seconds: int = 0, switch_pressed: bool = False):
+        """Insert one record into the SQLite store"""
+        db = self._get_db()
+        with self._db_lock:
+            db.execute(
+                "INSERT INTO records (project_name, record_type, record_key, timestamp, "
+                "time_saved_seconds, switch_pressed, data) VALUES (?, ?, ?, ?, ?, ?, ?)",
+                (project_name, record_type, record_key, timestamp,
+                 time_saved_seconds, 1 if switch_pressed else 0, jsoncodec.dumps(record)))
+            db.commit()
+
+    def _db_query_records(self, project_name: str, record_type: str,
+                          since: datetime) -> List[Dict[str, Any]]:
+        """Indexed range scan for one project and record type"""
+        db = self._get_db()
+        with self._db_lock:
+            rows = db.execute(
+                "SELECT data FROM records WHERE project_name = ? AND record_type = ? "
+                "AND timestamp >= ? ORDER BY timestamp DESC",
+                (project_name, record_type, since.isoformat())).fetchall()
+        return [jsoncodec.loads(row[0]) for row in rows]
+
+    def migrate_json_to_sqlite(self) -> int:
+        """
+        Import existing per-project monthly JSON/JSONL files into SQLite.
+
+        Returns the number of records migrated. Safe to re-run: the records
+        table is cleared first so migration never duplicates rows.
+        """
+        migrated = 0
+        try:
+            db = self._get_db()
+            db.execute("DELETE FROM records")
+
+            sources = [
+                ("suggestions", "suggestions", "suggestion", "suggestion_timestamp", "id"),
+                ("interactions", "interactions", "interaction", "interaction_timestamp", "suggestion_id"),
+                ("sessions", "deploy_sessions", "session", "session_start", "session_id"),
+                ("deploy_patterns", "deploy_patterns", "pattern", "deploy_timestamp", None),
+            ]
+
+            if not self.projects_root.exists():
+                return 0
+
+            for project_dir in self.projects_root.iterdir():
+                if not project_dir.is_dir() or project_dir.name.startswith('.'):
+                    continue
+                analytics_dir = project_dir / "analytics"
+                if not analytics_dir.exists():
+                    continue
+                project_name = project_dir.name.replace("_", " ")
+
+                for prefix, legacy_key, record_type, ts_field, key_field in sources:
+                    month_keys = {f.name[len(prefix) + 1:].split('.')[0]
+                                  for f in analytics_dir.glob(f"{prefix}_*.json*")
+                                  if not f.name.endswith('.tmp')}
+                    for month_key in month_keys:
+                        for record in self._load_month_records(analytics_dir, prefix, legacy_key, month_key):
+                            self._db_insert(
+                                project_name, record_type,
+                                record.get(ts_field, ""),
+                                record,
+                                record_key=record.get(key_field) if key_field else None,
+                                time_saved_seconds=record.get("estimated_time_saved_seconds", 0),
+                                switch_pressed=record.get("switch_button_pressed", False))
+                            migrated += 1
+
+            logger.info("🗄️ [ANALYTICS] JSON analytics migrated to SQLite", records=migrated)
+            return migrated
+
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Failed to migrate analytics to SQLite", error=str(e))
+            return migrated
+
+    # COLUMNAR EXPORT
+    # One flat table per record type, appended incrementally, so external
+    # analysis reads stable CSVs instead of re-parsing the app's per-project
+    # monthly storage format.
+
+    EXPORT_SOURCES = [
+        ("suggestions", "suggestions", "suggestion_timestamp", TaskSuggestion),
+        ("interactions", "interactions", "interaction_timestamp", UserInteraction),
+        ("sessions", "deploy_sessions", "session_start", DeploySession),
+        ("deploy_patterns", "deploy_patterns", "deploy_timestamp", DeployPattern),
+    ]
+
+    async def export_analytics(self, output_dir: Optional[str] = None) -> Dict[str, Any]:
+        """Run the incremental columnar export on the writer thread"""
+        target = Path(output_dir) if output_dir else Path.home() / ".deploybot" / "exports"
+        return await self._run_io(lambda: self._export_analytics_sync(target))
+
+    def _export_analytics_sync(self, output_dir: Path) -> Dict[str, Any]:
+        """
+        Append records newer than each project's watermark to per-type CSV
+        tables. Watermarks (last exported timestamp per project and table)
+        live in export_state.json next to the tables, so repeated exports
+        only touch new data.
+        """
+        import csv
+
+        output_dir.mkdir(parents=True, exist_ok=True)
+        state_file = output_dir / "export_state.json"
+        state: Dict[str, str] = {}
+        if state_file.exists():
+            try:
+                with open(state_file, 'r') as f:
+                    state = jsoncodec.load(f)
+            except Exception as e:
+                logger.warning("⚠️ [ANALYTICS] Export state unreadable, full re-export",
+                             error=str(e))
+
+        exported = {prefix: 0 for prefix, _, _, _ in self.EXPORT_SOURCES}
+
+        if self.projects_root.exists():
+            for project_dir in sorted(self.projects_root.iterdir()):
+                if not project_dir.is_dir() or project_dir.name.startswith('.'):
+                    continue
+                analytics_dir = project_dir / "analytics"
+                if not analytics_dir.exists():
+                    continue
+
+                for prefix, legacy_key, ts_field, record_cls in self.EXPORT_SOURCES:
+                    watermark_key = f"{project_dir.name}:{prefix}"
+                    watermark = state.get(watermark_key, "")
+                    columns = ["project"] + [f.name for f in fields(record_cls)]
+
+                    # Months at or after the watermark month can hold new rows
+                    month_keys = sorted({f.name[len(prefix) + 1:].split('.')[0]
+                                         for f in analytics_dir.glob(f"{prefix}_*.json*")
+                                         if not f.name.endswith('.tmp')})
+                    new_records = []
+                    for month_key in month_keys:
+                        if watermark and month_key < watermark[:7]:
+                            continue
+                        for record in self._load_month_records(analytics_dir, prefix,
+                                                               legacy_key, month_key):
+                            if record.get(ts_field, "") > watermark:
+                                new_records.append(record)
+
+                    if not new_records:
+                        continue
+
+                    new_records.sort(key=lambda r: r.get(ts_field, ""))
+                    table_file = output_dir / f"{prefix}.csv"
+                    write_header = not table_file.exists()
+                    with open(table_file, 'a', newline='') as f:
+                        writer = csv.writer(f)
+                        if write_header:
+                            writer.writerow(columns)
+                        for record in new_records:
+                            writer.writerow([self._export_cell(record.get(column))
+                                             if column != "project" else project_dir.name
+                                             for column in columns])
+
+                    state[watermark_key] = new_records[-1].get(ts_field, watermark)
+                    exported[prefix] += len(new_records)
+
+        tmp_file = state_file.with_suffix('.json.tmp')
+        with open(tmp_file, 'w') as f:
+            jsoncodec.dump(state, f)
+        tmp_file.replace(state_file)
+
+        total = sum(exported.values())
+        logger.info("📤 [ANALYTICS] Columnar export completed",
+                   output_dir=str(output_dir), records=total)
+        return {
+            "output_dir": str(output_dir),
+            "exported": exported,
+            "total_records": total,
+            "tables": {prefix: str(output_dir / f"{prefix}.csv")
+                       for prefix, _, _, _ in self.EXPORT_SOURCES}
+        }
+
+    @staticmethod
+    def _export_cell(value: Any) -> Any:
+        """Flatten structured fields so every CSV cell is a scalar"""
+        if isinstance(value, (dict, list)):
+            return jsoncodec.dumps(value)
+        if value is None:
+            return ""
+        return value
+
+    def _month_keys_in_window(self, last_n_days: int) -> List[str]:
+        """Month keys (YYYY-MM) intersecting the last N days, newest first"""
+        end_date = datetime.now()
+        start_date = end_date - timedelta(days=last_n_days)
+        month_keys = []
+        current_month = end_date.replace(day=1)
+        while current_month >= start_date.replace(day=1):
+            month_keys.append(current_month.strftime("%Y-%m"))
+            if current_month.month == 1:
+                current_month = current_month.replace(year=current_month.year - 1, month=12)
+            else:
+                current_month = current_month.replace(month=current_month.month - 1)
+        return month_keys
+
+    def _task_summary_from_aggregates(self, analytics_dir: Path,
+                                      last_n_days: int) -> Optional[Dict[str, Any]]:
+        """
+        Build the task analytics summary from running aggregates.
+
+        Month-granularity window: counters cover whole months intersecting the
+        requested range. Returns None when no aggregates exist yet so callers
+        fall back to scanning the raw records.
+        """
+        aggregates = self._load_aggregates(analytics_dir)
+        months = [aggregates.get("months", {}).get(key)
+                  for key in self._month_keys_in_window(last_n_days)]
+        months = [m for m in months if m]
+        if not months:
+            return None
+
+        total_suggestions = sum(m["suggestions"] for m in months)
+        accepted = sum(m["interactions"].get("accepted", 0) for m in months)
+        ignored = sum(m["interactions"].get("ignored", 0) for m in months)
+        snoozed = sum(m["interactions"].get("snoozed", 0) for m in months)
+        completed = sum(m["completions"] for m in months)
+        response_time_sum = sum(m["response_time_sum"] for m in months)
+        response_time_count = sum(m["response_time_count"] for m in months)
+        time_in_app_sum = sum(m.get("time_in_app_sum", 0) for m in months)
+        productivity_sum = sum(m.get("completion_productivity_sum", 0.0) for m in months)
+
+        return {
+            "suggestions_count": total_suggestions,
+            "accepted": accepted,
+            "ignored": ignored,
+            "snoozed": snoozed,
+            "recent_ignores_30d": ignored,
+            "acceptance_rate": accepted / total_suggestions if total_suggestions > 0 else 0.0,
+            "completion_rate": completed / accepted if accepted > 0 else 0.0,
+            "avg_response_time": response_time_sum / response_time_count if response_time_count > 0 else 0.0,
+            "task_patterns": {
+                "total_completed": completed,
+                "avg_completion_time": time_in_app_sum / max(1, completed),
+                "avg_productivity_score": productivity_sum / max(1, completed)
+            }
+        }
+
+    def _deploy_summary_from_aggregates(self, project_name: str, analytics_dir: Path,
+                                        last_n_days: int) -> Optional[Dict[str, Any]]:
+        """
+        Build the deploy analytics summary from running aggregates.
+
+        Same month-granularity window as _task_summary_from_aggregates;
+        returns None when no aggregates exist yet.
+        """
+        aggregates = self._load_aggregates(analytics_dir)
+        months = [aggregates.get("months", {}).get(key)
+                  for key in self._month_keys_in_window(last_n_days)]
+        months = [m for m in months if m]
+        if not months:
+            return None
+
+        total_sessions = sum(m["sessions"]["count"] for m in months)
+        total_time_saved = sum(m["sessions"]["time_saved_seconds"] for m in months)
+        sessions_with_switch = sum(m["sessions"]["switch_pressed"] for m in months)
+        productivity_sum = sum(m["sessions"]["productivity_score_sum"] for m in months)
+        productivity_count = sum(m["sessions"]["productivity_score_count"] for m in months)
+        total_deploys = sum(m["deploys"]["count"] for m in months)
+
+        command_counts: Dict[str, int] = {}
+        time_of_day_counts: Dict[str, int] = {}
+        hour_counts: Dict[str, int] = {}
+        day_counts: Dict[str, int] = {}
+        for m in months:
+            for command, count in m["deploys"]["commands"].items():
+                command_counts[command] = command_counts.get(command, 0) + count
+            for tod, count in m["deploys"]["time_of_day"].items():
+                time_of_day_counts[tod] = time_of_day_counts.get(tod, 0) + count
+            for hour, count in m["deploys"].get("hours", {}).items():
+                hour_counts[hour] = hour_counts.get(hour, 0) + count
+            for day, count in m["deploys"].get("days", {}).items():
+                day_counts[day] = day_counts.get(day, 0) + count
+
+        switch_rate = (sessions_with_switch / total_sessions) if total_sessions > 0 else 0.0
+
+        return {
+            "project_name": project_name,
+            "analysis_period_days": last_n_days,
+            "timestamp": datetime.now().isoformat(),
+            "total_sessions": total_sessions,
+            "total_time_saved_minutes": total_time_saved / 60,
+            "switch_button_usage_rate": switch_rate,
+            "avg_productivity_score": productivity_sum / productivity_count if productivity_count > 0 else 0.0,
+            "total_deploys": total_deploys,
+            "avg_deploys_per_day": total_deploys / last_n_days if last_n_days > 0 else 0.0,
+            "most_common_commands": sorted(command_counts.items(), key=lambda x: x[1], reverse=True)[:5],
+            "deploy_time_patterns": time_of_day_counts,
+            "deploy_hour_histogram": hour_counts,
+            "deploy_day_patterns": day_counts,
+            "avg_time_saved_per_session_minutes": (total_time_saved / total_sessions / 60) if total_sessions > 0 else 0.0,
+            "productivity_improvement_rate": switch_rate * 100
+        }
+
     def _generate_suggestion_id(self, task_text: str, timestamp: str) -> str:
         """Generate unique suggestion ID based on task and timestamp"""
         content = f"{task_text}_{timestamp}"
         return f"suggestion_{hashlib.md5(content.encode()).hexdigest()[:12]}"
+
+    def _suggestion_content_hash(self, task: Dict[str, Any], project_name: str,
+                                 context: Dict[str, Any]) -> str:
+        """Content address of a suggestion - identical re-suggestions collide"""
+        content = "_".join([
+            project_name,
+            str(task.get('id', '')),
+            task.get('text', ''),
+            task.get('app', ''),
+            context.get('deploy_command', '')
+        ])
+        return hashlib.md5(content.encode()).hexdigest()[:16]
     
     def _generate_session_id(self, project_name: str, deploy_command: str) -> str:
         """Generate unique session ID for deploy sessions"""
@@ -131,10 +1328,24 @@ class AnalyticsManager:
         Record a task suggestion event
         Returns suggestion ID for tracking interactions
         """
-        logger.info("📝 [ANALYTICS] Recording task suggestion", 
-                   task=task.get('text', ''), 
+        logger.info("📝 [ANALYTICS] Recording task suggestion",
+                   task=task.get('text', ''),
                    project=project_name)
-        
+
+        # Content-addressed dedup: the same task re-suggested within the
+        # window bumps a counter instead of appending another full record
+        content_hash = self._suggestion_content_hash(task, project_name, context)
+        recent = self._recent_suggestions.get(content_hash)
+        if recent and (time.monotonic() - recent["at"]) < self.suggestion_dedup_window:
+            recent["at"] = time.monotonic()
+            recent["repeats"] += 1
+            await self._record_suggestion_repeat(project_name)
+            logger.debug("🔁 [ANALYTICS] Duplicate suggestion within window, counter bumped",
+                        suggestion_id=recent["id"],
+                        repeats=recent["repeats"],
+                        project=project_name)
+            return recent["id"]
+
         # Generate suggestion ID
         timestamp = datetime.now().isoformat()
         suggestion_id = self._generate_suggestion_id(task.get('text', ''), timestamp)
@@ -162,12 +1373,38 @@ class AnalyticsManager:
         
         # Save to monthly suggestions file
         await self._save_suggestion(suggestion)
-        
-        logger.info("✅ [ANALYTICS] Task suggestion recorded", 
+
+        # Register the content hash for the dedup window, pruning stale entries
+        # opportunistically so the index stays bounded
+        now = time.monotonic()
+        for stale_hash in [h for h, entry in self._recent_suggestions.items()
+                           if (now - entry["at"]) >= self.suggestion_dedup_window]:
+            del self._recent_suggestions[stale_hash]
+        self._recent_suggestions[content_hash] = {
+            "id": suggestion_id, "at": now, "repeats": 0
+        }
+
+        logger.info("✅ [ANALYTICS] Task suggestion recorded",
                    suggestion_id=suggestion_id,
                    project=project_name)
-        
+
         return suggestion_id
+
+    async def _record_suggestion_repeat(self, project_name: str):
+        """Persist a duplicate suggestion as an aggregate counter bump only"""
+        try:
+            analytics_dir = self._get_analytics_dir(project_name)
+
+            def bump(month: Dict[str, Any]):
+                # Older aggregate files predate this key
+                month["suggestion_repeats"] = month.get("suggestion_repeats", 0) + 1
+
+            def persist():
+                self._bump_aggregates(analytics_dir, bump)
+
+            self._queue_io(persist)
+        except Exception as e:
+            logger.warning("⚠️ [ANALYTICS] Failed to record suggestion repeat", error=str(e))
     
     async def record_user_interaction(self, suggestion_id: str, 
                                     interaction_type: str,
@@ -209,81 +1446,70 @@ class AnalyticsManager:
         return True
     
     async def _save_suggestion(self, suggestion: TaskSuggestion):
-        """Save task suggestion to monthly JSON file"""
+        """Save task suggestion as a single append to the monthly JSONL segment"""
         try:
             analytics_dir = self._get_analytics_dir(suggestion.project_name)
-            month_key = self._get_current_month_key()
-            suggestions_file = analytics_dir / f"suggestions_{month_key}.json"
-            
-            # Load existing data or create new
-            if suggestions_file.exists():
-                with open(suggestions_file, 'r') as f:
-                    data = json.load(f)
-            else:
-                data = {"month": month_key, "suggestions": []}
-            
-            # Add new suggestion
-            data["suggestions"].append({
-                "id": suggestion.id,
-                "task_id": suggestion.task_id,
-                "task_text": suggestion.task_text,
-                "task_tags": suggestion.task_tags,
-                "suggested_app": suggestion.suggested_app,
-                "suggestion_timestamp": suggestion.suggestion_timestamp,
-                "deploy_command": suggestion.deploy_command,
-                "timer_duration": suggestion.timer_duration,
-                "context_data": suggestion.context_data
-            })
-            
-            # Save back to file
-            with open(suggestions_file, 'w') as f:
-                json.dump(data, f, indent=2)
-            
-            logger.debug("💾 [ANALYTICS] Suggestion saved to file", 
-                        file=str(suggestions_file),
+            record = suggestion.to_record()
+            # JSONL appends store an interned context; sqlite keeps the full
+            # record since its rows don't share a file-level table
+            line = _encode_record_line(
+                self._intern_record_context(analytics_dir, record))
+
+            hour = str(_record_hour(record, "suggestion_timestamp"))
+
+            def bump(month: Dict[str, Any]):
+                month["suggestions"] += 1
+                month["suggestions_per_hour"][hour] = month["suggestions_per_hour"].get(hour, 0) + 1
+
+            def persist():
+                if self.use_sqlite:
+                    self._db_insert(suggestion.project_name, "suggestion",
+                                    suggestion.suggestion_timestamp, record,
+                                    record_key=suggestion.id)
+                else:
+                    self._append_record(analytics_dir, "suggestions", "suggestions", line)
+                self._bump_aggregates(analytics_dir, bump)
+
+            self._queue_io(persist)
+
+            logger.debug("💾 [ANALYTICS] Suggestion appended",
                         suggestion_id=suggestion.id)
-            
+
         except Exception as e:
-            logger.error("❌ [ANALYTICS] Failed to save suggestion", 
+            logger.error("❌ [ANALYTICS] Failed to save suggestion",
                         error=str(e),
                         suggestion_id=suggestion.id)
-    
+
     async def _save_interaction(self, interaction: UserInteraction, project_name: str):
-        """Save user interaction to monthly JSON file"""
+        """Save user interaction as a single append to the monthly JSONL segment"""
         try:
             analytics_dir = self._get_analytics_dir(project_name)
-            month_key = self._get_current_month_key()
-            interactions_file = analytics_dir / f"interactions_{month_key}.json"
-            
-            # Load existing data or create new
-            if interactions_file.exists():
-                with open(interactions_file, 'r') as f:
-                    data = json.load(f)
-            else:
-                data = {"month": month_key, "interactions": []}
-            
-            # Add new interaction
-            data["interactions"].append({
-                "suggestion_id": interaction.suggestion_id,
-                "interaction_type": interaction.interaction_type,
-                "interaction_timestamp": interaction.interaction_timestamp,
-                "response_time_seconds": interaction.response_time_seconds,
-                "completion_detected": interaction.completion_detected,
-                "completion_method": interaction.completion_method,
-                "time_in_app_seconds": interaction.time_in_app_seconds,
-                "productivity_score": interaction.productivity_score
-            })
-            
-            # Save back to file
-            with open(interactions_file, 'w') as f:
-                json.dump(data, f, indent=2)
-            
-            logger.debug("💾 [ANALYTICS] Interaction saved to file", 
-                        file=str(interactions_file),
+            record = interaction.to_record()
+            line = _encode_record_line(record)
+
+            def bump(month: Dict[str, Any]):
+                counts = month["interactions"]
+                counts[interaction.interaction_type] = counts.get(interaction.interaction_type, 0) + 1
+                if interaction.response_time_seconds:
+                    month["response_time_sum"] += interaction.response_time_seconds
+                    month["response_time_count"] += 1
+
+            def persist():
+                if self.use_sqlite:
+                    self._db_insert(project_name, "interaction",
+                                    interaction.interaction_timestamp, record,
+                                    record_key=interaction.suggestion_id)
+                else:
+                    self._append_record(analytics_dir, "interactions", "interactions", line)
+                self._bump_aggregates(analytics_dir, bump)
+
+            self._queue_io(persist)
+
+            logger.debug("💾 [ANALYTICS] Interaction appended",
                         suggestion_id=interaction.suggestion_id)
-            
+
         except Exception as e:
-            logger.error("❌ [ANALYTICS] Failed to save interaction", 
+            logger.error("❌ [ANALYTICS] Failed to save interaction",
                         error=str(e),
                         suggestion_id=interaction.suggestion_id)
     
@@ -298,64 +1524,252 @@ class AnalyticsManager:
             logger.warning("⚠️ [ANALYTICS] No target app specified for focus monitoring")
             return
         
-        # Store monitoring data
+        # Store monitoring data - consumed by the shared focus stream,
+        # no per-suggestion task is spawned
         self.app_focus_monitoring[suggestion_id] = {
             'target_app': target_app,
             'project_name': project_name,
             'start_time': time.time(),
             'task_data': task_data,
             'focus_detected': False,
-            'total_focus_time': 0
+            'total_focus_time': 0,
+            'focused_since': None
         }
-        
-        logger.info("👁️ [ANALYTICS] Started app focus monitoring", 
+
+        logger.info("👁️ [ANALYTICS] Started app focus monitoring",
                    suggestion_id=suggestion_id,
                    target_app=target_app)
-        
-        # Start the monitoring task
-        asyncio.create_task(self._monitor_app_focus(suggestion_id))
-    
-    async def _monitor_app_focus(self, suggestion_id: str):
-        """Monitor app focus for task completion (time-based heuristic)"""
-        monitor_data = self.app_focus_monitoring.get(suggestion_id)
-        if not monitor_data:
+
+        # If the target app is already frontmost, start accruing immediately
+        if self._current_focus_app:
+            self._on_focus_change(self._current_focus_app)
+
+        await self._ensure_focus_stream()
+
+    async def _ensure_focus_stream(self):
+        """Start the shared focus-event stream if it is not already running"""
+        if self._focus_stream_task and not self._focus_stream_task.done():
             return
-        
-        target_app = monitor_data['target_app']
-        project_name = monitor_data['project_name']
-        start_time = monitor_data['start_time']
-        
-        # Simple time-based heuristic: check if 10+ minutes have passed
-        # In a real implementation, this would integrate with macOS focus detection
-        completion_threshold = 600  # 10 minutes in seconds
-        
-        logger.info("⏱️ [ANALYTICS] Starting app focus monitoring timer", 
-                   suggestion_id=suggestion_id,
-                   target_app=target_app,
-                   threshold_minutes=completion_threshold/60)
-        
-        # Wait for completion threshold
-        await asyncio.sleep(completion_threshold)
-        
-        # Check if monitoring is still active
-        if suggestion_id in self.app_focus_monitoring:
-            elapsed_time = time.time() - start_time
-            
-            # Mark as completed (heuristic)
-            await self._mark_task_completed(
-                suggestion_id, 
-                project_name,
-                completion_method="time_heuristic",
-                time_in_app_seconds=int(elapsed_time),
-                productivity_score=0.75  # Moderate confidence for heuristic
+
+        try:
+            self._focus_stream_proc = await asyncio.create_subprocess_exec(
+                sys.executable, "-c", _FOCUS_STREAM_HELPER,
+                stdout=asyncio.subprocess.PIPE,
+                stderr=asyncio.subprocess.DEVNULL
             )
-            
-            # Clean up monitoring
+            logger.info("👁️ [ANALYTICS] Focus event stream started",
+                       pid=self._focus_stream_proc.pid)
+        except Exception as e:
+            self._focus_stream_proc = None
+            logger.warning("⚠️ [ANALYTICS] Focus helper unavailable, using time heuristic only",
+                          error=str(e))
+
+        self._focus_stream_task = task_supervisor.spawn(
+            "analytics_focus_stream", self._consume_focus_stream)
+
+    async def _consume_focus_stream(self):
+        """
+        Single consumer for every active suggestion monitor: folds
+        focus-change events from the helper into monitor state and runs
+        the completion sweep between events. Stops itself (and the
+        helper) once no monitors remain.
+        """
+        try:
+            while self.app_focus_monitoring or self._pending_focus_probes:
+                line = None
+                if self._focus_stream_proc and self._focus_stream_proc.stdout:
+                    try:
+                        raw = await asyncio.wait_for(
+                            self._focus_stream_proc.stdout.readline(), timeout=30.0)
+                        if raw:
+                            line = raw.decode(errors="replace").strip()
+                        else:
+                            # Helper exited - continue in sweep-only mode
+                            self._focus_stream_proc = None
+                    except asyncio.TimeoutError:
+                        pass
+                else:
+                    await asyncio.sleep(30.0)
+
+                if line:
+                    self._on_focus_change(line)
+
+                # Folding an event is cheap; the completion sweep is the
+                # heavier pass, so rate-limit it to keep background cost
+                # flat even when the user switches apps rapidly
+                if time.time() - self._last_focus_sweep >= self.focus_sweep_interval:
+                    self._last_focus_sweep = time.time()
+                    await self._sweep_focus_monitors()
+        except asyncio.CancelledError:
+            pass
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Focus stream consumer failed", error=str(e))
+        finally:
+            proc = self._focus_stream_proc
+            self._focus_stream_proc = None
+            if proc:
+                try:
+                    proc.kill()
+                    await proc.wait()
+                except Exception:
+                    pass
+            logger.debug("👁️ [ANALYTICS] Focus event stream stopped")
+
+    async def stop_focus_stream(self):
+        """Stop the focus stream and its helper process (backend shutdown)"""
+        if self._focus_stream_task:
+            self._focus_stream_task.cancel()
+            try:
+                await self._focus_stream_task
+            except asyncio.CancelledError:
+                pass
+            self._focus_stream_task = None
+
+    def _on_focus_change(self, app_name: str):
+        """Fold one frontmost-app change into every active monitor"""
+        self._focus_events_seen = True
+        self._current_focus_app = app_name
+        now = time.time()
+
+        # Resolve pending dispatch-to-focus probes against this event
+        if self._pending_focus_probes:
+            remaining = []
+            for probe in self._pending_focus_probes:
+                elapsed = now - probe['dispatched_at']
+                if probe['app'] in app_name.lower():
+                    self._record_redirect_latency(probe['app'], probe['method'],
+                                                  elapsed * 1000.0)
+                elif elapsed < self.focus_probe_timeout:
+                    remaining.append(probe)
+                else:
+                    logger.debug("⏱️ [ANALYTICS] Focus probe expired unresolved",
+                                app=probe['app'], method=probe['method'])
+            self._pending_focus_probes = remaining
+
+        for suggestion_id, monitor in self.app_focus_monitoring.items():
+            target = monitor['target_app'].lower()
+            in_target = bool(target) and target in app_name.lower()
+
+            if in_target and monitor['focused_since'] is None:
+                monitor['focused_since'] = now
+                monitor['focus_detected'] = True
+                logger.debug("👁️ [ANALYTICS] Target app focused",
+                            suggestion_id=suggestion_id, app=app_name)
+            elif not in_target and monitor['focused_since'] is not None:
+                monitor['total_focus_time'] += now - monitor['focused_since']
+                monitor['focused_since'] = None
+
+    async def track_redirect_dispatch(self, app_name: str, method: str):
+        """
+        Register a dispatch-to-focus probe for a just-dispatched redirect.
+        The focus stream resolves it when the target app becomes frontmost,
+        yielding the real switch latency for this app/strategy pair.
+        """
+        self._pending_focus_probes.append({
+            'app': app_name.lower(),
+            'method': method,
+            'dispatched_at': time.time(),
+        })
+        await self._ensure_focus_stream()
+
+    def _load_redirect_latency(self) -> Dict[str, Dict[str, Any]]:
+        """Load persisted per-app redirect latency stats once per session"""
+        if self._redirect_latency is not None:
+            return self._redirect_latency
+
+        self._redirect_latency = {}
+        try:
+            if self.redirect_latency_file.exists():
+                with open(self.redirect_latency_file, 'r') as f:
+                    self._redirect_latency = jsoncodec.load(f)
+        except Exception as e:
+            logger.warning("⚠️ [ANALYTICS] Failed to load redirect latency stats",
+                          error=str(e))
+        return self._redirect_latency
+
+    def _record_redirect_latency(self, app_name: str, method: str, latency_ms: float):
+        """Fold one resolved probe into the per-app, per-strategy stats"""
+        stats = self._load_redirect_latency()
+        methods = stats.setdefault(app_name, {})
+        entry = methods.setdefault(method, {'count': 0, 'total_ms': 0.0, 'best_ms': None})
+        entry['count'] += 1
+        entry['total_ms'] += latency_ms
+        if entry['best_ms'] is None or latency_ms < entry['best_ms']:
+            entry['best_ms'] = latency_ms
+
+        logger.info("⏱️ [ANALYTICS] Redirect dispatch-to-focus measured",
+                   app=app_name, method=method,
+                   latency_ms=round(latency_ms, 1),
+                   avg_ms=round(entry['total_ms'] / entry['count'], 1))
+
+        snapshot = jsoncodec.dumps(stats)
+
+        def persist():
+            self.redirect_latency_file.parent.mkdir(parents=True, exist_ok=True)
+            temp_file = self.redirect_latency_file.with_suffix('.tmp')
+            temp_file.write_text(snapshot)
+            temp_file.replace(self.redirect_latency_file)
+
+        self._queue_io(persist)
+
+    def get_fastest_redirect_method(self, app_name: str,
+                                    min_samples: int = 3) -> Optional[str]:
+        """
+        Strategy with the lowest mean dispatch-to-focus latency for the app
+        on this machine, or None until enough probes have resolved.
+        """
+        methods = self._load_redirect_latency().get(app_name.lower(), {})
+        best_method = None
+        best_avg = None
+        for method, entry in methods.items():
+            if entry.get('count', 0) < min_samples:
+                continue
+            avg = entry['total_ms'] / entry['count']
+            if best_avg is None or avg < best_avg:
+                best_avg = avg
+                best_method = method
+        return best_method
+
+    async def _sweep_focus_monitors(self):
+        """Complete or expire active monitors based on accrued focus time"""
+        now = time.time()
+        completed = []
+
+        for suggestion_id, monitor in list(self.app_focus_monitoring.items()):
+            focus_time = monitor['total_focus_time']
+            if monitor['focused_since'] is not None:
+                focus_time += now - monitor['focused_since']
+            elapsed = now - monitor['start_time']
+
+            if self._focus_events_seen and focus_time >= self.focus_completion_threshold:
+                completed.append((suggestion_id, monitor, "focus_tracking",
+                                  int(focus_time), 0.9))
+            elif not self._focus_events_seen and elapsed >= self.focus_completion_threshold:
+                # No focus events available (helper missing) - fall back to
+                # the old elapsed-time heuristic so completions still record
+                completed.append((suggestion_id, monitor, "time_heuristic",
+                                  int(elapsed), 0.75))
+            elif elapsed >= self.focus_monitor_timeout:
+                del self.app_focus_monitoring[suggestion_id]
+                logger.info("🕐 [ANALYTICS] Focus monitoring expired without completion",
+                           suggestion_id=suggestion_id,
+                           target_app=monitor['target_app'])
+
+        for suggestion_id, monitor, method, seconds, score in completed:
             del self.app_focus_monitoring[suggestion_id]
-            
-            logger.info("✅ [ANALYTICS] Task marked as completed (heuristic)", 
+
+            await self._mark_task_completed(
+                suggestion_id,
+                monitor['project_name'],
+                completion_method=method,
+                time_in_app_seconds=seconds,
+                productivity_score=score
+            )
+
+            logger.info("✅ [ANALYTICS] Task marked as completed",
                        suggestion_id=suggestion_id,
-                       elapsed_time_minutes=elapsed_time/60)
+                       completion_method=method,
+                       time_in_app_minutes=seconds / 60)
     
     async def _mark_task_completed(self, suggestion_id: str, 
                                  project_name: str,
@@ -366,30 +1780,79 @@ class AnalyticsManager:
         try:
             analytics_dir = self._get_analytics_dir(project_name)
             month_key = self._get_current_month_key()
-            interactions_file = analytics_dir / f"interactions_{month_key}.json"
-            
-            if not interactions_file.exists():
-                logger.warning("⚠️ [ANALYTICS] No interactions file found for completion update")
-                return
-            
-            # Load and update interactions data
-            with open(interactions_file, 'r') as f:
-                data = json.load(f)
-            
-            # Find and update the interaction
-            for interaction in data["interactions"]:
+
+            def apply_update(interaction: Dict[str, Any]) -> bool:
                 if interaction["suggestion_id"] == suggestion_id:
                     interaction["completion_detected"] = True
                     interaction["completion_method"] = completion_method
                     interaction["time_in_app_seconds"] = time_in_app_seconds
                     interaction["productivity_score"] = productivity_score
-                    break
-            
-            # Save updated data
-            with open(interactions_file, 'w') as f:
-                json.dump(data, f, indent=2)
-            
-            logger.info("✅ [ANALYTICS] Task completion recorded", 
+                    return True
+                return False
+
+            def persist():
+                updated = False
+
+                if self.use_sqlite:
+                    db = self._get_db()
+                    with self._db_lock:
+                        row = db.execute(
+                            "SELECT id, data FROM records WHERE record_type = 'interaction' "
+                            "AND record_key = ? ORDER BY id DESC LIMIT 1",
+                            (suggestion_id,)).fetchone()
+                        if row is not None:
+                            record = jsoncodec.loads(row[1])
+                            if apply_update(record):
+                                db.execute("UPDATE records SET data = ? WHERE id = ?",
+                                           (jsoncodec.dumps(record), row[0]))
+                                db.commit()
+                                updated = True
+
+                # New interactions live in the JSONL segment; completions are rare
+                # so a one-off rewrite of the segment is acceptable here
+                jsonl_file = self._jsonl_path(analytics_dir, "interactions", month_key)
+                if not self.use_sqlite and jsonl_file.exists():
+                    records = self._read_jsonl(jsonl_file)
+                    if any(apply_update(record) for record in records):
+                        tmp_file = jsonl_file.with_suffix('.jsonl.tmp')
+                        with open(tmp_file, 'w') as f:
+                            for record in records:
+                                f.write(jsoncodec.dumps(record) + "\n")
+                        tmp_file.replace(jsonl_file)
+                        updated = True
+
+                # Fall back to the legacy consolidated file
+                if not updated:
+                    interactions_file = analytics_dir / f"interactions_{month_key}.json"
+                    if not interactions_file.exists():
+                        logger.warning("⚠️ [ANALYTICS] No interactions file found for completion update")
+                        return
+
+                    with open(interactions_file, 'r') as f:
+                        data = jsoncodec.load(f)
+
+                    for interaction in data["interactions"]:
+                        if apply_update(interaction):
+                            break
+
+                    with open(interactions_file, 'w') as f:
+                        jsoncodec.dump(data, f)
+                    updated = True
+
+                if updated:
+                    def bump(month: Dict[str, Any]):
+                        month["completions"] += 1
+                        month["time_in_app_sum"] = month.get("time_in_app_sum", 0) + time_in_app_seconds
+                        month["completion_productivity_sum"] = \
+                            month.get("completion_productivity_sum", 0.0) + productivity_score
+
+                    self._bump_aggregates(analytics_dir, bump)
+
+            # Run on the writer thread so the segment rewrite happens after
+            # any queued appends and off the event loop
+            await self._run_io(persist)
+
+            logger.info("✅ [ANALYTICS] Task completion recorded",
                        suggestion_id=suggestion_id,
                        completion_method=completion_method,
                        time_in_app_minutes=time_in_app_seconds/60)
@@ -413,45 +1876,50 @@ class AnalyticsManager:
         
         try:
             analytics_dir = self._get_analytics_dir(project_name)
-            
+
+            # Project-wide summaries come straight from the running aggregates;
+            # per-task queries still need the raw records below
+            if task_text is None:
+                summary = self._task_summary_from_aggregates(analytics_dir, last_n_days)
+                if summary is not None:
+                    return summary
+
             # Load recent months' data
             end_date = datetime.now()
             start_date = end_date - timedelta(days=last_n_days)
             
             suggestions_data = []
             interactions_data = []
-            
-            # Load data from multiple months if needed
-            current_month = end_date.replace(day=1)
-            while current_month >= start_date.replace(day=1):
-                month_key = current_month.strftime("%Y-%m")
-                
-                # Load suggestions
-                suggestions_file = analytics_dir / f"suggestions_{month_key}.json"
-                if suggestions_file.exists():
-                    with open(suggestions_file, 'r') as f:
-                        month_suggestions = json.load(f)
-                        suggestions_data.extend(month_suggestions.get("suggestions", []))
-                
-                # Load interactions
-                interactions_file = analytics_dir / f"interactions_{month_key}.json"
-                if interactions_file.exists():
-                    with open(interactions_file, 'r') as f:
-                        month_interactions = json.load(f)
-                        interactions_data.extend(month_interactions.get("interactions", []))
-                
-                # Move to previous month
-                if current_month.month == 1:
-                    current_month = current_month.replace(year=current_month.year - 1, month=12)
-                else:
-                    current_month = current_month.replace(month=current_month.month - 1)
-            
-            # Build analytics summary
-            analytics = self._build_analytics_summary(
-                suggestions_data, 
-                interactions_data, 
+
+            if self.use_sqlite:
+                suggestions_data = self._db_query_records(project_name, "suggestion", start_date)
+                interactions_data = self._db_query_records(project_name, "interaction", start_date)
+            else:
+                # Month keys embedded in the filenames prune partitions before
+                # any I/O - a 30-day query touches at most two months. Inside
+                # the boundary month, records outside the range are trimmed at
+                # scan time with a lexicographic ISO compare, so the offloaded
+                # aggregation pass never sees them.
+                start_iso = start_date.isoformat()
+                for month_key in self._month_keys_in_window(last_n_days):
+                    suggestions_data.extend(
+                        record for record in self._load_month_records(
+                            analytics_dir, "suggestions", "suggestions", month_key)
+                        if record.get("suggestion_timestamp", "") >= start_iso)
+                    interactions_data.extend(
+                        record for record in self._load_month_records(
+                            analytics_dir, "interactions", "interactions", month_key)
+                        if record.get("interaction_timestamp", "") >= start_iso)
+            
+            # Build analytics summary (big ranges go to the worker pool so
+            # the GIL-bound pass doesn't stall deploy detection or timers)
+            analytics = await self._offload_aggregation(
+                _build_analytics_summary,
+                suggestions_data,
+                interactions_data,
                 task_text,
-                last_n_days
+                last_n_days,
+                record_count=len(suggestions_data) + len(interactions_data)
             )
             
             logger.debug("✅ [ANALYTICS] Task analytics retrieved", 
@@ -477,72 +1945,6 @@ class AnalyticsManager:
                 "task_patterns": {}
             }
     
-    def _build_analytics_summary(self, suggestions: List[Dict], 
-                               interactions: List[Dict],
-                               task_text: str = None,
-                               last_n_days: int = 30) -> Dict[str, Any]:
-        """Build analytics summary from raw data"""
-        
-        # Filter by task text if specified
-        if task_text:
-            suggestions = [s for s in suggestions if s["task_text"] == task_text]
-        
-        # Create suggestion ID mapping
-        suggestion_ids = {s["id"] for s in suggestions}
-        
-        # Filter interactions for our suggestions
-        relevant_interactions = [
-            i for i in interactions 
-            if i["suggestion_id"] in suggestion_ids
-        ]
-        
-        # Calculate metrics
-        total_suggestions = len(suggestions)
-        accepted = len([i for i in relevant_interactions if i["interaction_type"] == "accepted"])
-        ignored = len([i for i in relevant_interactions if i["interaction_type"] == "ignored"])
-        snoozed = len([i for i in relevant_interactions if i["interaction_type"] == "snoozed"])
-        
-        # Recent ignores (last 30 days)
-        cutoff_date = datetime.now() - timedelta(days=last_n_days)
-        recent_ignores = len([
-            i for i in relevant_interactions 
-            if i["interaction_type"] == "ignored" and 
-            datetime.fromisoformat(i["interaction_timestamp"].replace('Z', '+00:00')) >= cutoff_date
-        ])
-        
-        # Completion metrics
-        completed_tasks = len([i for i in relevant_interactions if i["completion_detected"]])
-        
-        # Response time metrics
-        response_times = [i["response_time_seconds"] for i in relevant_interactions if i["response_time_seconds"]]
-        avg_response_time = sum(response_times) / len(response_times) if response_times else 0.0
-        
-        # Calculate rates
-        acceptance_rate = accepted / total_suggestions if total_suggestions > 0 else 0.0
-        completion_rate = completed_tasks / accepted if accepted > 0 else 0.0
-        
-        return {
-            "suggestions_count": total_suggestions,
-            "accepted": accepted,
-            "ignored": ignored,
-            "snoozed": snoozed,
-            "recent_ignores_30d": recent_ignores,
-            "acceptance_rate": acceptance_rate,
-            "completion_rate": completion_rate,
-            "avg_response_time": avg_response_time,
-            "task_patterns": {
-                "total_completed": completed_tasks,
-                "avg_completion_time": sum([
-                    i["time_in_app_seconds"] for i in relevant_interactions 
-                    if i["time_in_app_seconds"]
-                ]) / max(1, completed_tasks),
-                "avg_productivity_score": sum([
-                    i["productivity_score"] for i in relevant_interactions 
-                    if i["productivity_score"]
-                ]) / max(1, completed_tasks)
-            }
-        }
-    
     async def get_project_analytics_summary(self, project_name: str) -> Dict[str, Any]:
         """Get high-level analytics summary for a project"""
         try:
@@ -551,26 +1953,23 @@ class AnalyticsManager:
             # Get current month data
             month_key = self._get_current_month_key()
             
-            # Load suggestions
-            suggestions_file = analytics_dir / f"suggestions_{month_key}.json"
-            suggestions_count = 0
-            if suggestions_file.exists():
-                with open(suggestions_file, 'r') as f:
-                    data = json.load(f)
-                    suggestions_count = len(data.get("suggestions", []))
-            
-            # Load interactions
-            interactions_file = analytics_dir / f"interactions_{month_key}.json"
-            interactions_count = 0
-            acceptance_rate = 0.0
-            if interactions_file.exists():
-                with open(interactions_file, 'r') as f:
-                    data = json.load(f)
-                    interactions = data.get("interactions", [])
-                    interactions_count = len(interactions)
-                    
-                    accepted = len([i for i in interactions if i["interaction_type"] == "accepted"])
-                    acceptance_rate = accepted / suggestions_count if suggestions_count > 0 else 0.0
+            # Serve counts from the running aggregates when available
+            month = self._load_aggregates(analytics_dir).get("months", {}).get(month_key)
+            if month:
+                suggestions_count = month["suggestions"]
+                interactions_count = sum(month["interactions"].values())
+                accepted = month["interactions"].get("accepted", 0)
+            else:
+                # No aggregates yet - fall back to the raw records
+                suggestions = self._load_month_records(analytics_dir, "suggestions", "suggestions", month_key)
+                suggestions_count = len(suggestions)
+
+                interactions = self._load_month_records(analytics_dir, "interactions", "interactions", month_key)
+                interactions_count = len(interactions)
+
+                accepted = len([i for i in interactions if i["interaction_type"] == "accepted"])
+
+            acceptance_rate = accepted / suggestions_count if suggestions_count > 0 else 0.0
             
             return {
                 "project_name": project_name,
@@ -621,9 +2020,11 @@ class AnalyticsManager:
             session_status="active"
         )
         
-        # Store in active sessions
+        # Store in active sessions and the per-project index
         self.active_sessions[session_id] = session
-        
+        self._project_active_sessions[project_name] = session_id
+        self._snapshot_active_sessions(force=True)
+
         # Record deploy pattern
         await self._record_deploy_pattern(project_name, deploy_command)
         
@@ -666,10 +2067,16 @@ class AnalyticsManager:
             
             # Save to monthly sessions file
             await self._save_session(session)
-            
-            # Remove from active sessions
+
+            # The finished session changes this project's overview numbers
+            self.mark_project_dirty(session.project_name)
+
+            # Remove from active sessions and the per-project index
             del self.active_sessions[session_id]
-            
+            if self._project_active_sessions.get(session.project_name) == session_id:
+                del self._project_active_sessions[session.project_name]
+            self._snapshot_active_sessions(force=True)
+
             logger.info("✅ [ANALYTICS] Deploy session ended and saved", 
                        session_id=session_id,
                        status=status,
@@ -694,12 +2101,11 @@ class AnalyticsManager:
         if session_id and session_id in self.active_sessions:
             session = self.active_sessions[session_id]
         elif project_name:
-            # Find active session for project
-            for sid, sess in self.active_sessions.items():
-                if sess.project_name == project_name and sess.session_status == "active":
-                    session = sess
-                    session_id = sid
-                    break
+            # Find active session for project via the maintained index
+            sid = self._project_active_sessions.get(project_name)
+            if sid is not None:
+                session = self.active_sessions.get(sid)
+                session_id = sid
         
         if not session:
             logger.warning("⚠️ [ANALYTICS] No active session found for Switch tracking", 
@@ -716,7 +2122,8 @@ class AnalyticsManager:
             # Record the Switch press
             session.switch_button_pressed = True
             session.switch_timestamp = datetime.now().isoformat()
-            
+            self._snapshot_active_sessions()
+
             logger.info("✅ [ANALYTICS] First Switch button press recorded", 
                        session_id=session_id,
                        project=session.project_name)
@@ -734,7 +2141,11 @@ class AnalyticsManager:
         """
         try:
             now = datetime.now()
-            
+
+            # Update the in-memory index first so the frequency score below
+            # (and any concurrent deploy handling) sees this deploy
+            await self._index_deploy_timestamp(project_name, now)
+
             # Create deploy pattern record
             pattern = DeployPattern(
                 project_name=project_name,
@@ -742,11 +2153,15 @@ class AnalyticsManager:
                 deploy_timestamp=now.isoformat(),
                 time_of_day=self._get_time_of_day(now.hour),
                 day_of_week=now.strftime("%A"),
+                hour=now.hour,
                 deploy_frequency_score=await self._calculate_deploy_frequency_score(project_name)
             )
             
             # Save to monthly patterns file
             await self._save_deploy_pattern(pattern)
+
+            # Deploy counts feed the cross-project overview rollup
+            self.mark_project_dirty(project_name)
             
             logger.debug("📊 [ANALYTICS] Deploy pattern recorded", 
                         project=project_name, 
@@ -773,23 +2188,65 @@ class AnalyticsManager:
         📊 PHASE 2: Calculate deploy frequency score based on recent activity
         """
         try:
-            # Get recent deploy patterns (last 7 days)
-            patterns = await self._get_recent_deploy_patterns(project_name, days=7)
-            
-            if not patterns:
+            # Count from the in-memory rolling index - no file reads on the
+            # deploy-detection path
+            index = await self._get_pattern_index(project_name)
+            deploy_count = len(index)
+            if deploy_count == 0:
                 return 0.0
-            
-            # Calculate deploys per day
-            deploy_count = len(patterns)
-            frequency_score = min(10.0, deploy_count / 7.0)  # Max score of 10
-            
+
+            frequency_score = min(10.0, deploy_count / float(self.pattern_index_window_days))
             return frequency_score
-            
+
         except Exception as e:
-            logger.error("❌ [ANALYTICS] Failed to calculate deploy frequency", 
+            logger.error("❌ [ANALYTICS] Failed to calculate deploy frequency",
                         project=project_name, error=str(e))
             return 0.0
-    
+
+    async def _get_pattern_index(self, project_name: str) -> deque:
+        """Get the rolling deploy-timestamp index, warming it from storage once"""
+        if project_name not in self._pattern_index_warmed:
+            self._pattern_index_warmed.add(project_name)
+            try:
+                patterns = await self._get_recent_deploy_patterns(
+                    project_name, days=self.pattern_index_window_days)
+                index = self._pattern_index.setdefault(project_name, deque())
+                for pattern in patterns:
+                    timestamp = datetime.fromisoformat(
+                        pattern["deploy_timestamp"].replace('Z', '+00:00'))
+                    index.append(timestamp.replace(tzinfo=None))
+                logger.debug("🔥 [ANALYTICS] Warmed deploy pattern index",
+                            project=project_name, deploys=len(index))
+            except Exception as e:
+                logger.error("❌ [ANALYTICS] Failed to warm pattern index",
+                            project=project_name, error=str(e))
+
+        index = self._pattern_index.setdefault(project_name, deque())
+        self._prune_pattern_index(index)
+        return index
+
+    async def _index_deploy_timestamp(self, project_name: str, timestamp: datetime):
+        """Record one deploy timestamp in the rolling index"""
+        index = await self._get_pattern_index(project_name)
+        index.append(timestamp)
+
+    def _prune_pattern_index(self, index: deque):
+        """Drop index entries older than the rolling window"""
+        cutoff = datetime.now() - timedelta(days=self.pattern_index_window_days)
+        while index and index[0] < cutoff:
+            index.popleft()
+
+    def get_deploy_hour_buckets(self, project_name: str) -> Dict[int, int]:
+        """Hour-of-day histogram of deploys in the rolling window (index only)"""
+        index = self._pattern_index.get(project_name)
+        if not index:
+            return {}
+        self._prune_pattern_index(index)
+        buckets: Dict[int, int] = {}
+        for timestamp in index:
+            buckets[timestamp.hour] = buckets.get(timestamp.hour, 0) + 1
+        return buckets
+
     def _calculate_session_productivity_score(self, session: DeploySession) -> float:
         """
         📊 PHASE 2: Calculate productivity score for a completed session
@@ -832,37 +2289,45 @@ class AnalyticsManager:
             analytics_dir = self._get_analytics_dir(session.project_name)
             month_key = self._get_current_month_key()
             sessions_file = analytics_dir / f"sessions_{month_key}.json"
-            
-            # Load existing data or create new
-            if sessions_file.exists():
-                with open(sessions_file, 'r') as f:
-                    data = json.load(f)
-            else:
-                data = {"month": month_key, "deploy_sessions": []}
-            
-            # Add new session
-            data["deploy_sessions"].append({
-                "session_id": session.session_id,
-                "project_name": session.project_name,
-                "deploy_command": session.deploy_command,
-                "session_start": session.session_start,
-                "session_end": session.session_end,
-                "timer_duration_seconds": session.timer_duration_seconds,
-                "cloud_propagation_time_seconds": session.cloud_propagation_time_seconds,
-                "tasks_suggested": session.tasks_suggested,
-                "tasks_accepted": session.tasks_accepted,
-                "switch_button_pressed": session.switch_button_pressed,
-                "switch_timestamp": session.switch_timestamp,
-                "estimated_time_saved_seconds": session.estimated_time_saved_seconds,
-                "session_status": session.session_status,
-                "productivity_score": session.productivity_score
-            })
-            
-            # Save back to file
-            with open(sessions_file, 'w') as f:
-                json.dump(data, f, indent=2)
-            
-            logger.debug("💾 [ANALYTICS] Session saved to file", 
+
+            session_record = session.to_record()
+
+            def bump(month: Dict[str, Any]):
+                sessions = month["sessions"]
+                sessions["count"] += 1
+                sessions["time_saved_seconds"] += session.estimated_time_saved_seconds
+                if session.switch_button_pressed:
+                    sessions["switch_pressed"] += 1
+                if session.productivity_score:
+                    sessions["productivity_score_sum"] += session.productivity_score
+                    sessions["productivity_score_count"] += 1
+
+            def persist():
+                if self.use_sqlite:
+                    self._db_insert(session.project_name, "session",
+                                    session.session_start, session_record,
+                                    record_key=session.session_id,
+                                    time_saved_seconds=session.estimated_time_saved_seconds,
+                                    switch_pressed=session.switch_button_pressed)
+                else:
+                    # Load existing data or create new
+                    if sessions_file.exists():
+                        with open(sessions_file, 'r') as f:
+                            data = jsoncodec.load(f)
+                    else:
+                        data = {"month": month_key, "deploy_sessions": []}
+
+                    data["deploy_sessions"].append(session_record)
+
+                    # Save back to file
+                    with open(sessions_file, 'w') as f:
+                        jsoncodec.dump(data, f)
+
+                self._bump_aggregates(analytics_dir, bump)
+
+            self._queue_io(persist)
+
+            logger.debug("💾 [ANALYTICS] Session saved to file",
                         file=str(sessions_file),
                         session_id=session.session_id)
             
@@ -877,29 +2342,47 @@ class AnalyticsManager:
             analytics_dir = self._get_analytics_dir(pattern.project_name)
             month_key = self._get_current_month_key()
             patterns_file = analytics_dir / f"deploy_patterns_{month_key}.json"
-            
-            # Load existing data or create new
-            if patterns_file.exists():
-                with open(patterns_file, 'r') as f:
-                    data = json.load(f)
-            else:
-                data = {"month": month_key, "deploy_patterns": []}
-            
-            # Add new pattern
-            data["deploy_patterns"].append({
-                "project_name": pattern.project_name,
-                "deploy_command": pattern.deploy_command,
-                "deploy_timestamp": pattern.deploy_timestamp,
-                "time_of_day": pattern.time_of_day,
-                "day_of_week": pattern.day_of_week,
-                "deploy_frequency_score": pattern.deploy_frequency_score
-            })
-            
-            # Save back to file
-            with open(patterns_file, 'w') as f:
-                json.dump(data, f, indent=2)
-            
-            logger.debug("💾 [ANALYTICS] Deploy pattern saved to file", 
+
+            pattern_record = pattern.to_record()
+
+            def bump(month: Dict[str, Any]):
+                deploys = month["deploys"]
+                deploys["count"] += 1
+                deploys["commands"][pattern.deploy_command] = \
+                    deploys["commands"].get(pattern.deploy_command, 0) + 1
+                deploys["time_of_day"][pattern.time_of_day] = \
+                    deploys["time_of_day"].get(pattern.time_of_day, 0) + 1
+                # Running temporal histograms, bucketed at write time so the
+                # summary never parses timestamps (setdefault covers aggregate
+                # files written before these existed)
+                hours = deploys.setdefault("hours", {})
+                hours[str(pattern.hour)] = hours.get(str(pattern.hour), 0) + 1
+                days = deploys.setdefault("days", {})
+                days[pattern.day_of_week] = days.get(pattern.day_of_week, 0) + 1
+
+            def persist():
+                if self.use_sqlite:
+                    self._db_insert(pattern.project_name, "pattern",
+                                    pattern.deploy_timestamp, pattern_record)
+                else:
+                    # Load existing data or create new
+                    if patterns_file.exists():
+                        with open(patterns_file, 'r') as f:
+                            data = jsoncodec.load(f)
+                    else:
+                        data = {"month": month_key, "deploy_patterns": []}
+
+                    data["deploy_patterns"].append(pattern_record)
+
+                    # Save back to file
+                    with open(patterns_file, 'w') as f:
+                        jsoncodec.dump(data, f)
+
+                self._bump_aggregates(analytics_dir, bump)
+
+            self._queue_io(persist)
+
+            logger.debug("💾 [ANALYTICS] Deploy pattern saved to file",
                         file=str(patterns_file),
                         project=pattern.project_name)
             
@@ -916,37 +2399,26 @@ class AnalyticsManager:
         """
         try:
             analytics_dir = self._get_analytics_dir(project_name)
-            
+
             # Calculate date range
             end_date = datetime.now()
             start_date = end_date - timedelta(days=days)
-            
+
+            if self.use_sqlite:
+                return self._db_query_records(project_name, "pattern", start_date)
+
             patterns = []
-            
-            # Load data from multiple months if needed
-            current_month = end_date.replace(day=1)
-            while current_month >= start_date.replace(day=1):
-                month_key = current_month.strftime("%Y-%m")
-                patterns_file = analytics_dir / f"deploy_patterns_{month_key}.json"
-                
-                if patterns_file.exists():
-                    with open(patterns_file, 'r') as f:
-                        month_data = json.load(f)
-                        month_patterns = month_data.get("deploy_patterns", [])
-                        
-                        # Filter by date range
-                        for pattern in month_patterns:
-                            pattern_date = datetime.fromisoformat(pattern["deploy_timestamp"].replace('Z', '+00:00'))
-                            if start_date <= pattern_date <= end_date:
-                                patterns.append(pattern)
-                
-                # Move to previous month
-                if current_month.month == 1:
-                    current_month = current_month.replace(year=current_month.year - 1, month=12)
-                else:
-                    current_month = current_month.replace(month=current_month.month - 1)
-            
-            logger.debug("📊 [ANALYTICS] Retrieved recent deploy patterns", 
+
+            # Same month-key partition pruning and scan-time range trimming
+            # as _get_recent_deploy_sessions
+            start_iso = start_date.isoformat()
+            for month_key in self._month_keys_in_window(days):
+                for pattern in self._load_month_records(
+                        analytics_dir, "deploy_patterns", "deploy_patterns", month_key):
+                    if pattern.get("deploy_timestamp", "") >= start_iso:
+                        patterns.append(pattern)
+
+            logger.debug("📊 [ANALYTICS] Retrieved recent deploy patterns",
                         project=project_name, 
                         patterns_count=len(patterns),
                         days=days)
@@ -966,75 +2438,37 @@ class AnalyticsManager:
                     project=project_name, days=last_n_days)
         
         try:
+            # Serve from running aggregates when available (dictionary lookups
+            # instead of re-reading every monthly file)
+            analytics_dir = self._get_analytics_dir(project_name)
+            summary = self._deploy_summary_from_aggregates(project_name, analytics_dir, last_n_days)
+            if summary is not None:
+                logger.debug("✅ [ANALYTICS] Deploy summary served from aggregates",
+                            project=project_name)
+                return summary
+
             # Get recent sessions
             sessions = await self._get_recent_deploy_sessions(project_name, last_n_days)
             
             # Get recent deploy patterns
             patterns = await self._get_recent_deploy_patterns(project_name, last_n_days)
-            
-            # Calculate metrics
-            total_sessions = len(sessions)
-            total_deploys = len(patterns)
-            
-            # Time saved metrics
-            total_time_saved = sum(s.get("estimated_time_saved_seconds", 0) for s in sessions)
-            sessions_with_switch = len([s for s in sessions if s.get("switch_button_pressed", False)])
-            switch_rate = (sessions_with_switch / total_sessions) if total_sessions > 0 else 0.0
-            
-            # Deploy frequency metrics
-            if patterns:
-                # Most common deploy commands
-                command_counts = {}
-                for pattern in patterns:
-                    cmd = pattern["deploy_command"]
-                    command_counts[cmd] = command_counts.get(cmd, 0) + 1
-                
-                most_common_commands = sorted(command_counts.items(), key=lambda x: x[1], reverse=True)[:5]
-                
-                # Time of day analysis
-                time_of_day_counts = {}
-                for pattern in patterns:
-                    tod = pattern["time_of_day"]
-                    time_of_day_counts[tod] = time_of_day_counts.get(tod, 0) + 1
-                
-                # Calculate average frequency
-                avg_deploys_per_day = total_deploys / last_n_days
-            else:
-                most_common_commands = []
-                time_of_day_counts = {}
-                avg_deploys_per_day = 0.0
-            
-            # Productivity scores
-            productivity_scores = [s.get("productivity_score", 0) for s in sessions if s.get("productivity_score")]
-            avg_productivity_score = sum(productivity_scores) / len(productivity_scores) if productivity_scores else 0.0
-            
-            summary = {
-                "project_name": project_name,
-                "analysis_period_days": last_n_days,
-                "timestamp": datetime.now().isoformat(),
-                
-                # Session metrics
-                "total_sessions": total_sessions,
-                "total_time_saved_minutes": total_time_saved / 60,
-                "switch_button_usage_rate": switch_rate,
-                "avg_productivity_score": avg_productivity_score,
-                
-                # Deploy pattern metrics
-                "total_deploys": total_deploys,
-                "avg_deploys_per_day": avg_deploys_per_day,
-                "most_common_commands": most_common_commands,
-                "deploy_time_patterns": time_of_day_counts,
-                
-                # Efficiency metrics
-                "avg_time_saved_per_session_minutes": (total_time_saved / total_sessions / 60) if total_sessions > 0 else 0.0,
-                "productivity_improvement_rate": switch_rate * 100  # Percentage of sessions where user engaged
-            }
-            
-            logger.info("✅ [ANALYTICS] Deploy analytics summary generated", 
+
+            # Summarize, offloading big ranges to the worker pool so a
+            # year-long query never adds jitter to deploy detection
+            summary = await self._offload_aggregation(
+                _build_deploy_summary,
+                project_name,
+                sessions,
+                patterns,
+                last_n_days,
+                record_count=len(sessions) + len(patterns)
+            )
+
+            logger.info("✅ [ANALYTICS] Deploy analytics summary generated",
                        project=project_name,
-                       total_sessions=total_sessions,
-                       total_deploys=total_deploys,
-                       switch_rate=f"{switch_rate:.1%}")
+                       total_sessions=summary["total_sessions"],
+                       total_deploys=summary["total_deploys"],
+                       switch_rate=f"{summary['switch_button_usage_rate']:.1%}")
             
             return summary
             
@@ -1054,37 +2488,28 @@ class AnalyticsManager:
         """
         try:
             analytics_dir = self._get_analytics_dir(project_name)
-            
+
             # Calculate date range
             end_date = datetime.now()
             start_date = end_date - timedelta(days=days)
-            
+
+            if self.use_sqlite:
+                return self._db_query_records(project_name, "session", start_date)
+
             sessions = []
-            
-            # Load data from multiple months if needed
-            current_month = end_date.replace(day=1)
-            while current_month >= start_date.replace(day=1):
-                month_key = current_month.strftime("%Y-%m")
-                sessions_file = analytics_dir / f"sessions_{month_key}.json"
-                
-                if sessions_file.exists():
-                    with open(sessions_file, 'r') as f:
-                        month_data = json.load(f)
-                        month_sessions = month_data.get("deploy_sessions", [])
-                        
-                        # Filter by date range
-                        for session in month_sessions:
-                            session_date = datetime.fromisoformat(session["session_start"].replace('Z', '+00:00'))
-                            if start_date <= session_date <= end_date:
-                                sessions.append(session)
-                
-                # Move to previous month
-                if current_month.month == 1:
-                    current_month = current_month.replace(year=current_month.year - 1, month=12)
-                else:
-                    current_month = current_month.replace(month=current_month.month - 1)
-            
-            logger.debug("📊 [ANALYTICS] Retrieved recent deploy sessions", 
+
+            # Month keys prune partitions before any I/O; going through
+            # _load_month_records also picks up JSONL and gzip segments,
+            # which the old per-file loop missed. Range trimming is a
+            # lexicographic ISO compare instead of a parse per record.
+            start_iso = start_date.isoformat()
+            for month_key in self._month_keys_in_window(days):
+                for session in self._load_month_records(
+                        analytics_dir, "sessions", "deploy_sessions", month_key):
+                    if session.get("session_start", "") >= start_iso:
+                        sessions.append(session)
+
+            logger.debug("📊 [ANALYTICS] Retrieved recent deploy sessions",
                         project=project_name, 
                         sessions_count=len(sessions),
                         days=days)
@@ -1096,14 +2521,173 @@ class AnalyticsManager:
                         project=project_name, error=str(e))
             return []
     
+    # PAGINATED HISTORY AND CHART SERIES
+
+    # record type -> (file prefix, legacy key, sqlite type, timestamp field)
+    PAGE_SOURCES = {
+        "suggestions": ("suggestions", "suggestions", "suggestion", "suggestion_timestamp"),
+        "interactions": ("interactions", "interactions", "interaction", "interaction_timestamp"),
+        "sessions": ("sessions", "deploy_sessions", "session", "session_start"),
+        "patterns": ("deploy_patterns", "deploy_patterns", "pattern", "deploy_timestamp"),
+    }
+
+    async def get_analytics_page(self, project_name: str, record_type: str = "sessions",
+                               cursor: Optional[str] = None,
+                               page_size: int = 50) -> Dict[str, Any]:
+        """
+        Cursor-paginated history, newest first.
+
+        The cursor is the timestamp of the last record on the previous page;
+        months are read newest-first and reading stops once the page fills,
+        so a year of history never gets loaded for one page.
+        """
+        source = self.PAGE_SOURCES.get(record_type)
+        if source is None:
+            return {"success": False, "message": f"Unknown record type: {record_type}"}
+
+        prefix, legacy_key, sqlite_type, ts_field = source
+        page_size = max(1, min(page_size, 200))
+
+        try:
+            page: List[Dict[str, Any]] = []
+
+            if self.use_sqlite:
+                db = self._get_db()
+                query = ("SELECT data FROM records WHERE project_name = ? AND record_type = ? "
+                         "{cursor_clause} ORDER BY timestamp DESC LIMIT ?")
+                params: List[Any] = [project_name, sqlite_type]
+                if cursor:
+                    query = query.format(cursor_clause="AND timestamp < ?")
+                    params.append(cursor)
+                else:
+                    query = query.format(cursor_clause="")
+                params.append(page_size + 1)
+                with self._db_lock:
+                    rows = db.execute(query, params).fetchall()
+                page = [jsoncodec.loads(row[0]) for row in rows]
+            else:
+                analytics_dir = self._get_analytics_dir(project_name)
+                # Walk up to two years of months, newest first, stopping as
+                # soon as the page (plus one lookahead record) is full
+                for month_key in self._month_keys_in_window(730):
+                    if len(page) > page_size:
+                        break
+                    records = self._load_month_records(analytics_dir, prefix, legacy_key, month_key)
+                    records.sort(key=lambda r: r.get(ts_field, ""), reverse=True)
+                    for record in records:
+                        timestamp = record.get(ts_field, "")
+                        if cursor and timestamp >= cursor:
+                            continue
+                        page.append(record)
+                        if len(page) > page_size:
+                            break
+
+            has_more = len(page) > page_size
+            page = page[:page_size]
+            next_cursor = page[-1].get(ts_field) if (page and has_more) else None
+
+            return {
+                "success": True,
+                "project_name": project_name,
+                "record_type": record_type,
+                "records": page,
+                "next_cursor": next_cursor,
+                "has_more": has_more
+            }
+
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Failed to get analytics page",
+                        project=project_name, record_type=record_type, error=str(e))
+            return {"success": False, "error": str(e), "message": "Failed to get analytics page"}
+
+    async def get_chart_series(self, project_name: str, metric: str = "time_saved",
+                             last_n_days: int = 30, max_points: int = 60,
+                             packed: bool = False) -> Dict[str, Any]:
+        """
+        Downsampled time series for renderer charts.
+
+        Records are bucketed server-side so the response never exceeds
+        max_points regardless of how much history exists. With packed=True
+        the series comes back as parallel numeric arrays (bucket indices and
+        values plus a start epoch) instead of per-point objects, so the
+        Electron side can move it as contiguous typed arrays.
+        """
+        try:
+            end_date = datetime.now()
+            start_date = end_date - timedelta(days=last_n_days)
+            bucket_seconds = max(3600, (last_n_days * 86400) // max(1, max_points))
+
+            if metric == "deploys":
+                records = await self._get_recent_deploy_patterns(project_name, last_n_days)
+                ts_field, value_of = "deploy_timestamp", lambda r: 1
+            elif metric == "time_saved":
+                records = await self._get_recent_deploy_sessions(project_name, last_n_days)
+                ts_field, value_of = "session_start", \
+                    lambda r: r.get("estimated_time_saved_seconds", 0) / 60
+            elif metric == "sessions":
+                records = await self._get_recent_deploy_sessions(project_name, last_n_days)
+                ts_field, value_of = "session_start", lambda r: 1
+            else:
+                return {"success": False, "message": f"Unknown metric: {metric}"}
+
+            buckets: Dict[int, float] = {}
+            for record in records:
+                try:
+                    timestamp = datetime.fromisoformat(record[ts_field].replace('Z', '+00:00'))
+                    timestamp = timestamp.replace(tzinfo=None)
+                except (KeyError, ValueError):
+                    continue
+                if timestamp < start_date:
+                    continue
+                bucket = int((timestamp - start_date).total_seconds()) // bucket_seconds
+                buckets[bucket] = buckets.get(bucket, 0) + value_of(record)
+
+            if packed:
+                indices = sorted(buckets)
+                return {
+                    "success": True,
+                    "project_name": project_name,
+                    "metric": metric,
+                    "period_days": last_n_days,
+                    "bucket_seconds": bucket_seconds,
+                    "packed": {
+                        "start_epoch": start_date.timestamp(),
+                        "bucket_seconds": bucket_seconds,
+                        "bucket_indices": indices,
+                        "values": [round(buckets[index], 2) for index in indices],
+                    },
+                }
+
+            points = [
+                {
+                    "t": (start_date + timedelta(seconds=bucket * bucket_seconds)).isoformat(),
+                    "v": round(value, 2)
+                }
+                for bucket, value in sorted(buckets.items())
+            ]
+
+            return {
+                "success": True,
+                "project_name": project_name,
+                "metric": metric,
+                "period_days": last_n_days,
+                "bucket_seconds": bucket_seconds,
+                "points": points
+            }
+
+        except Exception as e:
+            logger.error("❌ [ANALYTICS] Failed to build chart series",
+                        project=project_name, metric=metric, error=str(e))
+            return {"success": False, "error": str(e), "message": "Failed to build chart series"}
+
     async def get_active_session_for_project(self, project_name: str) -> Optional[str]:
         """
         📊 PHASE 2: Get active session ID for a project (used for Switch tracking)
+
+        Served from the maintained project index - this is called per deploy
+        on the hot path, so it must stay a dictionary hit.
         """
-        for session_id, session in self.active_sessions.items():
-            if session.project_name == project_name and session.session_status == "active":
-                return session_id
-        return None
+        return self._project_active_sessions.get(project_name)
     
     async def update_session_task_counts(self, session_id: str, tasks_suggested: int = 0, tasks_accepted: int = 0) -> bool:
         """
@@ -1119,7 +2703,8 @@ class AnalyticsManager:
                 session.tasks_suggested += tasks_suggested
             if tasks_accepted > 0:
                 session.tasks_accepted += tasks_accepted
-            
+            self._snapshot_active_sessions()
+
             logger.debug("📊 [ANALYTICS] Session task counts updated", 
                         session_id=session_id,
                         suggested=session.tasks_suggested,
@@ -1135,14 +2720,183 @@ class AnalyticsManager:
     # 📊 PHASE 2: FRONTEND API METHODS
     # These methods provide the interface that the frontend analytics dashboard expects
     
+    # BACKGROUND OVERVIEW ROLLUP
+    # The overview used to walk every project's analytics directory on
+    # demand; with many projects that took seconds on the event loop. A
+    # background task now folds per-project deltas into a rollup document
+    # and the overview command reads that document instantly.
+
+    def _rollup_file(self) -> Path:
+        """Persisted rollup document - answers queries across restarts"""
+        return self.projects_root / "overview_rollup.json"
+
+    def mark_project_dirty(self, project_name: str):
+        """Queue a project for re-summarization on the next rollup pass"""
+        self._rollup_dirty.add(project_name)
+
+    async def start_overview_rollup(self):
+        """Start the background rollup task (idempotent)"""
+        if self._rollup_task is not None:
+            return
+
+        # The persisted document answers queries until the first pass lands
+        try:
+            if self._rollup_file().exists():
+                with open(self._rollup_file(), 'r') as f:
+                    self._overview_rollup = jsoncodec.load(f)
+        except Exception as e:
+            logger.warning("⚠️ [ANALYTICS] Rollup document unreadable, rebuilding",
+                         error=str(e))
+            self._overview_rollup = {}
+
+        # Everything is dirty on startup so stale entries get refreshed
+        if self.projects_root.exists():
+            for project_dir in self.projects_root.iterdir():
+                if project_dir.is_dir() and not project_dir.name.startswith('.'):
+                    self._rollup_dirty.add(project_dir.name.replace("_", " "))
+
+        self._rollup_task = task_supervisor.spawn(
+            "analytics_rollup_loop", self._rollup_loop)
+        logger.info("🧮 [ANALYTICS] Overview rollup task started",
+                   interval_seconds=self.rollup_interval)
+
+    async def stop_overview_rollup(self):
+        """Stop the background rollup task"""
+        if self._rollup_task is not None:
+            self._rollup_task.cancel()
+            try:
+                await self._rollup_task
+            except asyncio.CancelledError:
+                pass
+            self._rollup_task = None
+            logger.info("🧮 [ANALYTICS] Overview rollup task stopped")
+
+    async def _rollup_loop(self):
+        """Low-priority loop folding dirty projects into the rollup document"""
+        # Short first delay so startup isn't competing with the UI's
+        # initial queries
+        delay = 15.0
+        while True:
+            try:
+                await asyncio.sleep(delay)
+                delay = self.rollup_interval
+
+                # Low power pauses background aggregation entirely; dirty
+                # projects queue up and are folded on the next mains pass
+                from powerprofile import power_profile
+                if power_profile.low_power_active:
+                    continue
+
+                await self._fold_dirty_projects()
+            except asyncio.CancelledError:
+                raise
+            except Exception as e:
+                logger.error("❌ [ANALYTICS] Overview rollup pass failed", error=str(e))
+
+    async def _fold_dirty_projects(self):
+        """Re-summarize dirty projects and persist the updated rollup"""
+        if not self._rollup_dirty:
+            return
+
+        dirty = list(self._rollup_dirty)
+        self._rollup_dirty.clear()
+        per_project = self._overview_rollup.setdefault("per_project", {})
+
+        for project_name in dirty:
+            try:
+                deploy_data = await self.get_deploy_analytics_summary(
+                    project_name, self.rollup_period_days)
+                if deploy_data.get("total_sessions", 0) > 0:
+                    per_project[project_name] = {
+                        "sessions": deploy_data.get("total_sessions", 0),
+                        "time_saved_minutes": deploy_data.get("total_time_saved_minutes", 0),
+                        "switch_rate": deploy_data.get("switch_button_usage_rate", 0.0),
+                        "total_deploys": deploy_data.get("total_deploys", 0),
+                        "sessions_with_switch": deploy_data.get("sessions_with_switch", 0)
+                    }
+                else:
+                    per_project.pop(project_name, None)
+            except Exception as e:
+                logger.warning("⚠️ [ANALYTICS] Rollup failed for project",
+                             project=project_name, error=str(e))
+            # Yield between projects - this is strictly background work
+            await asyncio.sleep(0)
+
+        self._overview_rollup["period_days"] = self.rollup_period_days
+        self._overview_rollup["computed_at"] = datetime.now().isoformat()
+
+        rollup_file = self._rollup_file()
+        snapshot = dict(self._overview_rollup)
+
+        def persist():
+            tmp_file = rollup_file.with_suffix('.json.tmp')
+            with open(tmp_file, 'w') as f:
+                jsoncodec.dump(snapshot, f)
+            tmp_file.replace(rollup_file)
+
+        self._queue_io(persist)
+        logger.info("🧮 [ANALYTICS] Overview rollup updated", projects_folded=len(dirty))
+
+    def _overview_from_rollup(self, last_n_days: int) -> Dict[str, Any]:
+        """Build the overview response from the precomputed rollup document"""
+        per_project = self._overview_rollup.get("per_project", {})
+
+        total_time_saved_minutes = 0
+        total_sessions = 0
+        total_deploys = 0
+        switch_presses = 0
+        project_summaries = []
+
+        for project_name, summary in per_project.items():
+            project_summaries.append({
+                "project_name": project_name,
+                "sessions": summary.get("sessions", 0),
+                "time_saved_minutes": summary.get("time_saved_minutes", 0),
+                "switch_rate": summary.get("switch_rate", 0.0)
+            })
+            total_time_saved_minutes += summary.get("time_saved_minutes", 0)
+            total_sessions += summary.get("sessions", 0)
+            total_deploys += summary.get("total_deploys", 0)
+            switch_presses += summary.get("sessions_with_switch", 0)
+
+        project_summaries.sort(key=lambda p: p["time_saved_minutes"], reverse=True)
+
+        overall_switch_rate = (switch_presses / total_sessions) if total_sessions > 0 else 0.0
+        avg_time_saved_per_session = (total_time_saved_minutes / total_sessions) if total_sessions > 0 else 0.0
+
+        return {
+            "period_days": last_n_days,
+            "generated_at": self._overview_rollup.get("computed_at", datetime.now().isoformat()),
+            "total_time_saved_minutes": total_time_saved_minutes,
+            "total_sessions": total_sessions,
+            "total_deploys": total_deploys,
+            "total_projects": len(project_summaries),
+            "overall_switch_rate": overall_switch_rate,
+            "avg_time_saved_per_session_minutes": avg_time_saved_per_session,
+            "productivity_improvement_rate": overall_switch_rate * 100,
+            "project_summaries": project_summaries[:10],
+            "key_insights": self._generate_productivity_insights(
+                total_time_saved_minutes, total_sessions, overall_switch_rate
+            )
+        }
+
     async def get_productivity_overview(self, last_n_days: int = 30) -> Dict[str, Any]:
         """
         📊 PHASE 2: Get cross-project productivity overview
         Called by frontend analytics dashboard
         """
         logger.info("📊 [ANALYTICS] Getting productivity overview", days=last_n_days)
-        
+
         try:
+            if self.use_sqlite:
+                return self._overview_from_sqlite(last_n_days)
+
+            # Precomputed fast path: the background rollup already folded
+            # per-project summaries, so the default window is a dict walk
+            if (last_n_days == self.rollup_period_days
+                    and self._overview_rollup.get("per_project") is not None):
+                return self._overview_from_rollup(last_n_days)
+
             # Get all project directories
             projects = []
             if self.projects_root.exists():
@@ -1226,7 +2980,59 @@ class AnalyticsManager:
                 "key_insights": ["No data available for the selected period"]
             }
     
-    def _generate_productivity_insights(self, time_saved_minutes: float, 
+    def _overview_from_sqlite(self, last_n_days: int) -> Dict[str, Any]:
+        """Build the cross-project overview from two indexed GROUP BY queries"""
+        since = (datetime.now() - timedelta(days=last_n_days)).isoformat()
+        db = self._get_db()
+
+        with self._db_lock:
+            session_rows = db.execute(
+                "SELECT project_name, COUNT(*), SUM(time_saved_seconds), SUM(switch_pressed) "
+                "FROM records WHERE record_type = 'session' AND timestamp >= ? "
+                "GROUP BY project_name", (since,)).fetchall()
+
+            (total_deploys,) = db.execute(
+                "SELECT COUNT(*) FROM records WHERE record_type = 'pattern' AND timestamp >= ?",
+                (since,)).fetchone()
+
+        total_time_saved_minutes = 0.0
+        total_sessions = 0
+        switch_presses = 0
+        project_summaries = []
+
+        for project_name, sessions, time_saved_seconds, switches in session_rows:
+            time_saved_minutes = (time_saved_seconds or 0) / 60
+            project_summaries.append({
+                "project_name": project_name,
+                "sessions": sessions,
+                "time_saved_minutes": time_saved_minutes,
+                "switch_rate": (switches or 0) / sessions if sessions > 0 else 0.0
+            })
+            total_time_saved_minutes += time_saved_minutes
+            total_sessions += sessions
+            switch_presses += switches or 0
+
+        project_summaries.sort(key=lambda p: p["time_saved_minutes"], reverse=True)
+
+        overall_switch_rate = (switch_presses / total_sessions) if total_sessions > 0 else 0.0
+
+        return {
+            "period_days": last_n_days,
+            "generated_at": datetime.now().isoformat(),
+            "total_time_saved_minutes": total_time_saved_minutes,
+            "total_sessions": total_sessions,
+            "total_deploys": total_deploys,
+            "total_projects": len(project_summaries),
+            "overall_switch_rate": overall_switch_rate,
+            "avg_time_saved_per_session_minutes": (total_time_saved_minutes / total_sessions) if total_sessions > 0 else 0.0,
+            "productivity_improvement_rate": overall_switch_rate * 100,
+            "project_summaries": project_summaries[:10],
+            "key_insights": self._generate_productivity_insights(
+                total_time_saved_minutes, total_sessions, overall_switch_rate
+            )
+        }
+
+    def _generate_productivity_insights(self, time_saved_minutes: float,
                                       total_sessions: int, switch_rate: float) -> List[str]:
         """Generate key insights for productivity overview"""
         insights = []
@@ -1275,24 +3081,24 @@ class AnalyticsManager:
         logger.info("📊 [ANALYTICS] Getting session status", project=project_name)
         
         try:
-            # Find active session for the project
+            # Find active session for the project via the maintained index
             active_session = None
-            for session_id, session in self.active_sessions.items():
-                if session.project_name == project_name and session.session_status == "active":
-                    active_session = {
-                        "session_id": session_id,
-                        "project_name": session.project_name,
-                        "deploy_command": session.deploy_command,
-                        "session_start": session.session_start,
-                        "timer_duration_seconds": session.timer_duration_seconds,
-                        "cloud_propagation_time_seconds": session.cloud_propagation_time_seconds,
-                        "tasks_suggested": session.tasks_suggested,
-                        "tasks_accepted": session.tasks_accepted,
-                        "switch_button_pressed": session.switch_button_pressed,
-                        "switch_timestamp": session.switch_timestamp,
-                        "session_status": session.session_status
-                    }
-                    break
+            session_id = self._project_active_sessions.get(project_name)
+            session = self.active_sessions.get(session_id) if session_id else None
+            if session is not None:
+                active_session = {
+                    "session_id": session_id,
+                    "project_name": session.project_name,
+                    "deploy_command": session.deploy_command,
+                    "session_start": session.session_start,
+                    "timer_duration_seconds": session.timer_duration_seconds,
+                    "cloud_propagation_time_seconds": session.cloud_propagation_time_seconds,
+                    "tasks_suggested": session.tasks_suggested,
+                    "tasks_accepted": session.tasks_accepted,
+                    "switch_button_pressed": session.switch_button_pressed,
+                    "switch_timestamp": session.switch_timestamp,
+                    "session_status": session.session_status
+                }
             
             # Get recent completed sessions for context
             recent_sessions = await self._get_recent_deploy_sessions(project_name, days=7)
@@ -22,21 +22,42 @@ class DeployWrapperManager:
     def __init__(self):
         self.wrapper_dir = Path.home() / ".deploybot"
         self.wrapper_script = self.wrapper_dir / "deploybot-wrapper.py"
+        self.shell_function_script = self.wrapper_dir / "deploybot-wrapper.sh"
         self.shell_config_files = [
             Path.home() / ".zshrc",
-            Path.home() / ".bashrc", 
+            Path.home() / ".bashrc",
             Path.home() / ".bash_profile"
         ]
-        
-        logger.info("🔧 [DEPLOY_WRAPPER] DeployWrapperManager initialized", 
+
+        # Alias scan result cached against rc-file mtimes - the settings UI
+        # polls installation status, and re-reading shell configs on every
+        # poll is wasted I/O unless the user actually edited them
+        self._alias_scan_cache = None  # (fingerprint, alias_configured)
+
+        # Python availability is a subprocess spawn per check; PATH doesn't
+        # change mid-session, so probe once and reuse
+        self._python_available = None
+
+        logger.info("🔧 [DEPLOY_WRAPPER] DeployWrapperManager initialized",
                    wrapper_dir=str(self.wrapper_dir))
 
+    def _shell_config_fingerprint(self):
+        """Mtime fingerprint of the shell rc files the alias scan reads"""
+        fingerprint = []
+        for config_file in self.shell_config_files:
+            try:
+                fingerprint.append(config_file.stat().st_mtime_ns)
+            except OSError:
+                fingerprint.append(None)
+        return tuple(fingerprint)
+
     async def check_installation_status(self) -> Dict[str, Any]:
         """Check the current installation status of deploy wrapper"""
         logger.info("🔍 [DEPLOY_WRAPPER] Checking installation status...")
         
         status = {
             "wrapper_script_exists": self.wrapper_script.exists(),
+            "shell_function_exists": self.shell_function_script.exists(),
             "wrapper_script_executable": False,
             "alias_configured": False,
             "shell_detected": self.detect_shell(),
@@ -70,7 +91,14 @@ class DeployWrapperManager:
         return shell_name
 
     def check_python_available(self) -> bool:
-        """Check if Python 3 is available"""
+        """Check if Python 3 is available (probed once per session)"""
+        if self._python_available is not None:
+            return self._python_available
+        self._python_available = self._probe_python_available()
+        return self._python_available
+
+    def _probe_python_available(self) -> bool:
+        """Spawn python3 to verify it's actually on PATH"""
         try:
             result = subprocess.run(['python3', '--version'], 
                                   capture_output=True, text=True, timeout=5)
@@ -83,23 +111,34 @@ class DeployWrapperManager:
             return False
 
     async def check_alias_exists(self) -> bool:
-        """Check if deploybot alias exists in shell config"""
+        """Check if deploybot alias exists in shell config (mtime-cached)"""
+        fingerprint = self._shell_config_fingerprint()
+        if self._alias_scan_cache and self._alias_scan_cache[0] == fingerprint:
+            logger.debug("🔍 [DEPLOY_WRAPPER] Alias check served from cache",
+                        alias_configured=self._alias_scan_cache[1])
+            return self._alias_scan_cache[1]
+
         logger.info("🔍 [DEPLOY_WRAPPER] Checking for existing alias...")
-        
+
+        alias_configured = False
         for config_file in self.shell_config_files:
             if config_file.exists():
                 try:
                     content = config_file.read_text()
                     if 'alias deploybot=' in content:
-                        logger.info("✅ [DEPLOY_WRAPPER] Found existing alias", 
+                        logger.info("✅ [DEPLOY_WRAPPER] Found existing alias",
                                    config_file=str(config_file))
-                        return True
+                        alias_configured = True
+                        break
                 except Exception as e:
-                    logger.warning("⚠️ [DEPLOY_WRAPPER] Error reading config file", 
+                    logger.warning("⚠️ [DEPLOY_WRAPPER] Error reading config file",
                                  config_file=str(config_file), error=str(e))
-        
-        logger.info("❌ [DEPLOY_WRAPPER] No existing alias found")
-        return False
+
+        if not alias_configured:
+            logger.info("❌ [DEPLOY_WRAPPER] No existing alias found")
+
+        self._alias_scan_cache = (fingerprint, alias_configured)
+        return alias_configured
 
     async def install_wrapper(self, project_name: Optional[str] = None) -> Dict[str, Any]:
         """Install the deploy wrapper script and configure shell alias"""
@@ -113,10 +152,13 @@ class DeployWrapperManager:
             
             # Create the wrapper script with per-project logging
             await self.create_wrapper_script()
-            
+
             # Make script executable
             self.wrapper_script.chmod(self.wrapper_script.stat().st_mode | stat.S_IEXEC)
             logger.info("🔧 [DEPLOY_WRAPPER] Made wrapper script executable")
+
+            # Create the zero-fork shell-function fast path alongside it
+            await self.create_shell_function_script()
             
             # Add shell alias
             await self.add_shell_alias()
@@ -160,44 +202,122 @@ This script acts as a proxy for deployment commands, logging them for
 DeployBot to detect while passing commands through unchanged.
 """
 
+import atexit
+import json
 import sys
 import subprocess
 import time
 import os
+import hashlib
+import urllib.parse
 from pathlib import Path
 
+OWNED_PIDS_REGISTRY = Path.home() / ".deploybot" / "owned_pids.json"
+
+def register_wrapper_pid():
+    """
+    Record this wrapper in DeployBot's owned-PID registry so cleanup can
+    verify and terminate exactly our processes instead of sweeping by
+    name pattern.
+    """
+    try:
+        OWNED_PIDS_REGISTRY.parent.mkdir(parents=True, exist_ok=True)
+        try:
+            entries = json.loads(OWNED_PIDS_REGISTRY.read_text())
+        except (OSError, ValueError):
+            entries = []
+        entries = [e for e in entries if e.get("pid") != os.getpid()]
+        entries.append({
+            "pid": os.getpid(),
+            "role": "deploy-wrapper",
+            "token": os.environ.get("DEPLOYBOT_LAUNCH_TOKEN", ""),
+            "command": sys.argv[0],
+            "started_at": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        })
+        OWNED_PIDS_REGISTRY.write_text(json.dumps(entries, indent=2))
+    except OSError:
+        pass
+
+def unregister_wrapper_pid():
+    """Drop this wrapper's registry entry on exit (best effort)"""
+    try:
+        entries = json.loads(OWNED_PIDS_REGISTRY.read_text())
+        remaining = [e for e in entries if e.get("pid") != os.getpid()]
+        if len(remaining) != len(entries):
+            OWNED_PIDS_REGISTRY.write_text(json.dumps(remaining, indent=2))
+    except (OSError, ValueError):
+        pass
+
 def get_deploy_log_path():
-    """Determine the appropriate deploy log path based on project context"""
+    """
+    Determine the deploy log path and project name from the current directory.
+
+    Returns (deploy_log, project_name) where project_name is "-" when no
+    DeployBot project structure is found and the global log is used.
+    """
     cwd = Path.cwd()
-    
+
     # Look for DeployBot project structure in current directory and parent directories
     potential_project_dirs = [
         cwd,
         cwd.parent,
         cwd.parent.parent
     ]
-    
+
     for proj_dir in potential_project_dirs:
         config_file = proj_dir / "config.json"
         todo_file = proj_dir / "TODO.md"
-        
+
         # Check if this looks like a DeployBot project
         if config_file.exists() and todo_file.exists():
             # Ensure logs directory exists
             logs_dir = proj_dir / "logs"
             logs_dir.mkdir(exist_ok=True)
-            
+
             deploy_log = logs_dir / "deploy_log.txt"
             print(f"📁 [DEPLOY_WRAPPER] Using project-specific log: {deploy_log}", file=sys.stderr)
-            return deploy_log
-    
-    # Fallback to global log if no project detected
-    global_log_dir = Path.home() / ".deploybot"
-    global_log_dir.mkdir(exist_ok=True)
-    global_log = global_log_dir / "deploy_log.txt"
-    
-    print(f"🌐 [DEPLOY_WRAPPER] Using global log: {global_log}", file=sys.stderr)
-    return global_log
+            return deploy_log, proj_dir.name
+
+    # Fallback: per-directory shard under the global shard directory, so one
+    # noisy directory can't grow a single shared log for everyone
+    shard_dir = Path.home() / ".deploybot" / "deploy_logs"
+    shard_dir.mkdir(parents=True, exist_ok=True)
+
+    digest = hashlib.sha1(str(cwd).encode("utf-8")).hexdigest()[:8]
+    safe_name = "".join(c if c.isalnum() or c in "-_" else "_" for c in cwd.name) or "root"
+    shard_log = shard_dir / f"{safe_name}-{digest}.txt"
+
+    print(f"🌐 [DEPLOY_WRAPPER] Using shard log: {shard_log}", file=sys.stderr)
+    return shard_log, "-"
+
+def format_event(timestamp, project_name, command_string, phase, exit_code, cwd):
+    """
+    Build a versioned structured event line (format DBEV1).
+
+    Eight space-separated fields - version, timestamp, project, command
+    hash, phase, exit code, command, cwd - with the free-text command and
+    cwd percent-encoded, so the backend parses a line with a single split
+    and no regex. Exit code is "-" for deploy starts.
+    """
+    command_hash = hashlib.sha1(command_string.encode("utf-8")).hexdigest()[:12]
+    quoted_command = urllib.parse.quote(command_string, safe="")
+    quoted_cwd = urllib.parse.quote(cwd, safe="")
+    return (f"DBEV1 {timestamp} {project_name} {command_hash} "
+            f"{phase} {exit_code} {quoted_command} {quoted_cwd}\\n")
+
+def notify_deploybot(event_line):
+    """Best-effort fast-path notification via the DeployBot event FIFO"""
+    fifo_path = Path.home() / ".deploybot" / "deploy_events.fifo"
+    try:
+        fd = os.open(str(fifo_path), os.O_WRONLY | os.O_NONBLOCK)
+        try:
+            os.write(fd, event_line.encode("utf-8"))
+        finally:
+            os.close(fd)
+    except OSError:
+        # No backend listening or FIFO missing - the log file remains the
+        # durable record and the backend's log monitoring still detects us
+        pass
 
 def main():
     """Main wrapper function that logs and executes deployment commands"""
@@ -206,24 +326,33 @@ def main():
     if not args:
         print("❌ [DEPLOY_WRAPPER] No command provided", file=sys.stderr)
         sys.exit(1)
-    
+
+    # Register in the owned-PID registry for the lifetime of the deploy
+    register_wrapper_pid()
+    atexit.register(unregister_wrapper_pid)
+
     timestamp = time.time()
     command_string = " ".join(args)
     cwd = os.getcwd()
-    
+
     # Get the appropriate log file
-    deploy_log = get_deploy_log_path()
-    
+    deploy_log, project_name = get_deploy_log_path()
+
+    start_event = format_event(timestamp, project_name, command_string, "start", "-", cwd)
+
     try:
         # Log the deployment command
         with open(deploy_log, "a") as f:
-            f.write(f"{timestamp} DEPLOY: {command_string} [CWD: {cwd}]\\n")
-        
+            f.write(start_event)
+
         print(f"📝 [DEPLOY_WRAPPER] Logged deployment: {command_string}", file=sys.stderr)
-        
+
     except Exception as e:
         print(f"⚠️ [DEPLOY_WRAPPER] Failed to log deployment: {e}", file=sys.stderr)
         # Continue with execution even if logging fails
+
+    # Fast path: hand the same event line to the backend immediately
+    notify_deploybot(start_event)
     
     try:
         # Execute the original command unchanged
@@ -231,11 +360,15 @@ def main():
         result = subprocess.run(args)
         
         # Log completion
+        complete_event = format_event(time.time(), project_name, command_string,
+                                      "complete", result.returncode, cwd)
         try:
             with open(deploy_log, "a") as f:
-                f.write(f"{time.time()} DEPLOY_COMPLETE: {command_string} [EXIT_CODE: {result.returncode}]\\n")
+                f.write(complete_event)
         except Exception as e:
             print(f"⚠️ [DEPLOY_WRAPPER] Failed to log completion: {e}", file=sys.stderr)
+
+        notify_deploybot(complete_event)
         
         sys.exit(result.returncode)
         
@@ -255,6 +388,114 @@ if __name__ == "__main__":
         logger.info("✅ [DEPLOY_WRAPPER] Wrapper script created", 
                    path=str(self.wrapper_script))
 
+    async def create_shell_function_script(self):
+        """
+        Create the zero-fork shell-function variant of the wrapper.
+
+        The Python wrapper adds an interpreter launch plus a subprocess fork
+        to every wrapped deploy command, right when the user is waiting on
+        their deploy. This sourceable script defines deploybot() as a pure
+        shell function: the structured DBEV1 start/complete lines are built
+        and appended with shell builtins only (printf -v, substring loops,
+        append redirection), so wrapping costs well under a millisecond and
+        the deploy command runs directly in the foreground with no extra
+        process between it and the shell. The backend's native log watcher
+        picks the appended line up immediately; the FIFO fast path and the
+        owned-PID registry only apply to the Python wrapper, which stays the
+        fallback for shells without EPOCHREALTIME and for directories outside
+        any DeployBot project (where shard-log naming needs hashing).
+        """
+        logger.info("📝 [DEPLOY_WRAPPER] Creating shell function fast path...")
+
+        shell_function_content = '''# DeployBot zero-fork deploy wrapper (sourced from the shell rc file).
+#
+# Defines deploybot() as a pure shell function so wrapping a deploy command
+# adds no interpreter launch and no extra fork. Requires builtin
+# EPOCHREALTIME (zsh with zsh/datetime, or bash 5+); anything else falls
+# back to the Python wrapper, which remains the reference implementation.
+
+if [ -n "$ZSH_VERSION" ]; then
+    zmodload zsh/datetime 2>/dev/null
+fi
+
+if [ -z "$EPOCHREALTIME" ]; then
+    deploybot() { python3 "$HOME/.deploybot/deploybot-wrapper.py" "$@"; }
+else
+
+# Percent-encode $1 into _DB_QUOTED using builtins only (RFC 3986
+# unreserved set, matching urllib.parse.quote with safe=""). Multibyte
+# characters encode by codepoint rather than UTF-8 bytes; deploy commands
+# are effectively always ASCII, and the backend tolerates both.
+_deploybot_quote() {
+    local s="$1" out="" ch hex i
+    for (( i = 0; i < ${#s}; i++ )); do
+        ch="${s:$i:1}"
+        case "$ch" in
+            [a-zA-Z0-9.~_-]) out+="$ch" ;;
+            *) printf -v hex '%%%02X' "'$ch"; out+="$hex" ;;
+        esac
+    done
+    _DB_QUOTED="$out"
+}
+
+# Locate the enclosing DeployBot project (config.json + TODO.md in the
+# current directory or up to two parents), mirroring the Python wrapper's
+# search. Sets _DB_LOG and _DB_PROJECT; fails outside any project.
+_deploybot_log_path() {
+    local dir="$PWD" i
+    for i in 1 2 3; do
+        if [ -f "$dir/config.json" ] && [ -f "$dir/TODO.md" ]; then
+            [ -d "$dir/logs" ] || mkdir -p "$dir/logs"
+            _DB_LOG="$dir/logs/deploy_log.txt"
+            _DB_PROJECT="${dir##*/}"
+            return 0
+        fi
+        dir="${dir%/*}"
+        [ -n "$dir" ] || return 1
+    done
+    return 1
+}
+
+deploybot() {
+    if [ $# -eq 0 ]; then
+        echo "❌ [DEPLOY_WRAPPER] No command provided" >&2
+        return 1
+    fi
+
+    local _DB_LOG="" _DB_PROJECT="" _DB_QUOTED="" _db_qcmd _db_qcwd _db_rc
+    if ! _deploybot_log_path; then
+        # Outside a project the per-directory shard log needs hashing -
+        # hand off to the Python wrapper rather than approximating it
+        python3 "$HOME/.deploybot/deploybot-wrapper.py" "$@"
+        return $?
+    fi
+
+    _deploybot_quote "$*"; _db_qcmd="$_DB_QUOTED"
+    _deploybot_quote "$PWD"; _db_qcwd="$_DB_QUOTED"
+
+    # DBEV1 fields: version ts project hash phase exit command cwd.
+    # The command hash is "-" - the backend treats it as opaque.
+    printf 'DBEV1 %s %s - start - %s %s\\n' \\
+        "$EPOCHREALTIME" "$_DB_PROJECT" "$_db_qcmd" "$_db_qcwd" \\
+        >> "$_DB_LOG" 2>/dev/null
+
+    "$@"
+    _db_rc=$?
+
+    printf 'DBEV1 %s %s - complete %s %s %s\\n' \\
+        "$EPOCHREALTIME" "$_DB_PROJECT" "$_db_rc" "$_db_qcmd" "$_db_qcwd" \\
+        >> "$_DB_LOG" 2>/dev/null
+
+    return $_db_rc
+}
+
+fi
+'''
+
+        self.shell_function_script.write_text(shell_function_content)
+        logger.info("✅ [DEPLOY_WRAPPER] Shell function fast path created",
+                   path=str(self.shell_function_script))
+
     async def add_shell_alias(self):
         """Add the deploybot alias to the appropriate shell config file"""
         logger.info("🔗 [DEPLOY_WRAPPER] Adding shell alias...")
@@ -273,21 +514,30 @@ if __name__ == "__main__":
             # Default to .bashrc
             config_file = Path.home() / ".bashrc"
         
+        # Prefer the zero-fork shell function; the plain alias is the
+        # fallback when the sourceable script is missing. The function
+        # script itself falls back further on shells without EPOCHREALTIME.
         alias_line = f'alias deploybot="python3 {self.wrapper_script}"'
-        
+        source_line = (f'source "{self.shell_function_script}" 2>/dev/null || '
+                       f'{alias_line}')
+
         # Check if alias already exists
         if config_file.exists():
             content = config_file.read_text()
             if 'alias deploybot=' in content:
                 logger.info("✅ [DEPLOY_WRAPPER] Alias already exists")
                 return
-        
+
         # Add the alias
         with open(config_file, "a") as f:
             f.write(f"\n# DeployBot deployment wrapper alias\n")
-            f.write(f"{alias_line}\n")
-        
-        logger.info("✅ [DEPLOY_WRAPPER] Alias added to config file", 
+            f.write(f"{source_line}\n")
+
+        # We just changed an rc file ourselves - drop the scan cache so the
+        # next status check re-reads rather than trusting a stale fingerprint
+        self._alias_scan_cache = None
+
+        logger.info("✅ [DEPLOY_WRAPPER] Alias added to config file",
                    config_file=str(config_file))
 
     async def test_installation(self) -> Dict[str, Any]:
@@ -336,6 +586,12 @@ if __name__ == "__main__":
                 self.wrapper_script.unlink()
                 removed_items.append(str(self.wrapper_script))
                 logger.info("🗑️ [DEPLOY_WRAPPER] Removed wrapper script")
+
+            # Remove the shell function fast path
+            if self.shell_function_script.exists():
+                self.shell_function_script.unlink()
+                removed_items.append(str(self.shell_function_script))
+                logger.info("🗑️ [DEPLOY_WRAPPER] Removed shell function script")
             
             # Remove alias from shell configs (leaving comments)
             for config_file in self.shell_config_files:
@@ -345,16 +601,19 @@ if __name__ == "__main__":
                         if 'alias deploybot=' in content:
                             # Remove the alias line but keep comments
                             lines = content.split('\n')
-                            filtered_lines = [line for line in lines 
-                                           if not line.strip().startswith('alias deploybot=')]
+                            filtered_lines = [line for line in lines
+                                           if not line.strip().startswith('alias deploybot=')
+                                           and 'deploybot-wrapper.sh' not in line]
                             config_file.write_text('\n'.join(filtered_lines))
                             removed_items.append(f"alias from {config_file}")
                             logger.info("🗑️ [DEPLOY_WRAPPER] Removed alias", 
                                        config_file=str(config_file))
                     except Exception as e:
-                        logger.warning("⚠️ [DEPLOY_WRAPPER] Error cleaning config", 
+                        logger.warning("⚠️ [DEPLOY_WRAPPER] Error cleaning config",
                                      config_file=str(config_file), error=str(e))
-            
+
+            self._alias_scan_cache = None
+
             return {
                 "success": True,
                 "message": "Deploy wrapper uninstalled successfully",
@@ -7,23 +7,69 @@ This wrapper script helps avoid import conflicts when creating bundled executabl
 
 import sys
 import os
+import time
 from pathlib import Path
 
+# First line of our Python - everything before this is interpreter boot
+_MAIN_START = time.time()
+
+# --startup-report flows to the backend (and any standby it spawns) as an
+# environment variable so graph.py doesn't need to re-parse argv
+if "--startup-report" in sys.argv:
+    os.environ["DEPLOYBOT_STARTUP_REPORT"] = "1"
+
+
+def _find_backend_zipapp(source_dir: Path):
+    """
+    Locate the single-file backend archive built by setup_python_runtime.js.
+
+    Importing the backend from one zip replaces the per-module stat/open storm
+    of directory-based import resolution, which dominates cold start on slow
+    disks. The archive is only used when it is at least as new as every
+    backend source file, so editing a module during development always wins.
+    """
+    zipapp_path = source_dir.parent / 'python_runtime' / 'deploybot_backend.pyz'
+    if not zipapp_path.exists():
+        return None
+
+    try:
+        zipapp_mtime = zipapp_path.stat().st_mtime
+        for source_file in source_dir.glob('*.py'):
+            if source_file.stat().st_mtime > zipapp_mtime:
+                return None  # Stale archive - fall back to source directory
+    except OSError:
+        return None
+
+    return zipapp_path
+
+
 # Add the bundled modules to the path
 if hasattr(sys, '_MEIPASS'):
     # Running as bundled executable - _MEIPASS is added by PyInstaller
     bundle_dir = Path(getattr(sys, '_MEIPASS'))
     sys.path.insert(0, str(bundle_dir / 'deploybot_backend'))
 else:
-    # Running from source
+    # Running from source - prefer the zipapp bundle when it's fresh
     current_dir = Path(__file__).parent
-    sys.path.insert(0, str(current_dir))
+    backend_zipapp = _find_backend_zipapp(current_dir)
+    if backend_zipapp is not None:
+        # Keep the source directory on the path behind the archive: C
+        # extension modules (e.g. _deploy_parse) cannot load from a zip
+        sys.path.insert(0, str(current_dir))
+        sys.path.insert(0, str(backend_zipapp))
+    else:
+        sys.path.insert(0, str(current_dir))
 
 # Now import and run the main graph module
 if __name__ == "__main__":
+    import startreport
+    startreport.begin(_MAIN_START)
+
     # Import the main module after path setup
     import graph
-    
-    # Start the main function
+    startreport.mark("backend_imports")
+
+    # Start the main function (optionally on uvloop via DEPLOYBOT_UVLOOP=1)
     import asyncio
-    asyncio.run(graph.main()) 
\ No newline at end of file
+    graph.install_event_loop_policy()
+    asyncio.run(graph.main())
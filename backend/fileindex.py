@@ -0,0 +1,176 @@
+"""
+Project File Index for DeployBot
+
+Background-maintained per-project index of file names so redirect-time
+"relevant file" suggestions are dictionary lookups instead of directory
+crawls. The index keeps two views of each project tree:
+
+- extension buckets (suffix -> relative paths) for pattern-style queries
+- name trigrams (3-gram -> file ids) for substring/name queries
+
+Builds run in a worker thread off the event loop. The deploy monitor's
+project-root watcher invalidates a project's index on change, and a TTL
+covers edits in subdirectories the non-recursive watcher can't see.
+"""
+
+import asyncio
+import os
+import time
+from pathlib import Path
+from typing import Any, Dict, List, Optional
+
+import structlog
+
+logger = structlog.get_logger()
+
+# Directories that dominate large repos but never contain files worth
+# suggesting for a task
+SKIP_DIRS = {
+    '.git', 'node_modules', '__pycache__', '.venv', 'venv', 'env',
+    'dist', 'build', 'target', '.next', '.cache', '.deploybot',
+}
+
+# Safety valve for pathological trees - suggestions only need a sample
+MAX_INDEXED_FILES = 20000
+
+
+class ProjectFileIndex:
+    """Lazily built, watcher-invalidated file index keyed by project path"""
+
+    def __init__(self):
+        self._indexes: Dict[str, Dict[str, Any]] = {}  # project_path -> index
+        self._building: set = set()  # project paths with a build in flight
+        self.rebuild_ttl = 600  # Seconds before an index is considered stale anyway
+
+        logger.info("🗂️ [FILEINDEX] Project file index initialized")
+
+    @staticmethod
+    def _trigrams(name: str) -> set:
+        """Lowercase 3-grams of a file name (short names fall back to whole-name)"""
+        name = name.lower()
+        if len(name) < 3:
+            return {name}
+        return {name[i:i + 3] for i in range(len(name) - 2)}
+
+    def _build_sync(self, project_path: str) -> Dict[str, Any]:
+        """Walk the project tree once and build both index views (worker thread)"""
+        files: List[str] = []
+        ext_buckets: Dict[str, List[int]] = {}
+        trigrams: Dict[str, set] = {}
+
+        for root, dirnames, filenames in os.walk(project_path):
+            dirnames[:] = [d for d in dirnames if d not in SKIP_DIRS and not d.startswith('.')]
+            for filename in filenames:
+                if len(files) >= MAX_INDEXED_FILES:
+                    break
+                file_id = len(files)
+                files.append(os.path.join(root, filename))
+
+                suffix = Path(filename).suffix.lower()
+                if suffix:
+                    ext_buckets.setdefault(suffix, []).append(file_id)
+
+                for gram in self._trigrams(filename):
+                    trigrams.setdefault(gram, set()).add(file_id)
+            if len(files) >= MAX_INDEXED_FILES:
+                break
+
+        return {
+            "built_at": time.monotonic(),
+            "files": files,
+            "ext_buckets": ext_buckets,
+            "trigrams": trigrams,
+        }
+
+    def is_ready(self, project_path: str) -> bool:
+        """Whether a current index exists for the project"""
+        index = self._indexes.get(project_path)
+        if index is None:
+            return False
+        return time.monotonic() - index["built_at"] < self.rebuild_ttl
+
+    def request_index(self, project_path: str) -> None:
+        """
+        Kick off a background build if none is current or in flight. Safe to
+        call from sync code on the loop thread; silently does nothing when no
+        loop is running (the next call from async context will build).
+        """
+        if not project_path or self.is_ready(project_path) or project_path in self._building:
+            return
+
+        try:
+            loop = asyncio.get_running_loop()
+        except RuntimeError:
+            return
+
+        self._building.add(project_path)
+
+        async def _build():
+            try:
+                index = await loop.run_in_executor(None, self._build_sync, project_path)
+                self._indexes[project_path] = index
+                logger.info("🗂️ [FILEINDEX] Project index built",
+                           project_path=project_path, files=len(index["files"]))
+            except Exception as e:
+                logger.warning("⚠️ [FILEINDEX] Index build failed",
+                              project_path=project_path, error=str(e))
+            finally:
+                self._building.discard(project_path)
+
+        loop.create_task(_build())
+
+    def invalidate(self, project_path: str) -> None:
+        """Drop a project's index (called by the project-root watcher)"""
+        if self._indexes.pop(project_path, None) is not None:
+            logger.debug("🗂️ [FILEINDEX] Project index invalidated",
+                        project_path=project_path)
+
+    def lookup_by_extensions(self, project_path: str, extensions: List[str],
+                             limit: int = 3) -> Optional[List[str]]:
+        """
+        Files with any of the given suffixes (e.g. ['.py', '.ts']), up to
+        `limit` per suffix. Returns None when no current index exists so the
+        caller can fall back to a walk.
+        """
+        index = self._indexes.get(project_path)
+        if index is None or not self.is_ready(project_path):
+            return None
+
+        results: List[str] = []
+        for extension in extensions:
+            for file_id in index["ext_buckets"].get(extension.lower(), [])[:limit]:
+                results.append(index["files"][file_id])
+        return results
+
+    def lookup_by_name(self, project_path: str, term: str,
+                       limit: int = 5) -> Optional[List[str]]:
+        """
+        Files whose name contains the term, found via trigram candidate
+        intersection then verified. Returns None when no current index exists.
+        """
+        index = self._indexes.get(project_path)
+        if index is None or not self.is_ready(project_path):
+            return None
+
+        term = term.lower()
+        candidates: Optional[set] = None
+        for gram in self._trigrams(term):
+            ids = index["trigrams"].get(gram)
+            if not ids:
+                return []
+            candidates = ids if candidates is None else candidates & ids
+            if not candidates:
+                return []
+
+        results = []
+        for file_id in sorted(candidates or ()):
+            path = index["files"][file_id]
+            if term in os.path.basename(path).lower():
+                results.append(path)
+                if len(results) >= limit:
+                    break
+        return results
+
+
+# Global project file index instance
+project_file_index = ProjectFileIndex()
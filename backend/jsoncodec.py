@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+"""
+Pluggable JSON codec for DeployBot
+
+Serialization sits on every hot path - each WebSocket message, analytics
+save and mapping load goes through JSON. This module prefers orjson
+(bundled with the runtime via requirements.txt) and transparently falls
+back to the stdlib when the wheel is unavailable, so callers never need
+to know which implementation is active.
+
+All output is compact (no whitespace); pretty-printing was only ever for
+human eyes and costs real CPU on large analytics snapshots.
+"""
+
+import json as _json
+
+try:
+    import orjson as _orjson
+    ORJSON_AVAILABLE = True
+except ImportError:
+    _orjson = None
+    ORJSON_AVAILABLE = False
+
+# Both implementations raise a ValueError subclass with this name
+JSONDecodeError = _orjson.JSONDecodeError if ORJSON_AVAILABLE else _json.JSONDecodeError
+
+
+def dumps(obj) -> str:
+    """Serialize to a compact JSON string"""
+    if ORJSON_AVAILABLE:
+        return _orjson.dumps(obj, default=str).decode("utf-8")
+    return _json.dumps(obj, separators=(",", ":"), default=str)
+
+
+def loads(data):
+    """Parse JSON from a str, bytes or bytearray"""
+    if ORJSON_AVAILABLE:
+        return _orjson.loads(data)
+    if isinstance(data, (bytes, bytearray)):
+        data = data.decode("utf-8")
+    return _json.loads(data)
+
+
+def dump(obj, fp):
+    """Write compact JSON to a text-mode file object"""
+    fp.write(dumps(obj))
+
+
+def load(fp):
+    """Parse JSON from a file object"""
+    return loads(fp.read())
@@ -7,23 +7,86 @@ and provides centralized logging functionality for the DeployBot system.
 """
 
 import asyncio
+import gzip
+import json
+import mmap
+import os
+import re
+import shutil
+import struct
+import time
+from collections import deque
 from datetime import datetime
 from pathlib import Path
 from typing import Dict, Any, Optional, List
 import structlog
 
+from supervisor import task_supervisor
+
+# Optional msgpack for the structured record format - falls back to JSON payloads
+try:
+    import msgpack
+    MSGPACK_AVAILABLE = True
+except ImportError:
+    msgpack = None
+    MSGPACK_AVAILABLE = False
+
 logger = structlog.get_logger()
 
+# Matches the text log line format written by _write_log_batch, used by the
+# structured-format converter for old logs
+TEXT_LOG_LINE_PATTERN = re.compile(r"^\[(?P<timestamp>[^\]]+)\]\s+(?P<event_type>[A-Z_]+):\s?(?P<message>.*)$")
+
+# Each structured record is framed as a 4-byte big-endian payload length
+RECORD_LENGTH_FORMAT = ">I"
+RECORD_LENGTH_SIZE = struct.calcsize(RECORD_LENGTH_FORMAT)
+
 class ActivityLogger:
     """Manages activity logging for DeployBot projects"""
     
     def __init__(self):
-        self.log_queue = asyncio.Queue(maxsize=100)
+        # Bounded in-memory buffer drained by the processor task. Producers
+        # never block: on overflow, repeated event types are coalesced and
+        # only as a last resort is the oldest entry dropped, so a stuck disk
+        # caps memory instead of ballooning the queue or stalling hot paths
+        self.log_queue = deque()
+        self.log_queue_maxsize = 500
+        self._queue_event = None  # created by start_processing (needs the loop)
+        self._coalesced_entries = 0
+        self._dropped_entries = 0
         self.queue_processor_task = None
         self.processing_active = False
-        
+        self.websocket_server = None  # set by graph.py for "logs" topic pushes
+
+        # Write-behind batching: drain the queue in batches and keep target
+        # files open so a deploy burst costs one write+flush per file, not
+        # one open/append/close cycle per entry
+        self.max_batch_size = 100
+        self.fsync_interval = 1.0  # Seconds between fsyncs per file
+        self._file_handles = {}    # log file path -> open append handle
+        self._last_fsync = {}      # log file path -> monotonic time of last fsync
+
+        # Rotation: archive the hot file once it exceeds this size so tail
+        # reads and the monitor's startup scan stay fast
+        self.max_log_size = 5 * 1024 * 1024
+
+        # Optional structured sidecar format: length-prefixed binary records
+        # plus a per-file event-type offset index, so readers can skip and
+        # filter records without re-parsing text lines
+        self.structured_format = False
+
+        # Per-event-type byte offsets into the text log, maintained at write
+        # time so type-filtered views seek straight to matching lines instead
+        # of tailing everything and discarding most of it client-side
+        self._text_type_index_cache = {}  # log file path -> {event_type: [offsets]}
+
         logger.info("📝 [ACTIVITY_LOGGER] ActivityLogger initialized with queue size limit")
 
+    def set_websocket_server(self, websocket_server):
+        """Set the WebSocket server used to push log entries to subscribers"""
+        self.websocket_server = websocket_server
+        logger.info("🔌 [ACTIVITY_LOGGER] WebSocket server configured for log pushes")
+
     async def start_processing(self):
         """Start the log queue processing task"""
         if self.processing_active:
@@ -32,7 +95,11 @@ class ActivityLogger:
         
         logger.info("🚀 [ACTIVITY_LOGGER] Starting activity log processing...")
         self.processing_active = True
-        self.queue_processor_task = asyncio.create_task(self._process_log_queue())
+        self._queue_event = asyncio.Event()
+        if self.log_queue:
+            self._queue_event.set()  # entries queued before startup
+        self.queue_processor_task = task_supervisor.spawn(
+            "activity_log_queue", self._process_log_queue)
 
     async def stop_processing(self):
         """Stop the log queue processing task"""
@@ -245,27 +312,72 @@ class ActivityLogger:
         }
         
         try:
-            await self.log_queue.put(log_entry)
-            logger.debug("📝 [ACTIVITY_LOGGER] Log entry queued", 
+            if len(self.log_queue) >= self.log_queue_maxsize:
+                self._coalesce_on_overflow(log_entry)
+            else:
+                self.log_queue.append(log_entry)
+
+            if self._queue_event is not None:
+                self._queue_event.set()
+            logger.debug("📝 [ACTIVITY_LOGGER] Log entry queued",
                         project_name=project_name, event_type=event_type)
         except Exception as e:
-            logger.error("❌ [ACTIVITY_LOGGER] Failed to queue log entry", 
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to queue log entry",
                         project_name=project_name, error=str(e))
 
+    def _coalesce_on_overflow(self, log_entry: Dict[str, Any]):
+        """
+        Absorb a new entry into a full queue without blocking the producer.
+
+        Repeated event types collapse into the newest occurrence (with a
+        coalesced_count marker so the log shows something was folded); if
+        nothing matches, the oldest entry is dropped to make room. Either
+        way memory stays capped while the disk is stuck.
+        """
+        for index in range(len(self.log_queue) - 1, -1, -1):
+            queued = self.log_queue[index]
+            if (queued["event_type"] == log_entry["event_type"]
+                    and queued["project_name"] == log_entry["project_name"]):
+                folded = queued["details"].get("coalesced_count", 1) + 1
+                log_entry["details"]["coalesced_count"] = folded
+                self.log_queue[index] = log_entry
+                self._coalesced_entries += 1
+                return
+
+        self.log_queue.popleft()
+        self.log_queue.append(log_entry)
+        self._dropped_entries += 1
+        logger.warning("⚠️ [ACTIVITY_LOGGER] Log queue full - dropped oldest entry",
+                      dropped_total=self._dropped_entries)
+
     async def _process_log_queue(self):
         """Process queued log entries"""
         logger.info("🔄 [ACTIVITY_LOGGER] Starting log queue processing...")
         
         while self.processing_active:
             try:
-                # MEMORY LEAK FIX: Increased timeout to reduce CPU pressure
-                log_entry = await asyncio.wait_for(self.log_queue.get(), timeout=2.0)
-                await self._write_log_entry(log_entry)
-                self.log_queue.task_done()
-                
-            except asyncio.TimeoutError:
-                # No new log entries, continue
-                continue
+                # Sleep until a producer signals - no timeout polling, so an
+                # idle backend does zero periodic work here
+                await self._queue_event.wait()
+                self._queue_event.clear()
+
+                while self.log_queue:
+                    # Drain in bounded batches so a burst of entries becomes
+                    # one batched write per target file
+                    batch = []
+                    while self.log_queue and len(batch) < self.max_batch_size:
+                        batch.append(self.log_queue.popleft())
+
+                    await self._write_log_batch(batch)
+
+                    for entry in batch:
+                        # Push to clients subscribed to the "logs" topic (no-op otherwise)
+                        if self.websocket_server:
+                            try:
+                                await self.websocket_server.publish_topic("logs", "activity_logged", entry)
+                            except Exception as e:
+                                logger.debug("⚠️ [ACTIVITY_LOGGER] Failed to push log entry", error=str(e))
+
             except asyncio.CancelledError:
                 logger.info("🔄 [ACTIVITY_LOGGER] Log queue processing cancelled")
                 break
@@ -275,42 +387,331 @@ class ActivityLogger:
                 await asyncio.sleep(2)  # Wait 2 seconds before retrying instead of 1
 
     async def _write_log_entry(self, log_entry: Dict[str, Any]):
-        """Write a log entry to the appropriate file"""
+        """Write a single log entry (batch of one)"""
+        await self._write_log_batch([log_entry])
+
+    async def _write_log_batch(self, log_entries: List[Dict[str, Any]]):
+        """Write a drained batch of log entries, one write per target file"""
+        # Group formatted lines by target file so each file gets a single
+        # write + flush no matter how many entries the batch contains
+        grouped: Dict[str, Any] = {}
+        for log_entry in log_entries:
+            try:
+                project_name = log_entry["project_name"]
+                timestamp = log_entry["timestamp"]
+                event_type = log_entry["event_type"]
+                message = log_entry["message"]
+                project_path = log_entry.get("project_path")
+
+                log_file = self._get_log_file_path(project_name, project_path)
+                if not log_file:
+                    logger.warning("⚠️ [ACTIVITY_LOGGER] Could not determine log file path",
+                                 project_name=project_name)
+                    continue
+
+                timestamp_str = timestamp.strftime("[%Y-%m-%d %H:%M:%S]")
+                log_line = f"{timestamp_str} {event_type}: {message}\n"
+                bucket = grouped.setdefault(str(log_file), (log_file, [], []))
+                bucket[1].append(log_line)
+                bucket[2].append(log_entry)
+
+            except Exception as e:
+                logger.error("❌ [ACTIVITY_LOGGER] Failed to format log entry",
+                            project_name=log_entry.get("project_name"), error=str(e))
+
+        for path_str, (log_file, lines, entries) in grouped.items():
+            try:
+                handle = self._get_file_handle(path_str, log_file)
+                base_offset = handle.tell()
+                handle.writelines(lines)
+                handle.flush()
+
+                # Record each line's byte offset under its event type so
+                # filtered reads can seek directly to matching lines
+                new_offsets: Dict[str, List[int]] = {}
+                position = base_offset
+                for line, entry in zip(lines, entries):
+                    new_offsets.setdefault(entry["event_type"], []).append(position)
+                    position += len(line.encode('utf-8'))
+                self._update_text_type_index(path_str, log_file, new_offsets)
+
+                # fsync at most once per interval per file - durability is
+                # amortized across the burst instead of paid per entry
+                now = time.monotonic()
+                if now - self._last_fsync.get(path_str, 0.0) >= self.fsync_interval:
+                    os.fsync(handle.fileno())
+                    self._last_fsync[path_str] = now
+
+                logger.debug("✅ [ACTIVITY_LOGGER] Log batch written",
+                           log_file=path_str, entry_count=len(lines))
+
+                if self.structured_format:
+                    self._append_structured_records(log_file, entries)
+
+                if handle.tell() >= self.max_log_size:
+                    self._rotate_log_file(path_str, log_file)
+
+            except Exception as e:
+                # Drop the cached handle so the next batch reopens the file
+                self._close_file_handle(path_str)
+                logger.error("❌ [ACTIVITY_LOGGER] Failed to write log batch",
+                            log_file=path_str, error=str(e))
+
+    def _get_file_handle(self, path_str: str, log_file: Path):
+        """Get (or open and cache) an append handle for a log file"""
+        handle = self._file_handles.get(path_str)
+        if handle is not None and not handle.closed:
+            return handle
+
+        log_file.parent.mkdir(parents=True, exist_ok=True)
+        handle = open(log_file, 'a', encoding='utf-8')
+        self._file_handles[path_str] = handle
+        logger.debug("📂 [ACTIVITY_LOGGER] Opened cached log file handle", log_file=path_str)
+        return handle
+
+    def _close_file_handle(self, path_str: str):
+        """Close and evict a cached log file handle"""
+        handle = self._file_handles.pop(path_str, None)
+        self._last_fsync.pop(path_str, None)
+        if handle is not None:
+            try:
+                handle.close()
+            except Exception as e:
+                logger.debug("⚠️ [ACTIVITY_LOGGER] Error closing log file handle",
+                           log_file=path_str, error=str(e))
+
+    def _close_all_file_handles(self):
+        """Close every cached log file handle"""
+        for path_str in list(self._file_handles.keys()):
+            self._close_file_handle(path_str)
+
+    def _rotate_log_file(self, path_str: str, log_file: Path):
+        """Compress the hot log file into the archive directory and index it"""
         try:
-            project_name = log_entry["project_name"]
-            timestamp = log_entry["timestamp"]
-            event_type = log_entry["event_type"]
-            message = log_entry["message"]
-            project_path = log_entry.get("project_path")
-            
-            # Format timestamp
-            timestamp_str = timestamp.strftime("[%Y-%m-%d %H:%M:%S]")
-            
-            # Create log line
-            log_line = f"{timestamp_str} {event_type}: {message}\n"
-            
-            # Determine log file path
-            log_file = self._get_log_file_path(project_name, project_path)
-            
-            if log_file:
-                # Ensure log directory exists
-                log_file.parent.mkdir(parents=True, exist_ok=True)
-                
-                # Write log entry
-                with open(log_file, 'a', encoding='utf-8') as f:
-                    f.write(log_line)
-                
-                logger.debug("✅ [ACTIVITY_LOGGER] Log entry written", 
-                           project_name=project_name, 
-                           event_type=event_type,
-                           log_file=str(log_file))
+            self._close_file_handle(path_str)
+
+            archive_dir = log_file.parent / "archive"
+            archive_dir.mkdir(exist_ok=True)
+
+            rotated_at = datetime.now()
+            archive_path = archive_dir / f"{log_file.stem}-{rotated_at.strftime('%Y%m%d-%H%M%S')}.log.gz"
+            original_size = log_file.stat().st_size
+
+            line_count = 0
+            with open(log_file, 'rb') as src:
+                with gzip.open(archive_path, 'wb') as dst:
+                    while True:
+                        chunk = src.read(64 * 1024)
+                        if not chunk:
+                            break
+                        line_count += chunk.count(b"\n")
+                        dst.write(chunk)
+
+            log_file.unlink()
+            self._drop_text_type_index(path_str, log_file)
+
+            self._update_archive_manifest(archive_dir, {
+                "archive": archive_path.name,
+                "rotated_at": rotated_at.isoformat(),
+                "original_size": original_size,
+                "compressed_size": archive_path.stat().st_size,
+                "line_count": line_count
+            })
+
+            logger.info("🔄 [ACTIVITY_LOGGER] Log file rotated",
+                       log_file=path_str,
+                       archive=archive_path.name,
+                       original_size=original_size,
+                       line_count=line_count)
+
+        except Exception as e:
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to rotate log file",
+                        log_file=path_str, error=str(e))
+
+    def _update_archive_manifest(self, archive_dir: Path, entry: Dict[str, Any]):
+        """Append an archive entry to the manifest index (atomic write)"""
+        manifest_file = archive_dir / "manifest.json"
+        try:
+            if manifest_file.exists():
+                with open(manifest_file, 'r', encoding='utf-8') as f:
+                    manifest = json.load(f)
             else:
-                logger.warning("⚠️ [ACTIVITY_LOGGER] Could not determine log file path", 
-                             project_name=project_name)
-        
+                manifest = []
+
+            manifest.append(entry)
+
+            tmp_file = manifest_file.with_suffix('.json.tmp')
+            with open(tmp_file, 'w', encoding='utf-8') as f:
+                json.dump(manifest, f, indent=2)
+            tmp_file.replace(manifest_file)
+
+        except Exception as e:
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to update archive manifest",
+                        archive_dir=str(archive_dir), error=str(e))
+
+    # Structured binary format (optional, enabled via structured_format)
+
+    @staticmethod
+    def _structured_path(log_file: Path) -> Path:
+        """Sidecar path for the structured record file"""
+        return log_file.with_suffix('.alog')
+
+    @staticmethod
+    def _encode_record(record: Dict[str, Any]) -> bytes:
+        """Encode one structured record payload (msgpack when available)"""
+        if MSGPACK_AVAILABLE:
+            return msgpack.packb(record, use_bin_type=True)
+        return json.dumps(record).encode('utf-8')
+
+    @staticmethod
+    def _decode_record(payload: bytes) -> Dict[str, Any]:
+        """Decode one structured record payload"""
+        if payload[:1] in (b'{', b'['):
+            return json.loads(payload.decode('utf-8'))
+        if MSGPACK_AVAILABLE:
+            return msgpack.unpackb(payload, raw=False)
+        raise ValueError("msgpack record but msgpack is not installed")
+
+    def _append_structured_records(self, log_file: Path, log_entries: List[Dict[str, Any]]):
+        """Append length-prefixed records and update the per-file type index"""
+        structured_file = self._structured_path(log_file)
+        try:
+            new_offsets: Dict[str, List[int]] = {}
+            with open(structured_file, 'ab') as f:
+                for log_entry in log_entries:
+                    record = {
+                        "timestamp": log_entry["timestamp"].isoformat(),
+                        "project_name": log_entry["project_name"],
+                        "event_type": log_entry["event_type"],
+                        "message": log_entry["message"],
+                        "details": log_entry.get("details", {})
+                    }
+                    payload = self._encode_record(record)
+                    offset = f.tell()
+                    f.write(struct.pack(RECORD_LENGTH_FORMAT, len(payload)))
+                    f.write(payload)
+                    new_offsets.setdefault(log_entry["event_type"], []).append(offset)
+
+            self._update_type_index(structured_file, new_offsets)
+
+        except Exception as e:
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to append structured records",
+                        structured_file=str(structured_file), error=str(e))
+
+    def _update_type_index(self, structured_file: Path, new_offsets: Dict[str, List[int]]):
+        """Merge newly written record offsets into the per-file type index"""
+        index_file = structured_file.with_suffix('.alog.idx')
+        try:
+            if index_file.exists():
+                with open(index_file, 'r', encoding='utf-8') as f:
+                    index = json.load(f)
+            else:
+                index = {}
+
+            for event_type, offsets in new_offsets.items():
+                index.setdefault(event_type, []).extend(offsets)
+
+            tmp_file = index_file.with_suffix('.idx.tmp')
+            with open(tmp_file, 'w', encoding='utf-8') as f:
+                json.dump(index, f)
+            tmp_file.replace(index_file)
+
+        except Exception as e:
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to update type index",
+                        index_file=str(index_file), error=str(e))
+
+    async def read_structured_logs(self, project_name: str, limit: int = 100,
+                                 event_type: Optional[str] = None,
+                                 project_path: Optional[str] = None) -> List[Dict[str, Any]]:
+        """
+        Read recent structured records without parsing text.
+
+        The file is mapped read-only; the length prefix lets the reader skip
+        records without decoding them, and an event_type filter uses the
+        per-file offset index to touch only matching records.
+        """
+        try:
+            log_file = self._get_log_file_path(project_name, project_path)
+            if not log_file:
+                return []
+
+            structured_file = self._structured_path(log_file)
+            if not structured_file.exists() or structured_file.stat().st_size == 0:
+                return []
+
+            with open(structured_file, 'rb') as f:
+                with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as mapped:
+                    if event_type:
+                        offsets = self._load_type_offsets(structured_file, event_type)
+                    else:
+                        # Walk the framing to collect offsets - no decoding
+                        offsets = []
+                        position = 0
+                        while position + RECORD_LENGTH_SIZE <= len(mapped):
+                            (length,) = struct.unpack_from(RECORD_LENGTH_FORMAT, mapped, position)
+                            offsets.append(position)
+                            position += RECORD_LENGTH_SIZE + length
+
+                    records = []
+                    for offset in offsets[-limit:]:
+                        (length,) = struct.unpack_from(RECORD_LENGTH_FORMAT, mapped, offset)
+                        start = offset + RECORD_LENGTH_SIZE
+                        records.append(self._decode_record(bytes(mapped[start:start + length])))
+                    return records
+
         except Exception as e:
-            logger.error("❌ [ACTIVITY_LOGGER] Failed to write log entry", 
-                        project_name=log_entry.get("project_name"), error=str(e))
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to read structured logs",
+                        project_name=project_name, error=str(e))
+            return []
+
+    def _load_type_offsets(self, structured_file: Path, event_type: str) -> List[int]:
+        """Load record offsets for one event type from the index"""
+        index_file = structured_file.with_suffix('.alog.idx')
+        if not index_file.exists():
+            return []
+        with open(index_file, 'r', encoding='utf-8') as f:
+            index = json.load(f)
+        return index.get(event_type, [])
+
+    def convert_text_log_to_structured(self, log_file: Path) -> int:
+        """
+        Convert an existing text activity log into the structured format.
+
+        Returns the number of records converted. Lines that don't match the
+        text format are skipped.
+        """
+        converted = 0
+        try:
+            entries = []
+            with open(log_file, 'r', encoding='utf-8') as f:
+                for line in f:
+                    match = TEXT_LOG_LINE_PATTERN.match(line.strip())
+                    if not match:
+                        continue
+                    try:
+                        timestamp = datetime.strptime(match.group("timestamp"), "%Y-%m-%d %H:%M:%S")
+                    except ValueError:
+                        continue
+                    entries.append({
+                        "timestamp": timestamp,
+                        "project_name": log_file.parent.parent.name,
+                        "event_type": match.group("event_type"),
+                        "message": match.group("message"),
+                        "details": {}
+                    })
+
+            if entries:
+                self._append_structured_records(log_file, entries)
+                converted = len(entries)
+
+            logger.info("🔁 [ACTIVITY_LOGGER] Converted text log to structured format",
+                       log_file=str(log_file), converted=converted)
+            return converted
+
+        except Exception as e:
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to convert text log",
+                        log_file=str(log_file), error=str(e))
+            return converted
 
     def _get_log_file_path(self, project_name: str, project_path: Optional[str] = None) -> Optional[Path]:
         """
@@ -400,24 +801,229 @@ class ActivityLogger:
                         project_name=project_name, error=str(e))
             return None
 
-    async def get_recent_logs(self, project_name: str, limit: int = 20, 
-                            project_path: Optional[str] = None) -> List[str]:
-        """Get recent log entries for a project"""
+    def _text_type_index_file(self, log_file: Path) -> Path:
+        """Sidecar index file holding per-event-type byte offsets"""
+        return log_file.with_suffix('.types.idx')
+
+    def _update_text_type_index(self, path_str: str, log_file: Path,
+                                new_offsets: Dict[str, List[int]]):
+        """Merge freshly written line offsets into the per-file type index"""
+        try:
+            index = self._load_text_type_index(path_str, log_file)
+            for event_type, offsets in new_offsets.items():
+                index.setdefault(event_type, []).extend(offsets)
+
+            index_file = self._text_type_index_file(log_file)
+            tmp_file = index_file.with_suffix('.idx.tmp')
+            with open(tmp_file, 'w', encoding='utf-8') as f:
+                json.dump(index, f)
+            tmp_file.replace(index_file)
+
+        except Exception as e:
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to update text type index",
+                        log_file=path_str, error=str(e))
+
+    def _load_text_type_index(self, path_str: str, log_file: Path) -> Dict[str, List[int]]:
+        """Load (and cache) a log file's type index; empty when none exists"""
+        index = self._text_type_index_cache.get(path_str)
+        if index is not None:
+            return index
+
+        index = {}
+        index_file = self._text_type_index_file(log_file)
+        if index_file.exists():
+            try:
+                with open(index_file, 'r', encoding='utf-8') as f:
+                    index = json.load(f)
+            except Exception as e:
+                logger.warning("⚠️ [ACTIVITY_LOGGER] Failed to load text type index",
+                              index_file=str(index_file), error=str(e))
+                index = {}
+        self._text_type_index_cache[path_str] = index
+        return index
+
+    def _drop_text_type_index(self, path_str: str, log_file: Path):
+        """Discard the type index (rotation/clear restart offsets at zero)"""
+        self._text_type_index_cache.pop(path_str, None)
+        index_file = self._text_type_index_file(log_file)
+        try:
+            if index_file.exists():
+                index_file.unlink()
+        except Exception as e:
+            logger.debug("⚠️ [ACTIVITY_LOGGER] Failed to remove text type index",
+                        index_file=str(index_file), error=str(e))
+
+    async def get_recent_logs(self, project_name: str, limit: int = 20,
+                            project_path: Optional[str] = None,
+                            event_type: Optional[str] = None) -> List[str]:
+        """
+        Get recent log entries for a project.
+
+        With an event_type filter, the per-type offset index makes the read
+        proportional to the matching lines shown - the last N deploy events
+        cost N seeks, not a scan of everything written in between.
+        """
         try:
             log_file = self._get_log_file_path(project_name, project_path)
-            
+
             if not log_file or not log_file.exists():
                 return []
-            
-            with open(log_file, 'r', encoding='utf-8') as f:
-                lines = f.readlines()
-            
-            # Get the most recent entries
-            recent_lines = lines[-limit:] if len(lines) > limit else lines
+
+            if event_type:
+                offsets = self._load_text_type_index(str(log_file), log_file).get(event_type)
+                if offsets:
+                    matching = []
+                    with open(log_file, 'rb') as f:
+                        for offset in offsets[-limit:]:
+                            f.seek(offset)
+                            line = f.readline().decode('utf-8', errors='replace').strip()
+                            if line:
+                                matching.append(line)
+                    return matching
+
+                # Log predates the index - filter an oversized tail instead
+                needle = f" {event_type}:"
+                recent_lines = self._tail_lines(log_file, limit * 10)
+                return [line.strip() for line in recent_lines
+                        if needle in line][-limit:]
+
+            recent_lines = self._tail_lines(log_file, limit)
             return [line.strip() for line in recent_lines if line.strip()]
-        
+
         except Exception as e:
-            logger.error("❌ [ACTIVITY_LOGGER] Failed to get recent logs", 
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to get recent logs",
+                        project_name=project_name, error=str(e))
+            return []
+
+    async def get_logs_since(self, project_name: str, cursor: Optional[int] = None,
+                             limit: int = 200,
+                             project_path: Optional[str] = None,
+                             event_type: Optional[str] = None) -> Dict[str, Any]:
+        """
+        Get log entries appended since a client-held cursor.
+
+        The cursor is a byte offset into the activity log; clients fetch an
+        initial tail, remember the returned cursor, and subsequent calls read
+        only the bytes written since - so a refresh during an active deploy
+        costs a stat plus the new entries, not a re-read of the whole tail.
+
+        Returns:
+            Dict with "entries" (new lines, oldest first) and "cursor" (the
+            offset to pass next time). A cursor past EOF (rotation or clear)
+            falls back to a fresh tail.
+        """
+        try:
+            log_file = self._get_log_file_path(project_name, project_path)
+
+            if not log_file or not log_file.exists():
+                return {"entries": [], "cursor": 0}
+
+            file_size = log_file.stat().st_size
+
+            # First call, or the file shrank underneath us (rotation/clear):
+            # serve a fresh tail and restart the cursor at EOF
+            if cursor is None or cursor > file_size:
+                if event_type:
+                    entries = await self.get_recent_logs(
+                        project_name, limit, project_path, event_type)
+                else:
+                    recent_lines = self._tail_lines(log_file, limit)
+                    entries = [line.strip() for line in recent_lines if line.strip()]
+                return {"entries": entries, "cursor": file_size}
+
+            if cursor == file_size:
+                return {"entries": [], "cursor": file_size}
+
+            with open(log_file, 'rb') as f:
+                f.seek(cursor)
+                new_bytes = f.read(file_size - cursor)
+
+            entries = [line.strip() for line in
+                       new_bytes.decode('utf-8', errors='replace').splitlines()
+                       if line.strip()]
+
+            if event_type:
+                needle = f" {event_type}:"
+                entries = [line for line in entries if needle in line]
+
+            return {"entries": entries[-limit:], "cursor": file_size}
+
+        except Exception as e:
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to get logs since cursor",
+                        project_name=project_name, cursor=cursor, error=str(e))
+            return {"entries": [], "cursor": cursor or 0}
+
+    def _tail_lines(self, log_file: Path, limit: int, block_size: int = 8192) -> List[str]:
+        """
+        Return the last `limit` lines of a file without reading it all.
+
+        Scans fixed-size blocks backwards from EOF until enough newlines have
+        been seen, so cost is proportional to the lines requested rather than
+        the file size - busy activity logs grow to tens of MB.
+        """
+        buffer = b""
+        with open(log_file, 'rb') as f:
+            f.seek(0, os.SEEK_END)
+            position = f.tell()
+
+            while position > 0 and buffer.count(b"\n") <= limit:
+                read_size = min(block_size, position)
+                position -= read_size
+                f.seek(position)
+                buffer = f.read(read_size) + buffer
+
+        lines = buffer.decode('utf-8', errors='replace').splitlines()
+        return lines[-limit:]
+
+    async def get_logs_history(self, project_name: str, limit: int = 100,
+                             project_path: Optional[str] = None) -> List[str]:
+        """
+        Get recent log entries across the hot file AND rotated archives.
+
+        Walks the archive manifest newest-first and only decompresses as many
+        segments as are needed to satisfy the limit.
+        """
+        try:
+            log_file = self._get_log_file_path(project_name, project_path)
+            if not log_file:
+                return []
+
+            lines: List[str] = []
+            if log_file.exists():
+                lines = [line.strip() for line in self._tail_lines(log_file, limit) if line.strip()]
+
+            if len(lines) >= limit:
+                return lines[-limit:]
+
+            # Top up from archives, newest segment first
+            archive_dir = log_file.parent / "archive"
+            manifest_file = archive_dir / "manifest.json"
+            if not manifest_file.exists():
+                return lines
+
+            with open(manifest_file, 'r', encoding='utf-8') as f:
+                manifest = json.load(f)
+
+            for entry in reversed(manifest):
+                if len(lines) >= limit:
+                    break
+
+                archive_path = archive_dir / entry.get("archive", "")
+                if not archive_path.exists():
+                    continue
+
+                needed = limit - len(lines)
+                with gzip.open(archive_path, 'rt', encoding='utf-8', errors='replace') as f:
+                    archived = [line.strip() for line in f if line.strip()]
+
+                lines = archived[-needed:] + lines
+                logger.debug("📦 [ACTIVITY_LOGGER] Read rotated log segment",
+                           archive=entry.get("archive"), lines_taken=min(needed, len(archived)))
+
+            return lines[-limit:]
+
+        except Exception as e:
+            logger.error("❌ [ACTIVITY_LOGGER] Failed to get log history",
                         project_name=project_name, error=str(e))
             return []
 
@@ -427,7 +1033,10 @@ class ActivityLogger:
             log_file = self._get_log_file_path(project_name, project_path)
             
             if log_file and log_file.exists():
+                # Evict any cached handle so the deleted file isn't kept alive
+                self._close_file_handle(str(log_file))
                 log_file.unlink()
+                self._drop_text_type_index(str(log_file), log_file)
                 logger.info("🗑️ [ACTIVITY_LOGGER] Project logs cleared", 
                            project_name=project_name)
                 return True
@@ -446,17 +1055,16 @@ class ActivityLogger:
         await self.stop_processing()
         
         # Process any remaining queued entries
-        while not self.log_queue.empty():
+        while self.log_queue:
             try:
-                log_entry = self.log_queue.get_nowait()
+                log_entry = self.log_queue.popleft()
                 await self._write_log_entry(log_entry)
-                self.log_queue.task_done()
-            except asyncio.QueueEmpty:
-                break
             except Exception as e:
-                logger.warning("⚠️ [ACTIVITY_LOGGER] Error processing final log entries", 
+                logger.warning("⚠️ [ACTIVITY_LOGGER] Error processing final log entries",
                              error=str(e))
-        
+
+        self._close_all_file_handles()
+
         logger.info("✅ [ACTIVITY_LOGGER] Activity logger cleanup completed")
 
 # Global instance
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+Lazy, Level-Gated Logging for DeployBot
+
+Hot paths like monitor._check_project_for_deploys build multi-field log
+dicts on every call even when the record will be discarded. Two pieces
+fix that:
+
+  lazy(fn)  - wraps an expensive field; it is only evaluated if the
+              record survives level filtering
+  per-module levels - every DeployBot log event starts with an emoji and
+              a [TAG]; a processor gates records on a runtime-adjustable
+              level per tag, changed over WebSocket via 'set-log-level'
+
+graph.py installs both processors and lowers the global structlog floor
+to DEBUG so per-module DEBUG can be enabled without a restart; the
+default per-module threshold stays at INFO.
+"""
+
+import logging
+import re
+from typing import Any, Dict
+
+import structlog
+
+LEVELS = {"debug": 10, "info": 20, "warning": 30, "error": 40, "critical": 50}
+DEFAULT_LEVEL = 20  # INFO, matching the old global filter
+
+# module tag (e.g. "DEPLOY_MONITOR") -> numeric threshold override
+_module_levels: Dict[str, int] = {}
+
+# Events look like "🔍 [DEPLOY_MONITOR] Checking project for changes"
+_TAG_PATTERN = re.compile(r"\[([A-Z_]+)\]")
+
+
+class Lazy:
+    """Deferred log field - evaluated only when the record is emitted"""
+
+    __slots__ = ("_fn",)
+
+    def __init__(self, fn):
+        self._fn = fn
+
+    def resolve(self):
+        try:
+            return self._fn()
+        except Exception as e:
+            return f"<lazy field error: {e}>"
+
+    def __repr__(self):
+        # Safety net for renderers that see an unresolved Lazy
+        return repr(self.resolve())
+
+
+def lazy(fn) -> Lazy:
+    """Defer an expensive log field until the record actually renders"""
+    return Lazy(fn)
+
+
+def set_module_level(module: str, level: str) -> bool:
+    """Set the log threshold for one module tag (and stdlib logger) at runtime"""
+    numeric = LEVELS.get(level.lower())
+    if numeric is None:
+        return False
+
+    tag = module.upper()
+    if numeric == DEFAULT_LEVEL:
+        _module_levels.pop(tag, None)
+    else:
+        _module_levels[tag] = numeric
+
+    # Modules on stdlib logging (analytics) key their logger by module name
+    logging.getLogger(module.lower()).setLevel(numeric)
+    return True
+
+
+def get_module_levels() -> Dict[str, str]:
+    """Current per-module overrides as level names"""
+    names = {v: k for k, v in LEVELS.items()}
+    return {tag: names.get(numeric, str(numeric))
+            for tag, numeric in _module_levels.items()}
+
+
+def module_level_filter(logger, method_name, event_dict):
+    """structlog processor: drop records below their module's threshold"""
+    record_level = LEVELS.get(method_name, 20)
+    threshold = DEFAULT_LEVEL
+    if _module_levels:
+        match = _TAG_PATTERN.search(event_dict.get("event", ""))
+        if match:
+            threshold = _module_levels.get(match.group(1), DEFAULT_LEVEL)
+    if record_level < threshold:
+        raise structlog.DropEvent
+    return event_dict
+
+
+def resolve_lazy_fields(logger, method_name, event_dict):
+    """structlog processor: evaluate lazy fields for records that survived"""
+    for key, value in event_dict.items():
+        if isinstance(value, Lazy):
+            event_dict[key] = value.resolve()
+    return event_dict
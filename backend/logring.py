@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""
+In-Memory Ring-Buffer Sink for Backend Diagnostics
+
+Every structlog record the backend emits is rendered to stdout and carried
+over the pipe to process_manager.js, so verbose diagnostics cost pipe I/O
+whether or not anyone is looking. This sink keeps the last N records in a
+ring buffer instead and lets only warnings and above continue to the pipe:
+the detailed INFO/DEBUG trail is free until something goes wrong, then the
+whole recent history is dumped on demand (perf command) or to a crash file.
+
+Installed as a structlog processor after lazy-field resolution and
+timestamping, so captured records are fully materialized.
+"""
+
+import json
+from collections import deque
+from pathlib import Path
+from typing import Any, Dict, List, Optional
+
+import structlog
+
+from loglevels import LEVELS
+
+# How many records the ring holds. At typical backend chattiness this covers
+# the last several minutes of full-detail history in a few MB.
+RING_CAPACITY = 2000
+
+# Records at or above this level still render to stdout (the pipe);
+# everything below is ring-only. Adjustable at runtime for debugging.
+_pipe_level = LEVELS["warning"]
+
+_records = deque(maxlen=RING_CAPACITY)
+_dropped_from_pipe = 0
+
+
+def ring_buffer_sink(logger, method_name, event_dict):
+    """structlog processor: capture every record, gate the pipe to warnings+"""
+    global _dropped_from_pipe
+
+    # Shallow copy - later processors (the renderer) mutate event_dict
+    _records.append((method_name, dict(event_dict)))
+
+    if LEVELS.get(method_name, LEVELS["info"]) < _pipe_level:
+        _dropped_from_pipe += 1
+        raise structlog.DropEvent
+    return event_dict
+
+
+def set_pipe_level(level: str) -> bool:
+    """Change which records still go to the stdout pipe (e.g. 'debug' = all)"""
+    global _pipe_level
+    numeric = LEVELS.get(level.lower())
+    if numeric is None:
+        return False
+    _pipe_level = numeric
+    return True
+
+
+def _coerce(value: Any) -> Any:
+    """Make a captured field JSON-safe without paying for it at log time"""
+    if value is None or isinstance(value, (str, int, float, bool)):
+        return value
+    if isinstance(value, (list, tuple)):
+        return [_coerce(v) for v in value]
+    if isinstance(value, dict):
+        return {str(k): _coerce(v) for k, v in value.items()}
+    return repr(value)
+
+
+def get_records(limit: int = 500, min_level: str = "debug") -> List[Dict[str, Any]]:
+    """Most recent captured records (oldest first), JSON-safe"""
+    threshold = LEVELS.get(min_level.lower(), LEVELS["debug"])
+    selected = [(method_name, event_dict)
+                for method_name, event_dict in list(_records)
+                if LEVELS.get(method_name, LEVELS["info"]) >= threshold]
+
+    records = []
+    for method_name, event_dict in selected[-limit:]:
+        record = {"level": method_name,
+                  "timestamp": event_dict.get("timestamp"),
+                  "event": event_dict.get("event")}
+        fields = {k: _coerce(v) for k, v in event_dict.items()
+                  if k not in ("timestamp", "event")}
+        if fields:
+            record["fields"] = fields
+        records.append(record)
+    return records
+
+
+def get_stats() -> Dict[str, Any]:
+    """Ring occupancy and pipe-gating counters for perf-stats"""
+    names = {v: k for k, v in LEVELS.items()}
+    return {
+        "capacity": RING_CAPACITY,
+        "buffered": len(_records),
+        "pipe_level": names.get(_pipe_level, str(_pipe_level)),
+        "suppressed_from_pipe": _dropped_from_pipe
+    }
+
+
+def dump_to_file(reason: str = "crash") -> Optional[str]:
+    """Write the full ring to ~/.deploybot/diagnostics/ (used on fatal errors)"""
+    try:
+        dump_dir = Path.home() / ".deploybot" / "diagnostics"
+        dump_dir.mkdir(parents=True, exist_ok=True)
+        from datetime import datetime
+        dump_file = dump_dir / f"ring-{reason}-{datetime.now().strftime('%Y%m%d-%H%M%S')}.json"
+        dump_file.write_text(json.dumps(get_records(limit=RING_CAPACITY), indent=1),
+                             encoding="utf-8")
+        return str(dump_file)
+    except Exception:
+        # The dump is a best-effort postmortem aid - never mask the real error
+        return None
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""
+Event-Loop Lag Watchdog for DeployBot
+
+Timer updates and notification deadlines all share one asyncio loop, so a
+single blocking call anywhere in the backend shows up as stutter everywhere.
+This module measures loop lag directly - it schedules a short sleep and
+compares the expected wakeup time against when the loop actually got around
+to it - and, separately, times every callback the loop runs so a lag spike
+is attributed to the coroutine that caused it by name.
+
+Callback timing works by wrapping asyncio's Handle._run, the single choke
+point every callback and task step passes through. The wrapper is two
+perf_counter reads plus a comparison in the common case; only callbacks
+over the threshold pay for attribution. Findings surface through the
+'perf-stats' WebSocket command next to the GC and monitor sections.
+"""
+
+import asyncio
+import asyncio.events
+import time
+from collections import deque
+from typing import Any, Dict
+
+import structlog
+
+logger = structlog.get_logger()
+
+
+def _describe_callback(handle) -> str:
+    """Human-readable name for a loop callback, unwrapping task steps"""
+    callback = getattr(handle, "_callback", None)
+    task = getattr(callback, "__self__", None)
+    if isinstance(task, asyncio.Task):
+        coro = task.get_coro()
+        return getattr(coro, "__qualname__", repr(coro))
+    return getattr(callback, "__qualname__", repr(callback))
+
+
+class EventLoopWatchdog:
+    """Continuous loop-lag sampling with slow-callback attribution"""
+
+    def __init__(self):
+        self.lag_sample_interval = 0.25  # seconds between wakeup probes
+        self.slow_callback_threshold = 0.1  # seconds before a callback is "slow"
+
+        self.lag_samples = deque(maxlen=240)  # lag in ms, ~1 minute of probes
+        self.max_lag_ms = 0.0
+        self.slow_callbacks = deque(maxlen=50)  # most recent offenders
+        self.slow_callback_counts: Dict[str, Dict[str, Any]] = {}
+
+        self._lag_task = None
+        self._original_handle_run = None
+
+    def start(self):
+        """Install the callback timer and start the lag probe loop"""
+        if self._lag_task is not None:
+            return
+
+        self._install_callback_timer()
+        self._lag_task = asyncio.create_task(self._lag_loop())
+        logger.info("⏰ [LOOPWATCH] Event-loop watchdog started",
+                   sample_interval=self.lag_sample_interval,
+                   slow_threshold_ms=self.slow_callback_threshold * 1000)
+
+    async def stop(self):
+        """Stop probing and restore the original callback runner"""
+        if self._lag_task is not None:
+            self._lag_task.cancel()
+            try:
+                await self._lag_task
+            except asyncio.CancelledError:
+                pass
+            self._lag_task = None
+
+        if self._original_handle_run is not None:
+            asyncio.events.Handle._run = self._original_handle_run
+            self._original_handle_run = None
+
+    def _install_callback_timer(self):
+        """Wrap Handle._run so every callback the loop executes is timed"""
+        if self._original_handle_run is not None:
+            return
+
+        original_run = asyncio.events.Handle._run
+        self._original_handle_run = original_run
+        watchdog = self
+
+        def timed_run(handle):
+            started = time.perf_counter()
+            result = original_run(handle)
+            elapsed = time.perf_counter() - started
+            if elapsed >= watchdog.slow_callback_threshold:
+                watchdog._record_slow_callback(handle, elapsed)
+            return result
+
+        asyncio.events.Handle._run = timed_run
+
+    def _record_slow_callback(self, handle, elapsed: float):
+        """Attribute a slow callback to its coroutine and keep running totals"""
+        try:
+            name = _describe_callback(handle)
+            elapsed_ms = round(elapsed * 1000, 1)
+
+            self.slow_callbacks.append({
+                "callback": name,
+                "duration_ms": elapsed_ms,
+                "timestamp": time.time()
+            })
+
+            totals = self.slow_callback_counts.setdefault(
+                name, {"count": 0, "total_ms": 0.0, "max_ms": 0.0})
+            totals["count"] += 1
+            totals["total_ms"] += elapsed_ms
+            totals["max_ms"] = max(totals["max_ms"], elapsed_ms)
+
+            logger.warning("🐢 [LOOPWATCH] Slow callback blocked the event loop",
+                          callback=name, duration_ms=elapsed_ms)
+        except Exception:
+            # Attribution is best-effort - never let it break the loop itself
+            pass
+
+    async def _lag_loop(self):
+        """Sample expected-vs-actual wakeup deltas continuously"""
+        loop = asyncio.get_running_loop()
+        while True:
+            expected = loop.time() + self.lag_sample_interval
+            await asyncio.sleep(self.lag_sample_interval)
+            lag_ms = max(0.0, (loop.time() - expected) * 1000)
+            self.lag_samples.append(lag_ms)
+            self.max_lag_ms = max(self.max_lag_ms, lag_ms)
+
+    def get_stats(self, summarize) -> Dict[str, Any]:
+        """Build the event-loop section of the 'perf-stats' response"""
+        offenders = sorted(
+            ({"callback": name,
+              "count": totals["count"],
+              "total_ms": round(totals["total_ms"], 1),
+              "max_ms": totals["max_ms"]}
+             for name, totals in self.slow_callback_counts.items()),
+            key=lambda entry: entry["total_ms"], reverse=True
+        )
+        return {
+            "watchdog_active": self._lag_task is not None,
+            "sample_interval": self.lag_sample_interval,
+            "lag_ms": summarize(self.lag_samples),
+            "max_lag_ms": round(self.max_lag_ms, 1),
+            "slow_callback_threshold_ms": self.slow_callback_threshold * 1000,
+            "slow_callbacks": list(self.slow_callbacks)[-10:],
+            "top_offenders": offenders[:10]
+        }
+
+
+# Global event-loop watchdog instance
+loop_watchdog = EventLoopWatchdog()
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""
+Memory Watchdog for DeployBot
+
+The backend runs for weeks at a time and leaks have bitten this codebase
+before (see the MEMORY LEAK FIX notes in logger.py). This module samples
+RSS on a timer and, when growth crosses a threshold, turns on tracemalloc
+and diffs successive snapshots so a leak is attributed to a module/line
+without attaching a debugger.
+
+tracemalloc is expensive, so it stays off until the first threshold
+crossing - steady-state cost is one RSS read every sample interval.
+Findings surface through the 'memory-stats' WebSocket command and are
+mirrored into the system activity log.
+"""
+
+import asyncio
+import os
+import sys
+import time
+import tracemalloc
+from collections import deque
+from datetime import datetime
+from typing import Any, Dict, Optional
+
+import structlog
+
+logger = structlog.get_logger()
+
+
+def _read_rss_bytes() -> Optional[int]:
+    """Current resident set size, or None if it can't be read"""
+    try:
+        with open("/proc/self/statm") as f:
+            pages = int(f.read().split()[1])
+        return pages * os.sysconf("SC_PAGE_SIZE")
+    except (OSError, ValueError, IndexError):
+        pass
+
+    try:
+        import resource
+        ru_maxrss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+        # ru_maxrss is bytes on macOS, kilobytes on Linux - and it's a
+        # high-water mark, which is still useful for growth detection
+        return ru_maxrss if sys.platform == "darwin" else ru_maxrss * 1024
+    except Exception:
+        return None
+
+
+class MemoryWatchdog:
+    """Periodic RSS sampling with threshold-triggered tracemalloc diffs"""
+
+    def __init__(self):
+        self.sample_interval = 30.0  # seconds
+        self.snapshot_threshold_bytes = 150 * 1024 * 1024  # growth before tracing
+
+        self.baseline_rss = None
+        self.rss_samples = deque(maxlen=240)  # (timestamp, bytes) - ~2h of history
+        self.snapshot_count = 0
+        self.last_diff = []  # top allocation growth from the latest snapshot diff
+
+        self._previous_snapshot = None
+        self._next_snapshot_rss = None
+        self._watchdog_task = None
+        self._activity_logger = None
+
+    async def start(self, activity_logger=None):
+        """Start the sampling loop"""
+        if self._watchdog_task is not None:
+            return
+
+        self._activity_logger = activity_logger
+        self.baseline_rss = _read_rss_bytes()
+        if self.baseline_rss is None:
+            logger.warning("⚠️ [MEMWATCH] RSS not readable on this platform - watchdog disabled")
+            return
+
+        self._next_snapshot_rss = self.baseline_rss + self.snapshot_threshold_bytes
+        self._watchdog_task = asyncio.create_task(self._watchdog_loop())
+        logger.info("🐕 [MEMWATCH] Memory watchdog started",
+                   baseline_mb=round(self.baseline_rss / (1024 * 1024), 1),
+                   threshold_mb=round(self.snapshot_threshold_bytes / (1024 * 1024), 1))
+
+    async def stop(self):
+        """Stop the sampling loop"""
+        if self._watchdog_task is not None:
+            self._watchdog_task.cancel()
+            try:
+                await self._watchdog_task
+            except asyncio.CancelledError:
+                pass
+            self._watchdog_task = None
+        if tracemalloc.is_tracing():
+            tracemalloc.stop()
+
+    async def _watchdog_loop(self):
+        """Sample RSS and escalate to tracemalloc when growth crosses the threshold"""
+        while True:
+            await asyncio.sleep(self.sample_interval)
+            try:
+                rss = _read_rss_bytes()
+                if rss is None:
+                    continue
+                self.rss_samples.append((time.time(), rss))
+
+                if rss >= self._next_snapshot_rss:
+                    await self._take_snapshot(rss)
+                    # Re-arm for the next growth step so a steady leak keeps
+                    # producing fresh diffs instead of one stale one
+                    self._next_snapshot_rss = rss + self.snapshot_threshold_bytes
+            except Exception as e:
+                logger.warning("⚠️ [MEMWATCH] Watchdog sample failed", error=str(e))
+
+    async def _take_snapshot(self, rss: int):
+        """Capture a tracemalloc snapshot and diff it against the previous one"""
+        if not tracemalloc.is_tracing():
+            tracemalloc.start(10)
+            logger.warning("🐕 [MEMWATCH] RSS growth threshold crossed - tracemalloc enabled",
+                          rss_mb=round(rss / (1024 * 1024), 1),
+                          baseline_mb=round(self.baseline_rss / (1024 * 1024), 1))
+            # The first snapshot only establishes the diff base
+            self._previous_snapshot = tracemalloc.take_snapshot()
+            self.snapshot_count += 1
+            return
+
+        snapshot = tracemalloc.take_snapshot()
+        self.snapshot_count += 1
+
+        diff = snapshot.compare_to(self._previous_snapshot, "lineno")
+        self._previous_snapshot = snapshot
+
+        self.last_diff = [
+            {
+                "location": str(stat.traceback),
+                "size_diff_kb": round(stat.size_diff / 1024, 1),
+                "count_diff": stat.count_diff
+            }
+            for stat in diff[:10]
+        ]
+
+        logger.warning("🐕 [MEMWATCH] Memory growth attributed",
+                      rss_mb=round(rss / (1024 * 1024), 1),
+                      top_growth=self.last_diff[:3])
+
+        if self._activity_logger is not None:
+            try:
+                await self._activity_logger.log_custom_event(
+                    "DeployBot", "memory_watchdog",
+                    f"RSS reached {round(rss / (1024 * 1024))}MB - top allocation growth recorded",
+                    details={"rss_bytes": rss, "top_growth": self.last_diff}
+                )
+            except Exception as e:
+                logger.warning("⚠️ [MEMWATCH] Failed to write activity log entry", error=str(e))
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Build the response for the 'memory-stats' command"""
+        current_rss = _read_rss_bytes()
+        stats = {
+            "watchdog_active": self._watchdog_task is not None,
+            "rss_bytes": current_rss,
+            "baseline_rss_bytes": self.baseline_rss,
+            "sample_interval": self.sample_interval,
+            "samples": [
+                {"timestamp": datetime.fromtimestamp(ts).isoformat(), "rss_bytes": rss}
+                for ts, rss in self.rss_samples
+            ],
+            "tracemalloc_active": tracemalloc.is_tracing(),
+            "snapshot_count": self.snapshot_count,
+            "last_diff": self.last_diff
+        }
+
+        if tracemalloc.is_tracing():
+            traced_current, traced_peak = tracemalloc.get_traced_memory()
+            stats["traced_current_bytes"] = traced_current
+            stats["traced_peak_bytes"] = traced_peak
+
+        return stats
+
+
+# Global memory watchdog instance
+memory_watchdog = MemoryWatchdog()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""
+Shared-Memory Metrics Segment for DeployBot
+
+Writes a tiny fixed-layout, memory-mapped file (~/.deploybot/metrics.mmap)
+holding the backend's vital signs - monitor heartbeat, active timer count and
+the last deploy event sequence number - so the Electron main process can
+answer "is anything happening" by reading 64 bytes from the page cache
+instead of making a WebSocket round trip.
+
+Layout (little-endian, 64-byte segment, seqlock-framed):
+
+    offset  0  u32  magic 0x44424D31 ('DBM1')
+    offset  4  u32  generation
+    offset  8  f64  heartbeat, epoch seconds of the last monitor tick
+    offset 16  u32  active timer count
+    offset 20  u32  writer pid
+    offset 24  u64  last deploy event sequence number
+    offset 32  u32  generation copy (must match offset 4 for a clean read)
+
+The generation is bumped on every write and stored at both ends of the
+payload, so a reader that catches a write mid-copy sees mismatched
+generations and simply retries or keeps its previous sample.
+"""
+
+import mmap
+import os
+import struct
+import time
+from pathlib import Path
+
+import structlog
+
+logger = structlog.get_logger()
+
+METRICS_MAGIC = 0x44424D31  # 'DBM1'
+SEGMENT_SIZE = 64
+SEGMENT_FORMAT = "<IIdIIQI"  # magic, gen, heartbeat, timers, pid, seq, gen
+
+
+class MetricsSegment:
+    """Single-writer shared-memory metrics segment"""
+
+    def __init__(self):
+        self.segment_file = Path.home() / ".deploybot" / "metrics.mmap"
+        self._mmap = None
+        self._generation = 0
+        self._heartbeat = 0.0
+        self._active_timers = 0
+        self._last_event_seq = 0
+
+        logger.info("📊 [METRICS] MetricsSegment initialized",
+                   segment_file=str(self.segment_file))
+
+    def open(self):
+        """Create and map the segment (call once at backend startup)"""
+        try:
+            self.segment_file.parent.mkdir(exist_ok=True)
+            with open(self.segment_file, "wb") as f:
+                f.write(b"\x00" * SEGMENT_SIZE)
+
+            fd = os.open(self.segment_file, os.O_RDWR)
+            try:
+                self._mmap = mmap.mmap(fd, SEGMENT_SIZE)
+            finally:
+                os.close(fd)
+
+            self._write()
+            logger.info("📊 [METRICS] Metrics segment mapped",
+                       segment_file=str(self.segment_file))
+        except Exception as e:
+            # The segment is an optimization - the WebSocket status path
+            # still works without it
+            logger.warning("⚠️ [METRICS] Failed to map metrics segment",
+                          error=str(e))
+            self._mmap = None
+
+    def close(self):
+        """Unmap the segment"""
+        if self._mmap is not None:
+            try:
+                self._mmap.close()
+            except Exception as e:
+                logger.warning("⚠️ [METRICS] Error closing metrics segment",
+                              error=str(e))
+            self._mmap = None
+
+    def heartbeat(self):
+        """Record a monitor loop tick"""
+        self._heartbeat = time.time()
+        self._write()
+
+    def set_active_timers(self, count: int):
+        """Record the current active timer count"""
+        if count != self._active_timers:
+            self._active_timers = count
+            self._write()
+
+    def record_events(self, count: int):
+        """Advance the deploy event sequence number"""
+        if count > 0:
+            self._last_event_seq += count
+            self._write()
+
+    def _write(self):
+        """Publish current values with a seqlock generation bump"""
+        if self._mmap is None:
+            return
+
+        try:
+            self._generation += 1
+            self._mmap[:struct.calcsize(SEGMENT_FORMAT)] = struct.pack(
+                SEGMENT_FORMAT,
+                METRICS_MAGIC,
+                self._generation,
+                self._heartbeat,
+                self._active_timers,
+                os.getpid(),
+                self._last_event_seq,
+                self._generation
+            )
+        except Exception as e:
+            logger.warning("⚠️ [METRICS] Failed to write metrics segment",
+                          error=str(e))
+
+
+# Global metrics segment instance
+metrics_segment = MetricsSegment()
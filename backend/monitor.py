@@ -8,29 +8,252 @@ and integrating with the LangGraph workflow to trigger timer and task selection.
 
 import asyncio
 import json
+import os
+import stat
+import sys
 import time
 import re
+import urllib.parse
+import zlib
+from collections import deque
 from pathlib import Path
-from typing import Dict, Any, Optional, List, Set
+from typing import Dict, Any, Optional, List, Set, Tuple
 from datetime import datetime
 import structlog
 
+from metrics import metrics_segment
+from powerprofile import power_profile
+from supervisor import task_supervisor
+from tracing import latency_tracer
+from loglevels import lazy
+
 logger = structlog.get_logger()
 
+# Precompiled line patterns - classification is a single regex pass per line
+# instead of repeated splits and per-call pattern compilation
+DEPLOY_LINE_PATTERN = re.compile(
+    r'^(?P<timestamp>\d+(?:\.\d+)?)\s+(?P<event>DEPLOY|DEPLOY_COMPLETE):\s*(?P<rest>.*)$'
+)
+CWD_SUFFIX_PATTERN = re.compile(r'^(?P<command>.*?)\s*\[CWD:\s*(?P<cwd>.*?)\]$')
+EXIT_CODE_SUFFIX_PATTERN = re.compile(r'^(?P<command>.*?)\s*\[EXIT_CODE:\s*(?P<code>\d+)\]$')
+
+# Versioned structured event format emitted by the current wrapper (see
+# deploy_wrapper_setup.py): eight space-separated fixed fields with the
+# free-text command and cwd percent-encoded. Parsing is a single split;
+# the regex paths above remain for logs written by older wrappers.
+STRUCTURED_EVENT_PREFIX = "DBEV1 "
+
+# Optional C accelerator for the line-parsing hot path, built against the
+# bundled CPython headers by scripts/setup_python_runtime.js. The pure-Python
+# regex path below stays as the fallback, so the extension is never required.
+try:
+    import _deploy_parse
+    DEPLOY_PARSE_C_AVAILABLE = True
+except ImportError:
+    _deploy_parse = None
+    DEPLOY_PARSE_C_AVAILABLE = False
+
+# Native filesystem event support (FSEvents on macOS, inotify on Linux)
+try:
+    from watchdog.observers import Observer
+    from watchdog.events import FileSystemEventHandler
+    WATCHDOG_AVAILABLE = True
+except ImportError:
+    WATCHDOG_AVAILABLE = False
+
+if WATCHDOG_AVAILABLE:
+    class _DeployLogEventHandler(FileSystemEventHandler):
+        """Bridges watchdog's worker thread into the monitor's asyncio loop"""
+
+        def __init__(self, monitor, loop):
+            super().__init__()
+            self.monitor = monitor
+            self.loop = loop
+
+        def on_modified(self, event):
+            self._dispatch(event)
+
+        def on_created(self, event):
+            self._dispatch(event)
+
+        def _dispatch(self, event):
+            if event.is_directory:
+                return
+            try:
+                self.loop.call_soon_threadsafe(
+                    self.monitor._on_log_file_changed, str(event.src_path)
+                )
+            except RuntimeError:
+                # Event loop already closed during shutdown - nothing to do
+                pass
+
+# Worker co-process for sharded monitoring: tails its assigned deploy logs
+# and emits one JSON line per complete log line on stdout. The worker only
+# does file I/O - parsing, project attribution, callbacks and the WebSocket
+# layer all stay in the main process, so workers need no DeployBot imports.
+# Assignments arrive as JSON ops on stdin ({"op": "add"|"remove", ...}).
+_MONITOR_WORKER_HELPER = '''
+import json
+import os
+import sys
+import threading
+import time
+
+logs = {}   # path -> {"project": name, "pos": offset, "partial": str}
+lock = threading.Lock()
+
+def control_loop():
+    for raw in sys.stdin:
+        try:
+            op = json.loads(raw)
+        except ValueError:
+            continue
+        with lock:
+            if op.get("op") == "add":
+                logs[op["log"]] = {"project": op["project"],
+                                   "pos": int(op.get("pos", 0)), "partial": ""}
+            elif op.get("op") == "remove":
+                logs.pop(op.get("log"), None)
+    os._exit(0)
+
+def emit(project, line, pos):
+    sys.stdout.write(json.dumps({"project": project, "line": line, "pos": pos}) + "\\n")
+
+threading.Thread(target=control_loop, daemon=True).start()
+
+while True:
+    with lock:
+        snapshot = list(logs.items())
+    emitted = False
+    for path, state in snapshot:
+        try:
+            size = os.path.getsize(path)
+        except OSError:
+            continue
+        if size < state["pos"]:
+            # Truncated or replaced - start over from the beginning
+            state["pos"] = 0
+            state["partial"] = ""
+        if size == state["pos"]:
+            continue
+        try:
+            with open(path, "r", errors="replace") as f:
+                f.seek(state["pos"])
+                content = state["partial"] + f.read()
+                state["pos"] = f.tell()
+        except OSError:
+            continue
+        lines = content.split("\\n")
+        state["partial"] = lines.pop()
+        for line in lines:
+            if line.strip():
+                emit(state["project"], line, state["pos"])
+                emitted = True
+    if emitted:
+        sys.stdout.flush()
+    time.sleep(0.5)
+'''
+
 class DeployMonitor:
     """Monitors deploy log files for new deployment events"""
     
     def __init__(self):
         self.monitored_projects = {}  # project_name -> project_info
         self.last_known_positions = {}  # log_file_path -> last_read_position
+        self.offsets_file = Path.home() / ".deploybot" / "monitor_offsets.json"
+        self._persisted_offsets = self._load_persisted_offsets()  # log_file_path -> {position, inode, size}
+        self.read_chunk_size = 64 * 1024  # Stream new log content in fixed-size chunks
+        self._partial_lines = {}  # log_file_path -> incomplete trailing line carried between reads
+        self._log_identities = {}  # log_file_path -> (inode, head_len, head_crc) for rotation detection
+        self._command_matchers = {}  # project_name -> compiled regex over configured deployCommands
         self.monitoring_active = False
         self.monitor_task = None
         self.check_interval = 5.0  # Check every 5 seconds instead of 2
+        self.max_concurrent_checks = 8  # Bound on parallel per-project log checks
+
+        # Adaptive polling: recently active projects poll near min_check_interval,
+        # idle projects decay exponentially toward max_check_interval
+        self.min_check_interval = 0.5
+        self.max_check_interval = 30.0
+        self.poll_backoff_factor = 1.5
         self.event_callbacks = []  # Callbacks for deploy detection events
+
+        # Fixed-size ring buffer of recent deploy events plus versioned status
+        # caching - status queries are served from a cached snapshot that is
+        # only rebuilt when monitor state actually changes
+        self.recent_events = deque(maxlen=200)
+        self.check_durations = deque(maxlen=200)  # Rolling log-check latencies (ms) for perf-stats
+        self._status_version = 0
+        self._status_cache = None
+        self._status_cache_version = -1
+        self._project_status_cache = {}  # project_name -> (version, snapshot)
+
+        # Native filesystem watching (FSEvents/inotify) with polling fallback
+        self.watch_mode = "polling"  # "native" when a watchdog observer is running
+        self._observer = None
+        self._watch_handler = None
+        self._watched_dirs = set()  # directories with an active watchdog schedule
+
+        # FIFO fast path: the deploy wrapper writes each event line to this
+        # named pipe as well as the log file, so detection latency is the
+        # cost of a pipe write instead of a poll interval. The log file
+        # remains the durable record; FIFO-delivered events are remembered
+        # briefly so the log read doesn't dispatch them twice.
+        self.fifo_path = Path.home() / ".deploybot" / "deploy_events.fifo"
+        self._fifo_read_fd = None
+        self._fifo_keepalive_fd = None  # held open so the reader never sees EOF
+        self._fifo_buffer = b""
+        self._fifo_delivered = {}  # (timestamp, type, command) -> delivery time
+        self._fifo_command_projects = {}  # command -> project attributed at deploy start
+
+        # Global log sharding: the wrapper writes unattributed events to a
+        # per-directory shard under here instead of one shared global file
+        self.global_shard_dir = Path.home() / ".deploybot" / "deploy_logs"
+        self.shard_scan_interval = 10.0  # how often the polling loop looks for new shards
+        self._next_shard_scan = 0.0
+
+        # Deploy event deduplication: retries and wrapper re-echoes write the
+        # same logical deploy again within seconds, and each line would run
+        # the whole pipeline (notification, timer, analytics) twice. Events
+        # repeating the same (project, command, phase) inside this window are
+        # absorbed here, before any callback fires. 0 disables the window.
+        self.dedup_window = float(os.environ.get("DEPLOYBOT_DEDUP_WINDOW", "5.0"))
+        self._recent_dispatches = {}  # (project, command key, type) -> monotonic dispatch time
+
+        # Sharded monitoring: past ~100 projects one asyncio process can
+        # saturate a core during deploy bursts, so DEPLOYBOT_MONITOR_WORKERS=N
+        # partitions per-project log tailing across N worker co-processes
+        # (projects assigned by name hash, raw lines fed back over pipes).
+        # 0 disables sharding; the WebSocket/state layer is never sharded.
+        self.worker_count = int(os.environ.get("DEPLOYBOT_MONITOR_WORKERS", "0"))
+        self._worker_procs = {}  # worker index -> subprocess
+        self._worker_reader_tasks = {}  # worker index -> stdout reader task
+        self._worker_assignments = {}  # project_name -> worker index
+
+        # Sampled diagnostics: during deploy storms the per-change info logs
+        # multiply I/O at exactly the wrong moment, so per-change detail is
+        # emitted for 1-in-N changes (and anomalies) while everything else is
+        # folded into one rollup line per interval
+        self.diag_detail_every = 25     # full detail for 1-in-N change events
+        self.diag_rollup_interval = 10.0
+        self.diag_slow_check_ms = 250.0  # a check slower than this always logs
+        self._diag_change_seq = 0
+        self._diag_window = {"checks": 0, "changes": 0, "bytes": 0, "events": 0}
+        self._next_diag_flush = 0.0
+
+        # Sustained load-generation mode built on the simulated-event path:
+        # drives the full pipeline (parse, dispatch, notification, timer,
+        # analytics) at a configured rate while tracking emission drift and
+        # RSS, so a soak run surfaces p99s and memory growth before release
+        self._load_test_task = None
+        self._load_test_stats = None
         
         # Specific callbacks for different event types
         self.deploy_detected_callback = None
         self.deploy_completed_callback = None
+        self.deploy_batch_callback = None  # optional - receives coalesced event lists
+        self.todo_changed_callback = None  # optional - fires when a project's TODO.md changes
+        self.config_changed_callback = None  # optional - fires when a project's config.json changes
         
         logger.info("🔍 [DEPLOY_MONITOR] DeployMonitor initialized")
     
@@ -44,6 +267,33 @@ class DeployMonitor:
         self.deploy_completed_callback = callback
         logger.info("📡 [DEPLOY_MONITOR] Deploy completed callback set")
 
+    def set_deploy_batch_callback(self, callback):
+        """Set callback that receives coalesced batches of deploy events"""
+        self.deploy_batch_callback = callback
+        logger.info("📡 [DEPLOY_MONITOR] Deploy batch callback set")
+
+    def set_todo_changed_callback(self, callback):
+        """Set callback invoked when a monitored project's TODO.md changes"""
+        self.todo_changed_callback = callback
+        logger.info("📡 [DEPLOY_MONITOR] TODO changed callback set")
+
+    def set_config_changed_callback(self, callback):
+        """Set callback invoked when a monitored project's config.json changes"""
+        self.config_changed_callback = callback
+        logger.info("📡 [DEPLOY_MONITOR] Config changed callback set")
+
+    def reload_project_config(self, project_name: str, config: Dict[str, Any]):
+        """Apply an externally edited config to a monitored project"""
+        project_info = self.monitored_projects.get(project_name)
+        if not project_info:
+            return
+
+        project_info["config"] = config
+        self._command_matchers[project_name] = self._build_command_matcher(config)
+        self._bump_status_version()
+        logger.info("🔄 [DEPLOY_MONITOR] Project config reloaded",
+                   project_name=project_name)
+
     def add_event_callback(self, callback):
         """Add a callback function to be called when deploy events are detected"""
         self.event_callbacks.append(callback)
@@ -98,24 +348,45 @@ class DeployMonitor:
                 "config": config,
                 "deploy_log": str(deploy_log),
                 "last_deploy_time": None,
-                "deploy_count": 0
+                "deploy_count": 0,
+                "poll_interval": self.check_interval,
+                "next_check_time": 0.0
             }
-            
+
             self.monitored_projects[project_name] = project_info
-            
+
+            # Compile the configured deploy commands into one matcher so line
+            # classification is a single pass instead of N substring scans
+            self._command_matchers[project_name] = self._build_command_matcher(config)
+
             # Initialize log position tracking
             if deploy_log.exists():
-                # Start monitoring from the end of existing log
-                self.last_known_positions[str(deploy_log)] = deploy_log.stat().st_size
-                logger.info("📏 [DEPLOY_MONITOR] Starting from end of existing log", 
-                           position=deploy_log.stat().st_size)
+                # Resume from the persisted offset when valid, otherwise from the end
+                position = self._restore_log_position(deploy_log)
+                self.last_known_positions[str(deploy_log)] = position
+                log_stat = deploy_log.stat()
+                self._log_identities[str(deploy_log)] = self._fingerprint_log(
+                    deploy_log, log_stat.st_ino, log_stat.st_size)
+                logger.info("📏 [DEPLOY_MONITOR] Initialized log position",
+                           position=position, log_size=log_stat.st_size)
             else:
                 # Create empty log file and start from position 0
                 deploy_log.touch()
                 self.last_known_positions[str(deploy_log)] = 0
                 logger.info("📄 [DEPLOY_MONITOR] Created new deploy log file")
             
-            logger.info("✅ [DEPLOY_MONITOR] Project added successfully", 
+            # If native watching is already active, start watching this log
+            # and the project root (for TODO.md changes) too
+            self._watch_project_log(str(deploy_log))
+            self._watch_project_dir(str(project_path_obj))
+
+            # In sharding mode the new project's log is tailed by its worker
+            if self._worker_procs:
+                await self._assign_project_to_worker(project_name, project_info)
+
+            self._bump_status_version()
+
+            logger.info("✅ [DEPLOY_MONITOR] Project added successfully",
                        project_name=project_name, deploy_log=str(deploy_log))
             return True
             
@@ -136,11 +407,17 @@ class DeployMonitor:
             # Clean up position tracking
             if deploy_log in self.last_known_positions:
                 del self.last_known_positions[deploy_log]
-            
+            self._partial_lines.pop(deploy_log, None)
+            self._log_identities.pop(deploy_log, None)
+            self._command_matchers.pop(project_name, None)
+            await self._unassign_project_from_worker(project_name, deploy_log)
+
             # Remove project
             del self.monitored_projects[project_name]
-            
-            logger.info("✅ [DEPLOY_MONITOR] Project removed successfully", 
+            self._project_status_cache.pop(project_name, None)
+            self._bump_status_version()
+
+            logger.info("✅ [DEPLOY_MONITOR] Project removed successfully",
                        project_name=project_name)
             return True
         else:
@@ -158,13 +435,152 @@ class DeployMonitor:
         
         # Add global deploy log monitoring as fallback
         await self._add_global_log_monitoring()
-        
+
+        # FIFO fast path for wrapper-originated events; the log file remains
+        # the durable record and keeps being read as before
+        self._start_fifo_listener()
+
         self.monitoring_active = True
-        self.monitor_task = asyncio.create_task(self._monitoring_loop())
-        
-        logger.info("✅ [DEPLOY_MONITOR] Deploy monitoring started successfully")
+
+        # Sharding mode: per-project log tailing moves into worker
+        # co-processes, so the local loop only covers global logs and any
+        # projects that fall back when a worker dies. The native watcher is
+        # skipped - it would race the workers on the same files.
+        if self.worker_count > 0 and await self._start_monitor_workers():
+            self.monitor_task = task_supervisor.spawn(
+                "monitor_polling_loop", self._monitoring_loop)
+            logger.info("🧩 [DEPLOY_MONITOR] Using sharded worker monitoring",
+                       workers=self.worker_count,
+                       assigned=len(self._worker_assignments))
+        # Prefer native filesystem events; fall back to the polling loop
+        elif self._start_native_watcher():
+            logger.info("👁️ [DEPLOY_MONITOR] Using native filesystem events (FSEvents/inotify)")
+        else:
+            self.monitor_task = task_supervisor.spawn(
+                "monitor_polling_loop", self._monitoring_loop)
+            logger.info("🔄 [DEPLOY_MONITOR] Using polling fallback",
+                       check_interval=self.check_interval)
+
+        self._bump_status_version()
+
+        logger.info("✅ [DEPLOY_MONITOR] Deploy monitoring started successfully",
+                   watch_mode=self.watch_mode)
         return True
 
+    def _start_native_watcher(self) -> bool:
+        """Start a watchdog observer over all monitored deploy log directories"""
+        if not WATCHDOG_AVAILABLE:
+            logger.info("📡 [DEPLOY_MONITOR] watchdog library not available - polling fallback only")
+            return False
+
+        try:
+            loop = asyncio.get_running_loop()
+            self._observer = Observer()
+            handler = _DeployLogEventHandler(self, loop)
+
+            for project_info in self.monitored_projects.values():
+                log_dir = str(Path(project_info["deploy_log"]).parent)
+                if log_dir not in self._watched_dirs:
+                    self._observer.schedule(handler, log_dir, recursive=False)
+                    self._watched_dirs.add(log_dir)
+
+                # Watch the project root too so TODO.md edits can push fresh
+                # task statistics instead of waiting for the next UI refresh
+                project_dir = project_info.get("path")
+                if project_dir and project_dir not in self._watched_dirs:
+                    self._observer.schedule(handler, project_dir, recursive=False)
+                    self._watched_dirs.add(project_dir)
+
+            self._observer.start()
+            self._watch_handler = handler
+            self.watch_mode = "native"
+
+            logger.info("✅ [DEPLOY_MONITOR] Native watcher started",
+                       watched_dirs=len(self._watched_dirs))
+            return True
+
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Failed to start native watcher, falling back to polling",
+                          error=str(e))
+            self._observer = None
+            self._watched_dirs.clear()
+            self.watch_mode = "polling"
+            return False
+
+    def _watch_project_log(self, deploy_log: str):
+        """Register a newly added project's log directory with the running observer"""
+        if not self._observer:
+            return
+
+        log_dir = str(Path(deploy_log).parent)
+        if log_dir in self._watched_dirs:
+            return
+
+        try:
+            self._observer.schedule(self._watch_handler, log_dir, recursive=False)
+            self._watched_dirs.add(log_dir)
+            logger.debug("👁️ [DEPLOY_MONITOR] Watching new log directory", log_dir=log_dir)
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Failed to watch log directory",
+                          log_dir=log_dir, error=str(e))
+
+    def _watch_project_dir(self, project_dir: str):
+        """Register a project's root directory with the running observer"""
+        if not self._observer or project_dir in self._watched_dirs:
+            return
+
+        try:
+            self._observer.schedule(self._watch_handler, project_dir, recursive=False)
+            self._watched_dirs.add(project_dir)
+            logger.debug("👁️ [DEPLOY_MONITOR] Watching project directory", project_dir=project_dir)
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Failed to watch project directory",
+                          project_dir=project_dir, error=str(e))
+
+    def _on_log_file_changed(self, changed_path: str):
+        """Called on the event loop when a watched file changes (thread-safe entry point)"""
+        if not self.monitoring_active:
+            return
+
+        # Any change in a watched project root makes that project's file
+        # index stale; the next relevant-file lookup rebuilds it
+        changed = Path(changed_path)
+        changed_parent = str(changed.parent)
+        for project_info in self.monitored_projects.values():
+            if project_info.get("path") == changed_parent:
+                from fileindex import project_file_index
+                project_file_index.invalidate(changed_parent)
+                break
+
+        # TODO.md and config.json edits in a watched project root fire their
+        # respective hot-reload callbacks
+        if changed.name in ("TODO.md", "config.json"):
+            callback = (self.todo_changed_callback if changed.name == "TODO.md"
+                        else self.config_changed_callback)
+            if callback:
+                parent = str(changed.parent)
+                for project_name, project_info in self.monitored_projects.items():
+                    if project_info.get("path") == parent:
+                        asyncio.create_task(callback(project_name, changed_path))
+                        return
+
+        for project_name, project_info in self.monitored_projects.items():
+            if project_info["deploy_log"] == changed_path:
+                logger.debug("📳 [DEPLOY_MONITOR] Filesystem event for monitored log",
+                            project_name=project_name)
+                asyncio.create_task(self._check_project_for_deploys(project_name, project_info))
+                return
+
+        # A brand-new shard file appearing in the shard directory won't be
+        # registered yet - pick it up and dispatch the event that created it
+        changed = Path(changed_path)
+        if changed.parent == self.global_shard_dir and changed.suffix == ".txt":
+            self._refresh_global_shards()
+            shard_name = f"_shard:{changed.name}"
+            project_info = self.monitored_projects.get(shard_name)
+            if project_info:
+                asyncio.create_task(self._check_project_for_deploys(shard_name, project_info))
+
     async def _add_global_log_monitoring(self):
         """Add monitoring for the global deploy log as a fallback"""
         global_log_dir = Path.home() / ".deploybot"
@@ -182,18 +598,396 @@ class DeployMonitor:
             "config": {"type": "global_fallback"},
             "deploy_log": str(global_log),
             "last_deploy_time": None,
-            "deploy_count": 0
+            "deploy_count": 0,
+            "poll_interval": self.check_interval,
+            "next_check_time": 0.0
         }
         
-        # Initialize position tracking
+        # Initialize position tracking, resuming from a persisted offset when valid
         if global_log.exists():
-            self.last_known_positions[str(global_log)] = global_log.stat().st_size
+            self.last_known_positions[str(global_log)] = self._restore_log_position(global_log)
         else:
             self.last_known_positions[str(global_log)] = 0
             
-        logger.info("🌐 [DEPLOY_MONITOR] Added global log monitoring", 
+        logger.info("🌐 [DEPLOY_MONITOR] Added global log monitoring",
                    global_log=str(global_log))
 
+        # Per-directory shard files written by the current wrapper; the
+        # single global log above remains for lines from older wrappers
+        self._refresh_global_shards()
+
+    def _flush_diag_rollup(self, now: float):
+        """Emit one aggregate line per interval in place of per-change logs"""
+        if now < self._next_diag_flush:
+            return
+        self._next_diag_flush = now + self.diag_rollup_interval
+
+        window = self._diag_window
+        if window["changes"] == 0:
+            # Idle interval - reset the check count silently
+            window["checks"] = 0
+            return
+
+        logger.info("📊 [DEPLOY_MONITOR] Activity rollup",
+                   checks=window["checks"],
+                   changes=window["changes"],
+                   new_bytes=window["bytes"],
+                   events=window["events"],
+                   window_seconds=self.diag_rollup_interval)
+        self._diag_window = {"checks": 0, "changes": 0, "bytes": 0, "events": 0}
+
+    def _refresh_global_shards(self):
+        """
+        Register any new shard files under the global shard directory.
+
+        The wrapper picks a shard from its CWD when no project structure is
+        found, so attribution stays per-directory and one noisy project
+        can't inflate the scan cost of everyone sharing a single global log.
+        Shards are monitored like the global pseudo-project.
+        """
+        try:
+            self.global_shard_dir.mkdir(exist_ok=True)
+            for shard_log in self.global_shard_dir.glob("*.txt"):
+                shard_name = f"_shard:{shard_log.name}"
+                if shard_name in self.monitored_projects:
+                    continue
+
+                self.monitored_projects[shard_name] = {
+                    "name": shard_name,
+                    "path": str(self.global_shard_dir),
+                    "config": {"type": "global_shard"},
+                    "deploy_log": str(shard_log),
+                    "last_deploy_time": None,
+                    "deploy_count": 0,
+                    "poll_interval": self.check_interval,
+                    "next_check_time": 0.0
+                }
+                self.last_known_positions[str(shard_log)] = self._restore_log_position(shard_log)
+                self._watch_project_log(str(shard_log))
+
+                logger.info("🧩 [DEPLOY_MONITOR] Registered global shard log",
+                           shard=shard_log.name)
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Failed to scan shard directory",
+                          error=str(e))
+
+    def _start_fifo_listener(self) -> bool:
+        """
+        Open the deploy-event FIFO and register it with the event loop.
+
+        The wrapper writes each event line here in addition to the log file,
+        so detection latency is the cost of a pipe write instead of a poll
+        interval or filesystem-event debounce. A write end is held open by
+        the monitor itself so the reader never sees EOF when wrappers exit.
+        """
+        try:
+            self.fifo_path.parent.mkdir(exist_ok=True)
+            if self.fifo_path.exists() and not stat.S_ISFIFO(os.stat(self.fifo_path).st_mode):
+                self.fifo_path.unlink()
+            if not self.fifo_path.exists():
+                os.mkfifo(self.fifo_path)
+
+            self._fifo_read_fd = os.open(self.fifo_path, os.O_RDONLY | os.O_NONBLOCK)
+            self._fifo_keepalive_fd = os.open(self.fifo_path, os.O_WRONLY | os.O_NONBLOCK)
+
+            loop = asyncio.get_running_loop()
+            loop.add_reader(self._fifo_read_fd, self._on_fifo_readable)
+
+            logger.info("🚇 [DEPLOY_MONITOR] FIFO fast path listening",
+                       fifo=str(self.fifo_path))
+            return True
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] FIFO fast path unavailable - log polling only",
+                          error=str(e))
+            self._stop_fifo_listener()
+            return False
+
+    def _stop_fifo_listener(self):
+        """Tear down the FIFO fast path"""
+        if self._fifo_read_fd is not None:
+            try:
+                asyncio.get_running_loop().remove_reader(self._fifo_read_fd)
+            except Exception:
+                pass
+            try:
+                os.close(self._fifo_read_fd)
+            except OSError:
+                pass
+            self._fifo_read_fd = None
+
+        if self._fifo_keepalive_fd is not None:
+            try:
+                os.close(self._fifo_keepalive_fd)
+            except OSError:
+                pass
+            self._fifo_keepalive_fd = None
+
+        self._fifo_buffer = b""
+
+    def _on_fifo_readable(self):
+        """Drain the FIFO and dispatch each complete event line"""
+        try:
+            chunk = os.read(self._fifo_read_fd, 65536)
+        except BlockingIOError:
+            return
+        except OSError as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] FIFO read failed", error=str(e))
+            return
+
+        if not chunk:
+            return
+
+        self._fifo_buffer += chunk
+        while b"\n" in self._fifo_buffer:
+            raw_line, self._fifo_buffer = self._fifo_buffer.split(b"\n", 1)
+            line = raw_line.decode('utf-8', errors='replace').strip()
+            if line:
+                asyncio.create_task(self._handle_fifo_event(line))
+
+    async def _handle_fifo_event(self, line: str):
+        """Attribute and dispatch one event line received via the FIFO"""
+        try:
+            probe = self._parse_deploy_line(line, "_global")
+            if not probe:
+                return
+
+            project_name = self._attribute_fifo_event(probe)
+            if project_name is None:
+                return
+            project_info = self.monitored_projects.get(project_name)
+            if project_info is None:
+                return
+
+            event = self._parse_deploy_line(line, project_name)
+            if not event:
+                return
+
+            # Remember the event so the log read doesn't dispatch it again
+            self._mark_fifo_delivered(event)
+
+            logger.info("🚇 [DEPLOY_MONITOR] Deploy event via FIFO fast path",
+                       project_name=project_name, event_type=event["type"])
+            await self._dispatch_deploy_events([event], project_info)
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Error handling FIFO event",
+                          line=line, error=str(e))
+
+    def _attribute_fifo_event(self, event: Dict[str, Any]) -> Optional[str]:
+        """
+        Map a FIFO event to a monitored project.
+
+        Structured events name the project directory and carry the wrapper's
+        CWD on both phases. Legacy events are matched by longest project
+        path on the start's CWD; legacy completions carry no CWD and reuse
+        the project recorded at start. Anything else falls back to the
+        global pseudo-project, matching how unattributed lines in the
+        global log are handled.
+        """
+        # Structured events name the project directory outright
+        wrapper_project = event.get("wrapper_project")
+        if wrapper_project and wrapper_project in self.monitored_projects:
+            return wrapper_project
+
+        if event.get("cwd"):
+            cwd = event["cwd"]
+            best_name = None
+            best_path_len = -1
+            for name, info in self.monitored_projects.items():
+                if name == "_global":
+                    continue
+                project_path = info.get("path")
+                if project_path and (cwd == project_path or
+                                     cwd.startswith(project_path + os.sep)):
+                    if len(project_path) > best_path_len:
+                        best_name = name
+                        best_path_len = len(project_path)
+
+            if best_name:
+                if event["type"] == "deploy_start":
+                    self._fifo_command_projects[event["command"]] = best_name
+                else:
+                    self._fifo_command_projects.pop(event["command"], None)
+                return best_name
+        elif event["type"] == "deploy_complete":
+            remembered = self._fifo_command_projects.pop(event["command"], None)
+            if remembered and remembered in self.monitored_projects:
+                return remembered
+
+        return "_global" if "_global" in self.monitored_projects else None
+
+    def _mark_fifo_delivered(self, event: Dict[str, Any]):
+        """Record a FIFO-delivered event and prune stale entries"""
+        now = time.monotonic()
+        key = (round(event["timestamp"], 3), event["type"], event["command"])
+        self._fifo_delivered[key] = now
+
+        if len(self._fifo_delivered) > 64:
+            cutoff = now - 60.0
+            self._fifo_delivered = {
+                k: t for k, t in self._fifo_delivered.items() if t > cutoff
+            }
+
+    def _was_delivered_via_fifo(self, event: Dict[str, Any]) -> bool:
+        """Check whether the log read re-parsed an event the FIFO already delivered"""
+        key = (round(event["timestamp"], 3), event["type"], event["command"])
+        return self._fifo_delivered.pop(key, None) is not None
+
+    async def ingest_remote_events(self, lines: List[str], source: str = "remote") -> int:
+        """
+        Dispatch deploy event lines forwarded by a remote agent.
+
+        Remote events ride the same attribution/dedup path as FIFO events:
+        structured DBEV1 lines name their project directly, so a CI box
+        running the standard wrapper needs nothing beyond the agent
+        forwarding its log lines.
+        """
+        accepted = 0
+        for line in lines:
+            line = line.strip()
+            if not line:
+                continue
+            probe = self._parse_deploy_line(line, "_global")
+            if not probe:
+                continue
+            accepted += 1
+            await self._handle_fifo_event(line)
+
+        if accepted:
+            logger.info("🌐 [DEPLOY_MONITOR] Remote deploy events ingested",
+                       source=source, accepted=accepted, received=len(lines))
+        return accepted
+
+    # ------------------------------------------------------------------
+    # Sharded worker monitoring
+    # ------------------------------------------------------------------
+
+    def _worker_for(self, project_name: str) -> int:
+        """Stable hash partition of a project onto one worker"""
+        return zlib.crc32(project_name.encode("utf-8")) % self.worker_count
+
+    async def _start_monitor_workers(self) -> bool:
+        """Spawn the worker co-processes and assign every monitored project"""
+        try:
+            for index in range(self.worker_count):
+                proc = await asyncio.create_subprocess_exec(
+                    sys.executable, "-c", _MONITOR_WORKER_HELPER,
+                    stdin=asyncio.subprocess.PIPE,
+                    stdout=asyncio.subprocess.PIPE,
+                    stderr=asyncio.subprocess.DEVNULL
+                )
+                self._worker_procs[index] = proc
+                self._worker_reader_tasks[index] = task_supervisor.spawn(
+                    f"monitor_worker_{index}",
+                    lambda index=index, proc=proc: self._consume_worker_output(index, proc))
+
+            # Global pseudo-projects ("_global" and shard entries) keep their
+            # cheap local polling - only real projects move to workers
+            for project_name, project_info in list(self.monitored_projects.items()):
+                if project_name.startswith("_"):
+                    continue
+                await self._assign_project_to_worker(project_name, project_info)
+
+            logger.info("🧩 [DEPLOY_MONITOR] Monitor workers started",
+                       workers=self.worker_count,
+                       assigned=len(self._worker_assignments))
+            return True
+
+        except Exception as e:
+            logger.error("❌ [DEPLOY_MONITOR] Failed to start monitor workers - using local monitoring",
+                        error=str(e))
+            await self._stop_monitor_workers()
+            return False
+
+    async def _assign_project_to_worker(self, project_name: str, project_info: Dict[str, Any]):
+        """Hand one project's log tailing to its hash-assigned worker"""
+        index = self._worker_for(project_name)
+        proc = self._worker_procs.get(index)
+        if not proc or proc.returncode is not None:
+            return
+
+        deploy_log = project_info["deploy_log"]
+        op = {"op": "add", "project": project_name, "log": deploy_log,
+              "pos": self.last_known_positions.get(deploy_log, 0)}
+        try:
+            proc.stdin.write((json.dumps(op) + "\n").encode("utf-8"))
+            await proc.stdin.drain()
+            self._worker_assignments[project_name] = index
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Could not assign project to worker - keeping local polling",
+                          project_name=project_name, worker=index, error=str(e))
+
+    async def _unassign_project_from_worker(self, project_name: str, deploy_log: str):
+        """Tell the assigned worker to stop tailing a removed project's log"""
+        index = self._worker_assignments.pop(project_name, None)
+        if index is None:
+            return
+        proc = self._worker_procs.get(index)
+        if proc and proc.returncode is None:
+            try:
+                proc.stdin.write((json.dumps({"op": "remove", "log": deploy_log}) + "\n").encode("utf-8"))
+                await proc.stdin.drain()
+            except Exception:
+                pass
+
+    async def _consume_worker_output(self, index: int, proc):
+        """Feed raw lines from one worker through the normal dispatch pipeline"""
+        try:
+            while True:
+                raw = await proc.stdout.readline()
+                if not raw:
+                    break
+                try:
+                    payload = json.loads(raw)
+                except ValueError:
+                    continue
+
+                project_info = self.monitored_projects.get(payload.get("project"))
+                if not project_info:
+                    continue
+
+                # Track the worker's offset so persistence and any fallback
+                # to local polling resume where the worker left off
+                pos = payload.get("pos")
+                if isinstance(pos, int):
+                    self.last_known_positions[project_info["deploy_log"]] = pos
+
+                events = self._parse_deploy_events(payload.get("line", "") + "\n",
+                                                   project_info["name"])
+                if events:
+                    self._diag_window["events"] += len(events)
+                    await self._dispatch_deploy_events(events, project_info)
+        except asyncio.CancelledError:
+            raise
+        except Exception as e:
+            logger.error("❌ [DEPLOY_MONITOR] Monitor worker reader failed",
+                        worker=index, error=str(e))
+
+        # Worker gone (crash or shutdown): while monitoring is still active
+        # its projects fall back to local polling in the main loop
+        if self.monitoring_active and self._worker_procs.get(index) is proc:
+            self._worker_procs.pop(index, None)
+            fallback = [name for name, i in self._worker_assignments.items() if i == index]
+            for name in fallback:
+                self._worker_assignments.pop(name, None)
+            logger.warning("⚠️ [DEPLOY_MONITOR] Monitor worker exited - projects fall back to local polling",
+                          worker=index, projects=len(fallback))
+            self._bump_status_version()
+
+    async def _stop_monitor_workers(self):
+        """Cancel reader tasks and terminate every worker co-process"""
+        for task in self._worker_reader_tasks.values():
+            task.cancel()
+        self._worker_reader_tasks.clear()
+
+        for proc in self._worker_procs.values():
+            if proc.returncode is None:
+                try:
+                    proc.terminate()
+                except ProcessLookupError:
+                    pass
+        self._worker_procs.clear()
+        self._worker_assignments.clear()
+
     async def stop_monitoring(self) -> bool:
         """Stop the deploy monitoring loop"""
         if not self.monitoring_active:
@@ -203,7 +997,7 @@ class DeployMonitor:
         logger.info("🛑 [DEPLOY_MONITOR] Stopping deploy monitoring...")
         
         self.monitoring_active = False
-        
+
         if self.monitor_task:
             self.monitor_task.cancel()
             try:
@@ -211,7 +1005,23 @@ class DeployMonitor:
             except asyncio.CancelledError:
                 pass
             self.monitor_task = None
-        
+
+        # Shut down the native watcher if one is running
+        if self._observer:
+            try:
+                self._observer.stop()
+                self._observer.join(timeout=5)
+            except Exception as e:
+                logger.warning("⚠️ [DEPLOY_MONITOR] Error stopping native watcher", error=str(e))
+            self._observer = None
+            self._watched_dirs.clear()
+            self.watch_mode = "polling"
+
+        self._stop_fifo_listener()
+        await self._stop_monitor_workers()
+
+        self._bump_status_version()
+
         logger.info("✅ [DEPLOY_MONITOR] Deploy monitoring stopped successfully")
         return True
 
@@ -219,14 +1029,44 @@ class DeployMonitor:
         """Main monitoring loop that checks for new deploy events"""
         logger.info("🔄 [DEPLOY_MONITOR] Starting monitoring loop...")
         
+        # Bound concurrency so one slow project (e.g. an NFS-mounted log) can't
+        # stall deploy detection for the others, without unbounded task fan-out
+        semaphore = asyncio.Semaphore(self.max_concurrent_checks)
+
+        async def check_with_limit(project_name, project_info):
+            async with semaphore:
+                event_count = await self._check_project_for_deploys(project_name, project_info)
+            self._adapt_poll_interval(project_info, event_count)
+
         while self.monitoring_active:
             try:
-                # Check all monitored projects for new deploy events
-                for project_name, project_info in self.monitored_projects.items():
-                    await self._check_project_for_deploys(project_name, project_info)
-                
-                # Wait before next check
-                await asyncio.sleep(self.check_interval)
+                # Publish the heartbeat to the shared metrics segment so the
+                # Electron side sees monitor liveness without a round trip
+                metrics_segment.heartbeat()
+
+                # Check only the projects whose adaptive interval has elapsed -
+                # hot projects poll sub-second while idle ones decay to 30s+
+                now = time.monotonic()
+                if now >= self._next_shard_scan:
+                    self._refresh_global_shards()
+                    self._next_shard_scan = now + self.shard_scan_interval
+                self._flush_diag_rollup(now)
+                checks = [
+                    check_with_limit(project_name, project_info)
+                    for project_name, project_info in list(self.monitored_projects.items())
+                    if project_info.get("next_check_time", 0.0) <= now
+                    and project_name not in self._worker_assignments
+                ]
+                if checks:
+                    await asyncio.gather(*checks)
+
+                # Short tick so newly-hot projects are picked up promptly;
+                # on battery the tick stretches so polling wakeups drop while
+                # the FIFO fast path and native watcher stay evented
+                tick = self.min_check_interval
+                if power_profile.low_power_active:
+                    tick *= power_profile.cadence_factor
+                await asyncio.sleep(tick)
                 
             except asyncio.CancelledError:
                 logger.info("🔄 [DEPLOY_MONITOR] Monitoring loop cancelled")
@@ -236,8 +1076,26 @@ class DeployMonitor:
                 # Continue monitoring despite errors
                 await asyncio.sleep(self.check_interval * 2)  # Wait longer after errors
 
-    async def _check_project_for_deploys(self, project_name: str, project_info: Dict[str, Any]):
-        """Check a specific project's deploy log for new events"""
+    def _adapt_poll_interval(self, project_info: Dict[str, Any], event_count: int):
+        """
+        Adjust a project's polling interval based on observed activity.
+
+        A check that found events snaps the interval back to min_check_interval;
+        quiet checks back off exponentially toward max_check_interval so idle
+        projects cost almost nothing in steady state.
+        """
+        interval = project_info.get("poll_interval", self.check_interval)
+
+        if event_count:
+            interval = self.min_check_interval
+        else:
+            interval = min(interval * self.poll_backoff_factor, self.max_check_interval)
+
+        project_info["poll_interval"] = interval
+        project_info["next_check_time"] = time.monotonic() + interval
+
+    async def _check_project_for_deploys(self, project_name: str, project_info: Dict[str, Any]) -> int:
+        """Check a specific project's deploy log for new events, returning the event count"""
         deploy_log_path = project_info["deploy_log"]
         
         try:
@@ -245,151 +1103,545 @@ class DeployMonitor:
             
             if not deploy_log.exists():
                 # Log file doesn't exist yet, skip
-                return
+                return 0
             
-            current_size = deploy_log.stat().st_size
+            stat_result = deploy_log.stat()
+            current_size = stat_result.st_size
             last_position = self.last_known_positions.get(deploy_log_path, 0)
+
+            # Rotation/truncation detection: an externally rotated or
+            # truncated log used to look like "no new content" until it
+            # regrew past the stale offset - a correctness hole and a
+            # latency cliff under logrotate. Inode + head-CRC identity
+            # catches every replacement flavor in O(1).
+            if self._detect_log_replacement(deploy_log, deploy_log_path,
+                                            stat_result.st_ino, current_size,
+                                            last_position):
+                logger.info("🔄 [DEPLOY_MONITOR] Deploy log rotated/truncated - resetting offset",
+                           project_name=project_name,
+                           old_position=last_position,
+                           new_size=current_size)
+                last_position = 0
+                self.last_known_positions[deploy_log_path] = 0
+                self._partial_lines.pop(deploy_log_path, None)
             
-            # DEBUG: Add detailed logging for file monitoring
-            logger.debug("🔍 [DEPLOY_MONITOR] Checking project for changes", 
+            # DEBUG: per-check diagnostics; lazy fields are only evaluated
+            # when DEPLOY_MONITOR is raised to debug via set-log-level
+            logger.debug("🔍 [DEPLOY_MONITOR] Checking project for changes",
                         project_name=project_name,
                         deploy_log_path=deploy_log_path,
                         current_size=current_size,
                         last_position=last_position,
-                        size_changed=current_size > last_position)
+                        size_changed=lazy(lambda: current_size > last_position))
             
+            self._diag_window["checks"] += 1
+
             if current_size <= last_position:
                 # No new content
-                return
-            
-            logger.info("📈 [DEPLOY_MONITOR] File size change detected", 
-                       project_name=project_name,
-                       current_size=current_size,
-                       last_position=last_position,
-                       new_bytes=current_size - last_position)
-            
-            # Read new content
-            with open(deploy_log, 'r', encoding='utf-8') as f:
-                f.seek(last_position)
-                new_content = f.read()
-            
-            logger.info("📝 [DEPLOY_MONITOR] Read new content", 
-                       project_name=project_name,
-                       content_length=len(new_content),
-                       content_preview=repr(new_content[:100] + "..." if len(new_content) > 100 else new_content))
-            
-            # Update position
-            self.last_known_positions[deploy_log_path] = current_size
-            
-            # Parse new deploy events
-            new_events = self._parse_deploy_events(new_content, project_name)
-            
-            logger.info("🔍 [DEPLOY_MONITOR] Parsed events", 
-                       project_name=project_name,
-                       event_count=len(new_events),
-                       events=[{
-                           "type": event.get("type"),
-                           "command": event.get("command"),
-                           "timestamp": event.get("timestamp")
-                       } for event in new_events])
+                return 0
+
+            # Per-change detail is sampled; the rest lands in the rollup
+            new_bytes = current_size - last_position
+            self._diag_change_seq += 1
+            detailed = self._diag_change_seq % self.diag_detail_every == 1
+
+            if detailed:
+                logger.info("📈 [DEPLOY_MONITOR] File size change detected",
+                           project_name=project_name,
+                           current_size=current_size,
+                           last_position=last_position,
+                           new_bytes=new_bytes)
             
-            # Process each new event
-            for event in new_events:
-                logger.info("🚀 [DEPLOY_MONITOR] Processing event", 
+            # Stream new content in fixed-size chunks, collecting the events
+            # from this read so they can be delivered as one coalesced batch
+            check_start = time.perf_counter()
+            events = []
+            for line in self._read_new_lines(deploy_log, deploy_log_path):
+                event = self._parse_deploy_line(line, project_name)
+                if event:
+                    events.append(event)
+
+            # Drop events the FIFO fast path already delivered
+            if events and self._fifo_delivered:
+                events = [e for e in events if not self._was_delivered_via_fifo(e)]
+
+            await self._dispatch_deploy_events(events, project_info)
+
+            # Record how long processing the new content took so perf-stats can
+            # report percentiles for the monitor's hot path
+            duration_ms = (time.perf_counter() - check_start) * 1000
+            self.check_durations.append(duration_ms)
+
+            self._diag_window["changes"] += 1
+            self._diag_window["bytes"] += new_bytes
+            self._diag_window["events"] += len(events)
+
+            # Anomalies always get full detail, sampled or not
+            if duration_ms >= self.diag_slow_check_ms:
+                detailed = True
+
+            if detailed:
+                logger.info("🔍 [DEPLOY_MONITOR] Finished processing new log content",
                            project_name=project_name,
-                           event_type=event.get("type"),
-                           command=event.get("command"))
-                await self._handle_deploy_event(event, project_info)
-                
+                           event_count=len(events),
+                           new_position=self.last_known_positions.get(deploy_log_path, 0),
+                           duration_ms=round(duration_ms, 1))
+            return len(events)
+
         except Exception as e:
-            logger.error("❌ [DEPLOY_MONITOR] Error checking project deploys", 
+            logger.error("❌ [DEPLOY_MONITOR] Error checking project deploys",
                         project_name=project_name, error=str(e))
             import traceback
             logger.error("❌ [DEPLOY_MONITOR] Full traceback", traceback=traceback.format_exc())
+            return 0
+
+    def _read_new_lines(self, deploy_log: Path, deploy_log_path: str):
+        """
+        Incrementally yield complete lines appended since the last read.
+
+        Reads in fixed-size chunks so memory stays flat regardless of burst size,
+        and carries an incomplete trailing line over to the next read instead of
+        splitting an event across two polls. Updates last_known_positions to the
+        consumed offset once the new content is drained.
+        """
+        carry = self._partial_lines.get(deploy_log_path, "")
+        last_position = self.last_known_positions.get(deploy_log_path, 0)
+
+        with open(deploy_log, 'r', encoding='utf-8') as f:
+            f.seek(last_position)
+
+            while True:
+                chunk = f.read(self.read_chunk_size)
+                if not chunk:
+                    break
+
+                carry += chunk
+                lines = carry.split('\n')
+                carry = lines.pop()  # incomplete trailing line (or "" if chunk ended on \n)
+
+                for line in lines:
+                    if line.strip():
+                        yield line
+
+            # Position reflects everything consumed; the carried partial line is
+            # kept in memory and re-joined when the rest of it arrives
+            self.last_known_positions[deploy_log_path] = f.tell()
+
+        self._partial_lines[deploy_log_path] = carry
+        self._persist_offset(deploy_log, deploy_log_path)
+
+    def _load_persisted_offsets(self) -> Dict[str, Any]:
+        """Load the persisted per-log offset store from ~/.deploybot"""
+        try:
+            if self.offsets_file.exists():
+                with open(self.offsets_file, 'r') as f:
+                    offsets = json.load(f)
+                logger.info("📂 [DEPLOY_MONITOR] Loaded persisted log offsets",
+                           entry_count=len(offsets))
+                return offsets
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Failed to load persisted offsets, starting fresh",
+                          error=str(e))
+        return {}
+
+    def _restore_log_position(self, deploy_log: Path) -> int:
+        """
+        Return the position to resume reading a deploy log from.
+
+        Uses the persisted offset when the stored inode still matches and the
+        file has not shrunk (i.e. no rotation/truncation happened), so a backend
+        restart does not re-parse the whole log history. Falls back to the end
+        of the file when the saved offset is stale.
+        """
+        try:
+            stat = deploy_log.stat()
+            saved = self._persisted_offsets.get(str(deploy_log))
+
+            if saved and saved.get("inode") == stat.st_ino and saved.get("position", 0) <= stat.st_size:
+                logger.info("♻️ [DEPLOY_MONITOR] Restored persisted log offset",
+                           deploy_log=str(deploy_log), position=saved["position"])
+                return saved["position"]
+
+            if saved:
+                logger.info("🔄 [DEPLOY_MONITOR] Persisted offset stale (rotated/truncated log), starting from end",
+                           deploy_log=str(deploy_log))
+            return stat.st_size
+
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Failed to restore log offset, starting from end",
+                          deploy_log=str(deploy_log), error=str(e))
+            return deploy_log.stat().st_size if deploy_log.exists() else 0
+
+    def _fingerprint_log(self, deploy_log: Path, inode: int, size: int) -> Tuple[int, int, int]:
+        """
+        O(1) identity of a log file: inode plus a CRC over the first
+        (at most) 4KB. The head of an append-only log never changes, so a
+        different CRC over the same byte range means the file was replaced
+        even when the inode survived (copytruncate-style rotation).
+        """
+        head_len = min(size, 4096)
+        head_crc = 0
+        if head_len:
+            with open(deploy_log, 'rb') as f:
+                head_crc = zlib.crc32(f.read(head_len))
+        return (inode, head_len, head_crc)
+
+    def _detect_log_replacement(self, deploy_log: Path, deploy_log_path: str,
+                                inode: int, size: int, last_position: int) -> bool:
+        """
+        Decide whether the log at this path is still the file we were
+        reading. Returns True (and refreshes the stored identity) when it
+        was rotated, truncated or replaced so the caller can reset its
+        offset instead of waiting for the file to regrow past it.
+        """
+        identity = self._log_identities.get(deploy_log_path)
+        if identity is None:
+            self._log_identities[deploy_log_path] = self._fingerprint_log(deploy_log, inode, size)
+            # No prior identity - fall back to the size heuristic alone
+            return size < last_position
+
+        known_inode, head_len, head_crc = identity
+        replaced = False
+
+        if inode != known_inode:
+            replaced = True  # Classic rotation: new file at the old path
+        elif size < last_position:
+            replaced = True  # Truncation in place
+        elif size > last_position and head_len:
+            # Same inode with new content: verify the head bytes we
+            # fingerprinted are unchanged before trusting the offset
+            with open(deploy_log, 'rb') as f:
+                replaced = zlib.crc32(f.read(head_len)) != head_crc
+
+        if replaced or head_len < 4096:
+            # Re-fingerprint after a replacement, and extend the head basis
+            # while the file is still shorter than the 4KB cap
+            self._log_identities[deploy_log_path] = self._fingerprint_log(deploy_log, inode, size)
+        return replaced
+
+    def _persist_offset(self, deploy_log: Path, deploy_log_path: str):
+        """Persist the current read offset for a deploy log (atomic write)"""
+        try:
+            stat = deploy_log.stat()
+            self._persisted_offsets[deploy_log_path] = {
+                "position": self.last_known_positions.get(deploy_log_path, 0),
+                "inode": stat.st_ino,
+                "size": stat.st_size
+            }
+
+            self.offsets_file.parent.mkdir(exist_ok=True)
+            temp_file = self.offsets_file.with_suffix('.tmp')
+            with open(temp_file, 'w') as f:
+                json.dump(self._persisted_offsets, f, indent=2)
+            temp_file.replace(self.offsets_file)
+
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Failed to persist log offset",
+                          deploy_log=deploy_log_path, error=str(e))
 
     def _parse_deploy_events(self, content: str, project_name: str) -> List[Dict[str, Any]]:
         """Parse deploy events from log content"""
         events = []
-        
+
+        if DEPLOY_PARSE_C_AVAILABLE and STRUCTURED_EVENT_PREFIX not in content:
+            # Scan a legacy-format burst in one C call instead of
+            # line-at-a-time; structured DBEV1 lines take the split path below
+            try:
+                parsed_tuples = _deploy_parse.parse_buffer(content.encode('utf-8'))
+                events = [self._event_tuple_to_dict(parsed, project_name)
+                          for parsed in parsed_tuples]
+                if events:
+                    logger.debug("📝 [DEPLOY_MONITOR] Parsed deploy events",
+                                project_name=project_name, event_count=len(events))
+                return events
+            except Exception as e:
+                logger.warning("⚠️ [DEPLOY_MONITOR] C buffer parser failed, using Python path",
+                              project_name=project_name, error=str(e))
+                events = []
+
         for line in content.strip().split('\n'):
             if not line.strip():
                 continue
-                
+
             event = self._parse_deploy_line(line, project_name)
             if event:
                 events.append(event)
-        
+
         if events:
-            logger.info("📝 [DEPLOY_MONITOR] Parsed deploy events", 
-                       project_name=project_name, event_count=len(events))
+            logger.debug("📝 [DEPLOY_MONITOR] Parsed deploy events",
+                        project_name=project_name, event_count=len(events))
         
         return events
 
+    def _build_command_matcher(self, config: Dict[str, Any]) -> Optional[re.Pattern]:
+        """
+        Compile a project's configured deployCommands into one alternation regex.
+
+        Matching a line against N known commands then costs a single pass over
+        the text instead of N substring scans. Longer commands are tried first
+        so "firebase deploy --only functions" wins over "firebase deploy".
+        """
+        commands = config.get("deployCommands", [])
+        if not commands:
+            return None
+
+        try:
+            alternation = "|".join(
+                re.escape(cmd) for cmd in sorted(commands, key=len, reverse=True)
+            )
+            return re.compile(alternation)
+        except Exception as e:
+            logger.warning("⚠️ [DEPLOY_MONITOR] Failed to compile deploy command matcher",
+                          error=str(e))
+            return None
+
+    def _event_tuple_to_dict(self, parsed: Tuple, project_name: str) -> Dict[str, Any]:
+        """Build an event dict from a C accelerator tuple (see _deploy_parse.c)"""
+        event_kind, timestamp, command, cwd, exit_code = parsed
+        matcher = self._command_matchers.get(project_name)
+        event = {
+            "type": "deploy_start" if event_kind == 0 else "deploy_complete",
+            "timestamp": timestamp,
+            "datetime": datetime.fromtimestamp(timestamp),
+            "command": command,
+            "known_command": bool(matcher.search(command)) if matcher else False,
+            "project_name": project_name
+        }
+        if event_kind == 0:
+            event["cwd"] = cwd
+        else:
+            event["exit_code"] = exit_code
+        return event
+
+    def _parse_structured_line(self, line: str, project_name: str) -> Optional[Dict[str, Any]]:
+        """
+        Parse a DBEV1 structured event line with a single split.
+
+        Fields: version, timestamp, wrapper project, command hash, phase,
+        exit code ("-" for starts), percent-encoded command, percent-encoded
+        cwd. Anything that doesn't decode cleanly is simply not an event.
+        """
+        fields = line.split(" ")
+        if len(fields) != 8:
+            return None
+
+        try:
+            _, ts, wrapper_project, command_hash, phase, exit_code, quoted_command, quoted_cwd = fields
+            if phase not in ("start", "complete"):
+                return None
+
+            timestamp = float(ts)
+            command = urllib.parse.unquote(quoted_command)
+            cwd = urllib.parse.unquote(quoted_cwd)
+            matcher = self._command_matchers.get(project_name)
+
+            event = {
+                "type": "deploy_start" if phase == "start" else "deploy_complete",
+                "timestamp": timestamp,
+                "datetime": datetime.fromtimestamp(timestamp),
+                "command": command,
+                "command_hash": command_hash,
+                "cwd": cwd,
+                "known_command": bool(matcher.search(command)) if matcher else False,
+                "project_name": project_name
+            }
+            if phase == "complete":
+                event["exit_code"] = int(exit_code) if exit_code != "-" else None
+            if wrapper_project != "-":
+                event["wrapper_project"] = wrapper_project
+            return event
+        except (ValueError, IndexError):
+            return None
+
     def _parse_deploy_line(self, line: str, project_name: str) -> Optional[Dict[str, Any]]:
         """Parse a single deploy log line"""
+        stripped = line.strip()
+        if stripped.startswith(STRUCTURED_EVENT_PREFIX):
+            return self._parse_structured_line(stripped, project_name)
+
+        if DEPLOY_PARSE_C_AVAILABLE:
+            try:
+                parsed = _deploy_parse.parse_line(line)
+                if parsed is None:
+                    return None
+                return self._event_tuple_to_dict(parsed, project_name)
+            except Exception as e:
+                logger.warning("⚠️ [DEPLOY_MONITOR] C parser failed, using Python path",
+                              line=line, error=str(e))
+
         try:
             # Expected format: "timestamp DEPLOY: command [CWD: path]"
             # or: "timestamp DEPLOY_COMPLETE: command [EXIT_CODE: code]"
-            
-            parts = line.strip().split(' ', 2)
-            if len(parts) < 3:
-                return None
-            
-            timestamp_str = parts[0]
-            event_type = parts[1].rstrip(':')
-            remaining = parts[2] if len(parts) > 2 else ""
-            
-            try:
-                timestamp = float(timestamp_str)
-            except ValueError:
-                logger.warning("⚠️ [DEPLOY_MONITOR] Invalid timestamp in log line", 
-                             line=line, project_name=project_name)
+
+            line_match = DEPLOY_LINE_PATTERN.match(line.strip())
+            if not line_match:
                 return None
-            
+
+            timestamp = float(line_match.group("timestamp"))
+            event_type = line_match.group("event")
+            remaining = line_match.group("rest")
+            matcher = self._command_matchers.get(project_name)
+
             if event_type == "DEPLOY":
                 # Parse deploy start event
-                command_match = re.match(r'^(.*?)\s*\[CWD:\s*(.*?)\]$', remaining)
+                command_match = CWD_SUFFIX_PATTERN.match(remaining)
                 if command_match:
-                    command = command_match.group(1).strip()
-                    cwd = command_match.group(2).strip()
+                    command = command_match.group("command").strip()
+                    cwd = command_match.group("cwd").strip()
                 else:
                     command = remaining.strip()
                     cwd = None
-                
+
                 return {
                     "type": "deploy_start",
                     "timestamp": timestamp,
                     "datetime": datetime.fromtimestamp(timestamp),
                     "command": command,
                     "cwd": cwd,
+                    "known_command": bool(matcher.search(command)) if matcher else False,
                     "project_name": project_name
                 }
-                
+
             elif event_type == "DEPLOY_COMPLETE":
                 # Parse deploy completion event
-                command_match = re.match(r'^(.*?)\s*\[EXIT_CODE:\s*(\d+)\]$', remaining)
+                command_match = EXIT_CODE_SUFFIX_PATTERN.match(remaining)
                 if command_match:
-                    command = command_match.group(1).strip()
-                    exit_code = int(command_match.group(2))
+                    command = command_match.group("command").strip()
+                    exit_code = int(command_match.group("code"))
                 else:
                     command = remaining.strip()
                     exit_code = None
-                
+
                 return {
-                    "type": "deploy_complete", 
+                    "type": "deploy_complete",
                     "timestamp": timestamp,
                     "datetime": datetime.fromtimestamp(timestamp),
                     "command": command,
                     "exit_code": exit_code,
+                    "known_command": bool(matcher.search(command)) if matcher else False,
                     "project_name": project_name
                 }
-            
+
         except Exception as e:
-            logger.warning("⚠️ [DEPLOY_MONITOR] Error parsing log line", 
+            logger.warning("⚠️ [DEPLOY_MONITOR] Error parsing log line",
                           line=line, project_name=project_name, error=str(e))
-        
+
         return None
 
+    async def _dispatch_deploy_events(self, events: List[Dict[str, Any]], project_info: Dict[str, Any]):
+        """
+        Deliver the events parsed from one log read.
+
+        When a batch callback is registered and a read produced several events
+        (e.g. a CI run appending dozens of deploy lines at once), duplicates are
+        coalesced by (type, command) and the whole batch is delivered in a
+        single callback instead of running the full pipeline once per line.
+        Without a batch callback every event is handled individually as before.
+        """
+        if not events:
+            return
+
+        # Absorb duplicates of recently dispatched events before anything
+        # downstream runs - this is the cheapest point, shared by the polling,
+        # FIFO, native-watcher and sharded-worker paths. Load-test runs are
+        # exempt: they deliberately repeat one command to measure the pipeline
+        if self.dedup_window > 0 and not (
+                self._load_test_task and not self._load_test_task.done()):
+            events = [event for event in events
+                      if not self._is_duplicate_dispatch(event, project_info)]
+            if not events:
+                return
+
+        # Advance the shared event sequence so external readers can tell
+        # "new deploy activity happened" without asking over the WebSocket
+        metrics_segment.record_events(len(events))
+
+        # Open a latency trace for the deploy start that will drive the
+        # notification pipeline (the last one wins under coalescing)
+        for event in reversed(events):
+            if event["type"] == "deploy_start":
+                latency_tracer.start_trace(event["project_name"],
+                                           event["timestamp"], time.time())
+                break
+
+        if self.deploy_batch_callback and len(events) > 1:
+            seen = set()
+            batch = []
+            for event in events:
+                key = (event["type"], event.get("command", ""))
+                if key in seen:
+                    continue
+                seen.add(key)
+                batch.append(event)
+
+            logger.info("📦 [DEPLOY_MONITOR] Delivering coalesced event batch",
+                       project_name=project_info["name"],
+                       raw_count=len(events), batch_count=len(batch))
+
+            for event in batch:
+                self._record_deploy_event(event, project_info)
+
+            try:
+                await self.deploy_batch_callback(batch, project_info)
+                return
+            except Exception as e:
+                logger.error("❌ [DEPLOY_MONITOR] Error in deploy batch callback",
+                            error=str(e))
+                import traceback
+                logger.error("❌ [DEPLOY_MONITOR] Batch callback traceback",
+                            traceback=traceback.format_exc())
+                return
+
+        for event in events:
+            logger.info("🚀 [DEPLOY_MONITOR] Processing event",
+                       project_name=event["project_name"],
+                       event_type=event.get("type"),
+                       command=event.get("command"))
+            await self._handle_deploy_event(event, project_info)
+
+    def _is_duplicate_dispatch(self, event: Dict[str, Any], project_info: Dict[str, Any]) -> bool:
+        """
+        True when the same logical deploy event - (project, command, phase) -
+        was already dispatched inside the dedup window. Structured lines key
+        on the wrapper's command hash, legacy lines on the command text.
+        """
+        command_hash = event.get("command_hash")
+        if not command_hash or command_hash == "-":
+            command_hash = event.get("command", "")
+        key = (project_info["name"], command_hash, event["type"])
+        now = time.monotonic()
+        last = self._recent_dispatches.get(key)
+        if last is not None and now - last < self.dedup_window:
+            logger.info("🔁 [DEPLOY_MONITOR] Duplicate deploy event absorbed",
+                       project_name=project_info["name"],
+                       event_type=event["type"],
+                       command=event.get("command", ""),
+                       age_seconds=round(now - last, 3))
+            return True
+
+        self._recent_dispatches[key] = now
+
+        # Occasional pruning keeps the map bounded without a timer task
+        if len(self._recent_dispatches) > 256:
+            cutoff = now - self.dedup_window
+            self._recent_dispatches = {
+                k: t for k, t in self._recent_dispatches.items() if t >= cutoff}
+        return False
+
+    def _record_deploy_event(self, event: Dict[str, Any], project_info: Dict[str, Any]):
+        """Update project statistics and the event ring buffer for one event"""
+        if event["type"] == "deploy_start":
+            project_info["last_deploy_time"] = event["datetime"].isoformat()
+            project_info["deploy_count"] += 1
+
+        self.recent_events.append({
+            "type": event["type"],
+            "project_name": event["project_name"],
+            "command": event.get("command", ""),
+            "timestamp": event["timestamp"]
+        })
+        self._bump_status_version()
+
     async def _handle_deploy_event(self, event: Dict[str, Any], project_info: Dict[str, Any]):
         """Handle a detected deploy event"""
         project_name = event["project_name"]
@@ -407,10 +1659,8 @@ class DeployMonitor:
                    using_cwd=event.get("cwd") is not None,
                    timestamp=event["datetime"].isoformat())
         
-        # Update project statistics
-        if event_type == "deploy_start":
-            project_info["last_deploy_time"] = event["datetime"].isoformat()
-            project_info["deploy_count"] += 1
+        # Update project statistics, ring buffer, and cached status snapshots
+        self._record_deploy_event(event, project_info)
         
         # DEBUG: Log callback status
         logger.info("🔧 [DEPLOY_MONITOR] Callback status check", 
@@ -472,33 +1722,58 @@ class DeployMonitor:
                 import traceback
                 logger.error("❌ [DEPLOY_MONITOR] Generic callback traceback", traceback=traceback.format_exc())
 
+    def _bump_status_version(self):
+        """Invalidate cached status snapshots after a real state change"""
+        self._status_version += 1
+
     def get_monitoring_status(self) -> Dict[str, Any]:
-        """Get the current monitoring status"""
-        return {
+        """Get the current monitoring status (served from a cached snapshot)"""
+        if self._status_cache is not None and self._status_cache_version == self._status_version:
+            return self._status_cache
+
+        self._status_cache = {
             "monitoring_active": self.monitoring_active,
             "monitored_projects": list(self.monitored_projects.keys()),
             "project_count": len(self.monitored_projects),
             "callback_count": len(self.event_callbacks),
-            "check_interval": self.check_interval
+            "check_interval": self.check_interval,
+            "watch_mode": self.watch_mode,
+            "worker_count": len(self._worker_procs),
+            "sharded_projects": len(self._worker_assignments),
+            "status_version": self._status_version
         }
+        self._status_cache_version = self._status_version
+        return self._status_cache
 
     def get_project_status(self, project_name: str) -> Optional[Dict[str, Any]]:
-        """Get status for a specific project"""
+        """Get status for a specific project (rebuilt only when state changed)"""
         if project_name not in self.monitored_projects:
             return None
-        
+
+        cached = self._project_status_cache.get(project_name)
+        if cached and cached[0] == self._status_version:
+            return cached[1]
+
         project_info = self.monitored_projects[project_name]
         deploy_log = Path(project_info["deploy_log"])
-        
-        return {
+
+        snapshot = {
             "project_name": project_name,
             "project_path": project_info["path"],
             "deploy_log_exists": deploy_log.exists(),
             "deploy_log_size": deploy_log.stat().st_size if deploy_log.exists() else 0,
             "last_deploy_time": project_info["last_deploy_time"],
             "deploy_count": project_info["deploy_count"],
-            "last_known_position": self.last_known_positions.get(str(deploy_log), 0)
+            "last_known_position": self.last_known_positions.get(str(deploy_log), 0),
+            "poll_interval": project_info.get("poll_interval", self.check_interval)
         }
+        self._project_status_cache[project_name] = (self._status_version, snapshot)
+        return snapshot
+
+    def get_recent_events(self, limit: int = 20) -> List[Dict[str, Any]]:
+        """Get the most recent deploy events from the ring buffer (newest first)"""
+        events = list(self.recent_events)
+        return events[-limit:][::-1]
 
     async def simulate_deploy_event(self, project_name: str, command: str = "test deploy") -> bool:
         """Simulate a deploy event for testing purposes"""
@@ -526,9 +1801,165 @@ class DeployMonitor:
             return True
             
         except Exception as e:
-            logger.error("❌ [DEPLOY_MONITOR] Failed to simulate deploy event", 
+            logger.error("❌ [DEPLOY_MONITOR] Failed to simulate deploy event",
                         project_name=project_name, error=str(e))
             return False
 
+    async def start_load_test(self, project_name: str, rate: float = 1.0,
+                              duration: float = 60.0,
+                              command: str = "loadtest deploy") -> Dict[str, Any]:
+        """
+        Start sustained load generation against the full deploy pipeline
+
+        Emits simulated deploy events into the project's log at a fixed rate
+        with drift-free scheduling; each event rides the normal detection
+        path, so per-stage p99s show up in trace-stats and memory growth in
+        memory-stats. Runs for `duration` seconds (0 = until stopped).
+        """
+        if project_name not in self.monitored_projects:
+            return {"success": False,
+                    "message": f"Project '{project_name}' is not being monitored"}
+
+        if self._load_test_task and not self._load_test_task.done():
+            return {"success": False, "message": "A load test is already running"}
+
+        rate = max(0.1, min(float(rate), 200.0))
+        duration = max(0.0, min(float(duration), 24 * 3600.0))
+
+        from memwatch import _read_rss_bytes
+
+        self._load_test_stats = {
+            "project_name": project_name,
+            "command": command,
+            "rate": rate,
+            "duration": duration,
+            "started_monotonic": time.monotonic(),
+            "started_at": datetime.now().isoformat(),
+            "completed_at": None,
+            "events_emitted": 0,
+            "overruns": 0,  # iterations where emission fell a full interval behind
+            "emit_lag_ms": deque(maxlen=1000),
+            "rss_samples": [],  # (elapsed_seconds, bytes) every ~10s
+            "rss_start": _read_rss_bytes()
+        }
+        self._load_test_task = asyncio.create_task(
+            self._load_test_loop(project_name, rate, duration, command))
+
+        logger.info("🏋️ [DEPLOY_MONITOR] Load test started",
+                   project_name=project_name, rate_per_sec=rate,
+                   duration_seconds=duration)
+        return {"success": True, "project": project_name,
+                "rate": rate, "duration": duration}
+
+    async def stop_load_test(self) -> Dict[str, Any]:
+        """Stop a running load test and return its final stats"""
+        task = self._load_test_task
+        if task is None or task.done():
+            return {"success": False, "message": "No load test running"}
+
+        task.cancel()
+        try:
+            await task
+        except asyncio.CancelledError:
+            pass
+        self._finalize_load_test()
+        logger.info("🛑 [DEPLOY_MONITOR] Load test stopped by request")
+        return {"success": True, "message": "Load test stopped"}
+
+    def _finalize_load_test(self):
+        """Stamp completion time and final RSS on the current run's stats"""
+        stats = self._load_test_stats
+        if stats is None or stats["completed_at"] is not None:
+            return
+        from memwatch import _read_rss_bytes
+        stats["completed_at"] = datetime.now().isoformat()
+        elapsed = time.monotonic() - stats["started_monotonic"]
+        stats["rss_samples"].append((round(elapsed, 1), _read_rss_bytes()))
+
+    async def _load_test_loop(self, project_name: str, rate: float,
+                              duration: float, command: str):
+        """Drift-free emission loop - a missed deadline doesn't skew the rate"""
+        from memwatch import _read_rss_bytes
+
+        stats = self._load_test_stats
+        project_info = self.monitored_projects[project_name]
+        deploy_log = Path(project_info["deploy_log"])
+        cwd = project_info["path"]
+        interval = 1.0 / rate
+        started = time.monotonic()
+        next_emit = started
+        next_rss_sample = started
+
+        try:
+            # One open handle for the run - opening per event would dominate
+            # the cost being measured at higher rates
+            with open(deploy_log, 'a') as f:
+                while True:
+                    now = time.monotonic()
+                    if duration and now - started >= duration:
+                        break
+
+                    timestamp = time.time()
+                    f.write(f"{timestamp} DEPLOY: {command} [CWD: {cwd}]\n")
+                    f.write(f"{timestamp} DEPLOY_COMPLETE: {command} [EXIT_CODE: 0]\n")
+                    f.flush()
+
+                    stats["events_emitted"] += 1
+                    stats["emit_lag_ms"].append((now - next_emit) * 1000)
+
+                    if now >= next_rss_sample:
+                        stats["rss_samples"].append(
+                            (round(now - started, 1), _read_rss_bytes()))
+                        next_rss_sample = now + 10.0
+
+                    next_emit += interval
+                    sleep_for = next_emit - time.monotonic()
+                    if sleep_for > 0:
+                        await asyncio.sleep(sleep_for)
+                    elif sleep_for < -interval:
+                        # Can't keep up - resynchronize instead of bursting
+                        stats["overruns"] += 1
+                        next_emit = time.monotonic()
+                        await asyncio.sleep(0)
+        except asyncio.CancelledError:
+            raise
+        except Exception as e:
+            logger.error("❌ [DEPLOY_MONITOR] Load test loop failed",
+                        project_name=project_name, error=str(e))
+        finally:
+            self._finalize_load_test()
+            logger.info("🏁 [DEPLOY_MONITOR] Load test finished",
+                       project_name=project_name,
+                       events_emitted=stats["events_emitted"],
+                       overruns=stats["overruns"])
+
+    def get_load_test_stats(self, summarize) -> Dict[str, Any]:
+        """Current/last load-test run summarized with the caller's summarizer"""
+        stats = self._load_test_stats
+        if stats is None:
+            return {"active": False}
+
+        elapsed = time.monotonic() - stats["started_monotonic"]
+        rss_start = stats["rss_start"]
+        rss_latest = stats["rss_samples"][-1][1] if stats["rss_samples"] else rss_start
+
+        return {
+            "active": bool(self._load_test_task and not self._load_test_task.done()),
+            "project_name": stats["project_name"],
+            "rate_configured": stats["rate"],
+            "rate_achieved": round(stats["events_emitted"] / elapsed, 2) if elapsed > 0 else 0,
+            "duration_configured": stats["duration"],
+            "elapsed_seconds": round(elapsed, 1),
+            "started_at": stats["started_at"],
+            "completed_at": stats["completed_at"],
+            "events_emitted": stats["events_emitted"],
+            "overruns": stats["overruns"],
+            "emit_lag": summarize(stats["emit_lag_ms"]),
+            "rss_growth_mb": round((rss_latest - rss_start) / (1024 * 1024), 1)
+                             if rss_start and rss_latest else None,
+            "rss_samples": [(t, round(b / (1024 * 1024), 1) if b else None)
+                            for t, b in stats["rss_samples"][-20:]]
+        }
+
 # Global instance
-deploy_monitor = DeployMonitor() 
\ No newline at end of file
+deploy_monitor = DeployMonitor()
\ No newline at end of file
@@ -13,8 +13,10 @@ This module handles:
 
 import asyncio
 import copy
+import heapq
 import json
 import os
+import string
 import subprocess
 import time
 from datetime import datetime, timedelta
@@ -35,6 +37,8 @@ except ImportError:
 
 # 📊 PHASE 2: Analytics integration for Switch tracking
 from analytics import analytics_manager
+from tracing import latency_tracer
+from scripting import scripting_session
 
 class NotificationManager:
     """Comprehensive notification system for DeployBot"""
@@ -94,6 +98,16 @@ class NotificationManager:
             }
         }
         
+        # Precompiled templates: each one is parsed once here into the slot
+        # names its strings actually reference plus a reusable skeleton dict
+        # of the constant fields, so a notification storm does per-event
+        # slot filling instead of re-deriving the whole payload from the
+        # raw template every time
+        self._compiled_templates = {
+            name: self._compile_template(name, template)
+            for name, template in self.templates.items()
+        }
+
         # Active notification tracking
         self.active_notifications = {}  # notification_id -> notification_data
         self.notification_responses = {}  # notification_id -> user_response
@@ -106,7 +120,25 @@ class NotificationManager:
         
         # 📊 PHASE 2: Switch tracking for time saved analytics
         self.switch_tracking_enabled = True
-        
+
+        # Background history persistence: the notify path only touches the
+        # in-memory list; a debounced writer task batches bursts into one
+        # atomic disk write so dispatch latency never includes I/O
+        self.history_file = Path.home() / ".deploybot" / "notification_history.json"
+        self.history_write_debounce = 1.0  # seconds to let a burst settle before writing
+        self._history_dirty = None  # asyncio.Event, created when persistence starts
+        self._persistence_task = None
+
+        # Single delay-queue scheduler: every timed notification action
+        # (auto-dismiss, snooze redelivery) becomes a heap entry served by
+        # one task, so N pending deadlines cost one pending timer instead of
+        # N sleeping coroutines
+        self._schedule_heap = []  # (due_at, seq, action, payload)
+        self._schedule_seq = 0
+        self._cancelled_schedule_entries = set()  # seqs invalidated before firing
+        self._scheduler_wakeup = None  # asyncio.Event, created lazily on the loop
+        self._scheduler_task = None
+
         logger.info("🔔 [NOTIFY] NotificationManager initialized with Phase 2 Switch tracking", 
                    system_notifications=PYNC_AVAILABLE,
                    templates=len(self.templates),
@@ -117,6 +149,145 @@ class NotificationManager:
         self.websocket_server = websocket_server
         logger.info("🔌 [NOTIFY] WebSocket server attached to notification manager")
 
+    async def start_persistence(self):
+        """Load persisted history and start the background history writer"""
+        try:
+            if self.history_file.exists():
+                with open(self.history_file, 'r') as f:
+                    persisted = json.load(f)
+                if isinstance(persisted, list):
+                    self.notification_history = persisted[-self.max_history:]
+                    logger.info("📚 [NOTIFY] Restored notification history",
+                               count=len(self.notification_history))
+        except Exception as e:
+            logger.warning("⚠️ [NOTIFY] Failed to load notification history", error=str(e))
+
+        self._history_dirty = asyncio.Event()
+        self._persistence_task = asyncio.create_task(self._persistence_loop())
+        logger.info("💾 [NOTIFY] Notification history persistence started")
+
+    async def stop_persistence(self):
+        """Stop the history writer, flushing any pending entries"""
+        if self._persistence_task:
+            self._persistence_task.cancel()
+            try:
+                await self._persistence_task
+            except asyncio.CancelledError:
+                pass
+            self._persistence_task = None
+
+        # Final synchronous-ish flush so nothing recorded this session is lost
+        if self._history_dirty and self._history_dirty.is_set():
+            try:
+                self._write_history_file(list(self.notification_history))
+            except Exception as e:
+                logger.warning("⚠️ [NOTIFY] Final history flush failed", error=str(e))
+        self._history_dirty = None
+
+        # Stop the delay-queue scheduler too; pending deadlines are
+        # in-memory only and die with the backend either way
+        if self._scheduler_task:
+            self._scheduler_task.cancel()
+            try:
+                await self._scheduler_task
+            except asyncio.CancelledError:
+                pass
+            self._scheduler_task = None
+
+    def _schedule_action(self, delay_seconds: float, action: str, payload: Any) -> int:
+        """
+        Queue a timed notification action on the shared delay-queue and
+        return its entry id (usable with _cancel_scheduled). Starts the
+        scheduler task lazily on first use.
+        """
+        self._schedule_seq += 1
+        seq = self._schedule_seq
+        heapq.heappush(self._schedule_heap,
+                       (time.monotonic() + delay_seconds, seq, action, payload))
+
+        if self._scheduler_wakeup is None:
+            self._scheduler_wakeup = asyncio.Event()
+        if self._scheduler_task is None or self._scheduler_task.done():
+            self._scheduler_task = asyncio.create_task(self._scheduler_loop())
+
+        # A new earliest deadline must interrupt the current wait
+        self._scheduler_wakeup.set()
+        return seq
+
+    def _cancel_scheduled(self, seq: Optional[int]):
+        """Invalidate a queued action; the loop skips it when it surfaces"""
+        if seq is not None:
+            self._cancelled_schedule_entries.add(seq)
+
+    async def _scheduler_loop(self):
+        """Serve every queued deadline from one task (one timer in total)"""
+        try:
+            while True:
+                if not self._schedule_heap:
+                    self._scheduler_wakeup.clear()
+                    await self._scheduler_wakeup.wait()
+                    continue
+
+                due_at = self._schedule_heap[0][0]
+                delay = due_at - time.monotonic()
+                if delay > 0:
+                    self._scheduler_wakeup.clear()
+                    try:
+                        await asyncio.wait_for(self._scheduler_wakeup.wait(), timeout=delay)
+                        continue  # Woken early - re-evaluate the heap top
+                    except asyncio.TimeoutError:
+                        pass
+
+                _, seq, action, payload = heapq.heappop(self._schedule_heap)
+                if seq in self._cancelled_schedule_entries:
+                    self._cancelled_schedule_entries.discard(seq)
+                    continue
+
+                try:
+                    await self._run_scheduled_action(action, payload)
+                except Exception as e:
+                    logger.error("❌ [NOTIFY] Scheduled notification action failed",
+                                action=action, error=str(e))
+        except asyncio.CancelledError:
+            pass
+
+    async def _run_scheduled_action(self, action: str, payload: Any):
+        """Dispatch one due delay-queue entry"""
+        if action == "auto_dismiss":
+            if payload in self.active_notifications:
+                logger.debug("⏰ [NOTIFY] Auto-dismissing notification",
+                            notification_id=payload)
+                await self.handle_notification_response(payload, "auto_dismiss")
+        elif action == "snooze_resend":
+            await self._resend_snoozed_notification(payload)
+        else:
+            logger.warning("⚠️ [NOTIFY] Unknown scheduled action", action=action)
+
+    async def _persistence_loop(self):
+        """Debounce history changes and batch them into one disk write"""
+        while True:
+            await self._history_dirty.wait()
+            # Let a burst of notifications settle into a single write
+            await asyncio.sleep(self.history_write_debounce)
+            self._history_dirty.clear()
+
+            snapshot = list(self.notification_history)
+            try:
+                await asyncio.get_running_loop().run_in_executor(
+                    None, self._write_history_file, snapshot
+                )
+            except Exception as e:
+                logger.warning("⚠️ [NOTIFY] Failed to persist notification history",
+                              error=str(e))
+
+    def _write_history_file(self, snapshot: List[Dict[str, Any]]):
+        """Atomically write a history snapshot (runs in the executor)"""
+        self.history_file.parent.mkdir(exist_ok=True)
+        temp_file = self.history_file.with_suffix('.tmp')
+        with open(temp_file, 'w') as f:
+            json.dump(snapshot, f)
+        temp_file.replace(self.history_file)
+
     def add_notification_callback(self, callback: Callable):
         """Add a callback to be notified of notification events"""
         self.notification_callbacks.append(callback)
@@ -240,27 +411,40 @@ class NotificationManager:
         """Send a notification using the specified template"""
         
         notification_id = f"{template_name}_{int(time.time() * 1000)}"
-        template = self.templates.get(template_name, {})
-        
-        # Prepare notification content
-        notification = {
-            "id": notification_id,
-            "template": template_name,
-            "title": self._format_template_string(template.get("title", "DeployBot"), data),
-            "message": self._format_template_string(template.get("message", "Notification"), data),
-            "actions": template.get("actions", ["Dismiss"]),
-            "category": template.get("category", "general"),
-            "sound": template.get("sound", "default"),
-            "timestamp": datetime.now().isoformat(),
-            "data": data,
-            "auto_dismiss_timeout": self.preferences["auto_dismiss_timeout"]
-        }
+        compiled = self._compiled_templates.get(template_name)
+        if compiled is None:
+            # Templates can be named at runtime (test paths); compile once
+            # on first use and keep the result
+            compiled = self._compile_template(
+                template_name, self.templates.get(template_name, {}))
+            self._compiled_templates[template_name] = compiled
+
+        # Prepare notification content from the precompiled skeleton - the
+        # constant fields are shared and only the slotted strings render
+        notification = dict(compiled["skeleton"])
+        notification["id"] = notification_id
+        if "title" not in notification:
+            notification["title"] = self._render_slots(
+                compiled["title"], compiled["title_slots"], data)
+        if "message" not in notification:
+            notification["message"] = self._render_slots(
+                compiled["message"], compiled["message_slots"], data)
+        notification["timestamp"] = datetime.now().isoformat()
+        notification["data"] = data
+        notification["auto_dismiss_timeout"] = self.preferences["auto_dismiss_timeout"]
         
         # Store in active notifications
         self.active_notifications[notification_id] = notification
         
         # 📊 ANALYTICS: Record notification display time for response time tracking
         self.notification_display_times[notification_id] = time.time()
+
+        # ⏱️ Latency tracing: stamp the send and tie this notification id to
+        # the project's open trace so the display ack can close it
+        trace_project = data.get("project_name")
+        if trace_project:
+            latency_tracer.record_stage(trace_project, "notification_sent")
+            latency_tracer.bind_notification(notification_id, trace_project)
         
         # Add to history
         self._add_to_history(notification)
@@ -269,9 +453,11 @@ class NotificationManager:
         # This replaces system notifications with our custom implementation
         await self._send_custom_notification(notification)
         
-        # Send system notification if enabled (as fallback)
+        # Send system notification if enabled (as fallback). Fired in the
+        # background: osascript fallbacks can take seconds and must not sit
+        # between deploy detection and the in-app notification below
         if self.preferences["system_notifications_enabled"]:
-            await self._send_system_notification(notification)
+            asyncio.create_task(self._send_system_notification(notification))
         
         # Send in-app notification if enabled
         if self.preferences["in_app_modals_enabled"]:
@@ -280,9 +466,10 @@ class NotificationManager:
         # Notify callbacks
         await self._notify_callbacks("notification_sent", notification)
         
-        # Schedule auto-dismiss if configured
+        # Schedule auto-dismiss on the shared delay-queue if configured
         if self.preferences["auto_dismiss_timeout"] > 0:
-            asyncio.create_task(self._auto_dismiss_notification(notification_id))
+            self._schedule_action(self.preferences["auto_dismiss_timeout"],
+                                  "auto_dismiss", notification_id)
         
         logger.info("✅ [NOTIFY] Notification sent successfully", 
                    notification_id=notification_id, 
@@ -346,7 +533,18 @@ class NotificationManager:
             except Exception as e:
                 logger.warning("⚠️ [NOTIFY] pync notification failed, trying fallback", error=str(e))
         
-        # Method 2: Standard osascript notification
+        # Method 2: Persistent notification session - one pipe write to the
+        # already-running helper, the last spawn-free hop on the
+        # deploy-to-notification path
+        try:
+            if await scripting_session.notify(title, message, subtitle="DeployBot"):
+                logger.debug("📱 [NOTIFY] macOS notification sent via persistent session")
+                return
+        except Exception as e:
+            logger.warning("⚠️ [NOTIFY] Persistent session notify failed, trying osascript",
+                         error=str(e))
+
+        # Method 3: Standard osascript notification
         try:
             script = f'''
             display notification "{message}" ¬
@@ -355,17 +553,11 @@ class NotificationManager:
             '''
             
             logger.debug("🔧 [NOTIFY] Executing osascript", script=script.strip())
-            
-            result = await asyncio.get_event_loop().run_in_executor(
-                None,
-                lambda: subprocess.run(
-                    ['osascript', '-e', script],
-                    capture_output=True,
-                    text=True,
-                    timeout=10
-                )
-            )
-            
+
+            # Runs over the shared scripting session's pipe - no fresh
+            # osascript spawn from this process
+            result = await scripting_session.run_applescript(script, timeout=10)
+
             if result.returncode == 0:
                 logger.debug("📱 [NOTIFY] macOS notification sent via osascript")
                 # Test if notification actually appeared
@@ -377,7 +569,7 @@ class NotificationManager:
         except Exception as e:
             logger.error("❌ [NOTIFY] osascript notification failed", error=str(e))
         
-        # Method 3: Alternative AppleScript approach
+        # Method 4: Alternative AppleScript approach
         try:
             alt_script = f'''
             tell application "System Events"
@@ -386,17 +578,9 @@ class NotificationManager:
             '''
             
             logger.debug("🔧 [NOTIFY] Trying alternative AppleScript approach")
-            
-            result = await asyncio.get_event_loop().run_in_executor(
-                None,
-                lambda: subprocess.run(
-                    ['osascript', '-e', alt_script],
-                    capture_output=True,
-                    text=True,
-                    timeout=10
-                )
-            )
-            
+
+            result = await scripting_session.run_applescript(alt_script, timeout=10)
+
             if result.returncode == 0:
                 logger.debug("📱 [NOTIFY] macOS notification sent via System Events")
                 return
@@ -406,7 +590,7 @@ class NotificationManager:
         except Exception as e:
             logger.error("❌ [NOTIFY] System Events notification failed", error=str(e))
         
-        # Method 4: Terminal bell + echo (audible fallback)
+        # Method 5: Terminal bell + echo (audible fallback)
         try:
             logger.info("🔔 [NOTIFY] Using terminal bell fallback")
             
@@ -430,7 +614,7 @@ class NotificationManager:
         except Exception as e:
             logger.error("❌ [NOTIFY] All notification methods failed", error=str(e))
         
-        # Method 5: Create visible file for manual checking
+        # Method 6: Create visible file for manual checking
         try:
             desktop_path = os.path.expanduser("~/Desktop/DeployBot_Notification.txt")
             notification_text = f"""
@@ -465,16 +649,8 @@ You can delete this file after reading the notification.
             end tell
             '''
             
-            result = await asyncio.get_event_loop().run_in_executor(
-                None,
-                lambda: subprocess.run(
-                    ['osascript', '-e', check_script],
-                    capture_output=True,
-                    text=True,
-                    timeout=5
-                )
-            )
-            
+            result = await scripting_session.run_applescript(check_script, timeout=5)
+
             if result.returncode == 0:
                 logger.debug("🔍 [NOTIFY] Notification verification", result=result.stdout.strip())
             else:
@@ -692,13 +868,12 @@ You can delete this file after reading the notification.
             logger.debug("🗑️ [NOTIFY] Current notification removed for snoozing", 
                         notification_id=notification["id"])
         
-        # Schedule re-notification using the copy
-        snooze_task = asyncio.create_task(
-            self._reschedule_notification(notification_copy, snooze_minutes * 60)
-        )
-        
-        # Store snooze task for potential cancellation (store on copy)
-        notification_copy["snooze_task"] = snooze_task
+        # Schedule re-notification on the shared delay-queue using the copy
+        entry_id = self._schedule_action(snooze_minutes * 60, "snooze_resend",
+                                         notification_copy)
+
+        # Store the entry id for potential cancellation (store on copy)
+        notification_copy["snooze_entry"] = entry_id
 
     async def _handle_start_new_timer(self, notification: Dict[str, Any], additional_data: Dict[str, Any]):
         """Handle starting a new timer from unified notification"""
@@ -732,22 +907,15 @@ You can delete this file after reading the notification.
         
         logger.info("✅ [NOTIFY] New timer started", project=project_name, duration=timer_duration)
 
-    async def _reschedule_notification(self, notification: Dict[str, Any], delay_seconds: int):
-        """Reschedule a notification after snooze period"""
-        
+    async def _resend_snoozed_notification(self, notification: Dict[str, Any]):
+        """Re-send a snoozed notification once its delay-queue entry fires"""
+
         original_id = notification.get("id", "unknown")
-        logger.info("⏱️ [NOTIFY] Starting snooze timer", 
-                   original_notification_id=original_id, 
-                   delay_seconds=delay_seconds,
-                   notification_data_keys=list(notification.keys()))
-        
+
         try:
-            # Sleep for the snooze period
-            await asyncio.sleep(delay_seconds)
-            
-            logger.info("⏰ [NOTIFY] Snooze period completed, preparing to resend", 
+            logger.info("⏰ [NOTIFY] Snooze period completed, preparing to resend",
                        original_notification_id=original_id)
-            
+
             # Re-send the notification with new ID and reminder text
             new_id = f"{notification['template']}_resend_{int(time.time() * 1000)}"
             notification["id"] = new_id
@@ -811,17 +979,6 @@ You can delete this file after reading the notification.
             # Re-raise the exception to see it in logs
             raise
 
-    async def _auto_dismiss_notification(self, notification_id: str):
-        """Auto-dismiss notification after timeout"""
-        
-        await asyncio.sleep(self.preferences["auto_dismiss_timeout"])
-        
-        if notification_id in self.active_notifications:
-            logger.debug("⏰ [NOTIFY] Auto-dismissing notification", 
-                        notification_id=notification_id)
-            
-            await self.handle_notification_response(notification_id, "auto_dismiss")
-
     async def _send_timer_status(self, notification: Dict[str, Any]):
         """Send timer status to frontend"""
         
@@ -852,36 +1009,70 @@ You can delete this file after reading the notification.
                 }
             })
 
-    def _format_template_string(self, template: str, data: Dict[str, Any]) -> str:
-        """Format template string with data"""
-        
+    def _compile_template(self, name: str, template: Dict[str, Any]) -> Dict[str, Any]:
+        """
+        Parse a notification template once into the slot names its strings
+        actually reference plus a reusable skeleton of the constant fields.
+        Slot-free strings land in the skeleton directly, so fully static
+        templates skip formatting altogether at send time.
+        """
+        title = template.get("title", "DeployBot")
+        message = template.get("message", "Notification")
+        title_slots = tuple(field for _, field, _, _
+                            in string.Formatter().parse(title) if field)
+        message_slots = tuple(field for _, field, _, _
+                              in string.Formatter().parse(message) if field)
+
+        skeleton = {
+            "template": name,
+            "actions": template.get("actions", ["Dismiss"]),
+            "category": template.get("category", "general"),
+            "sound": template.get("sound", "default"),
+        }
+        if not title_slots:
+            skeleton["title"] = title
+        if not message_slots:
+            skeleton["message"] = message
+
+        return {
+            "title": title,
+            "message": message,
+            "title_slots": title_slots,
+            "message_slots": message_slots,
+            "skeleton": skeleton,
+        }
+
+    def _render_slots(self, template: str, slots: tuple, data: Dict[str, Any]) -> str:
+        """
+        Fill only the slots a template references, instead of flattening
+        the entire payload (nested dicts included) before every format call
+        """
         try:
-            # Flatten nested data for template formatting
-            flat_data = {}
-            
-            for key, value in data.items():
-                if isinstance(value, dict):
-                    # Handle nested dictionaries
-                    for nested_key, nested_value in value.items():
-                        flat_data[f"{key}_{nested_key}"] = nested_value
+            values = {}
+            for slot in slots:
+                if slot in data:
+                    values[slot] = data[slot]
+                elif slot == "project":
+                    values[slot] = data.get("project_name", "unknown")
+                elif slot == "command":
+                    values[slot] = data.get("deploy_command", "unknown")
+                elif slot == "task_text":
+                    values[slot] = (data.get("task") or {}).get("text", "Unknown task")
+                elif slot == "task_app":
+                    values[slot] = (data.get("task") or {}).get("app", "Unknown app")
                 else:
-                    flat_data[key] = value
-            
-            # Add commonly used formatters
-            if "task" in data and isinstance(data["task"], dict):
-                flat_data["task_text"] = data["task"].get("text", "Unknown task")
-                flat_data["task_app"] = data["task"].get("app", "Unknown app")
-            
-            if "project_name" in data:
-                flat_data["project"] = data["project_name"]
-            
-            if "deploy_command" in data:
-                flat_data["command"] = data["deploy_command"]
-                
-            return template.format(**flat_data)
-            
+                    # Nested "{parent_field}" lookups, same names the old
+                    # whole-payload flattening produced
+                    for key, value in data.items():
+                        if isinstance(value, dict) and slot.startswith(f"{key}_"):
+                            values[slot] = value[slot[len(key) + 1:]]
+                            break
+                    else:
+                        raise KeyError(slot)
+            return template.format(**values)
+
         except (KeyError, ValueError) as e:
-            logger.warning("⚠️ [NOTIFY] Template formatting failed", 
+            logger.warning("⚠️ [NOTIFY] Template formatting failed",
                           template=template, error=str(e))
             return template
 
@@ -900,6 +1091,10 @@ You can delete this file after reading the notification.
         if len(self.notification_history) > self.max_history:
             self.notification_history = self.notification_history[-self.max_history:]
 
+        # Wake the background writer - the notify path itself never touches disk
+        if self._history_dirty is not None:
+            self._history_dirty.set()
+
     async def _notify_callbacks(self, event_type: str, data: Dict[str, Any]):
         """Notify all registered callbacks"""
         
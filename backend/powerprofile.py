@@ -0,0 +1,123 @@
+"""
+Power Profile Manager for DeployBot
+
+Coordinates a low-power profile for all-day laptop use: when the machine is
+on battery (or the user toggles it explicitly), background cadences are
+stretched - monitor polling slows, timer pushes stop in favour of client
+interpolation, analytics rollups pause - while evented paths (FIFO fast
+path, filesystem watchers, notification delivery) stay untouched.
+
+Battery state is polled from `pmset -g batt` on macOS; on other platforms
+(or when the probe fails) only the user toggle drives the profile.
+"""
+
+import asyncio
+import subprocess
+import time
+from typing import Any, Callable, Dict, List, Optional
+
+import structlog
+
+logger = structlog.get_logger()
+
+
+class PowerProfileManager:
+    """Battery-aware low-power profile shared by every background cadence"""
+
+    def __init__(self):
+        self.low_power_active = False
+        self.user_override: Optional[bool] = None  # True/False pins the profile, None follows battery
+        self.battery_poll_interval = 60.0  # Seconds between pmset probes
+        self.cadence_factor = 4  # How much consumers stretch their intervals
+
+        self._on_battery = False
+        self._battery_task: Optional[asyncio.Task] = None
+        self._listeners: List[Callable] = []
+
+        logger.info("🔋 [POWER] Power profile manager initialized")
+
+    def add_listener(self, callback: Callable):
+        """Register callback(low_power: bool) fired on every profile change"""
+        self._listeners.append(callback)
+
+    async def start(self):
+        """Start the battery watcher (idempotent)"""
+        if self._battery_task and not self._battery_task.done():
+            return
+        self._battery_task = asyncio.create_task(self._battery_loop())
+
+    async def stop(self):
+        """Stop the battery watcher (backend shutdown)"""
+        if self._battery_task:
+            self._battery_task.cancel()
+            try:
+                await self._battery_task
+            except asyncio.CancelledError:
+                pass
+            self._battery_task = None
+
+    async def set_user_override(self, enabled: Optional[bool]):
+        """Pin low power on/off, or None to follow battery state again"""
+        self.user_override = enabled
+        logger.info("🔋 [POWER] User override set", override=enabled)
+        await self._apply()
+
+    def status(self) -> Dict[str, Any]:
+        """Current profile state for the status surface"""
+        return {
+            "low_power_active": self.low_power_active,
+            "on_battery": self._on_battery,
+            "user_override": self.user_override,
+        }
+
+    def _read_battery_state(self) -> Optional[bool]:
+        """Whether the machine is on battery (None when undeterminable)"""
+        try:
+            result = subprocess.run(['pmset', '-g', 'batt'],
+                                  capture_output=True, text=True, timeout=5)
+            if result.returncode != 0:
+                return None
+            return "Battery Power" in result.stdout
+        except Exception:
+            return None
+
+    async def _battery_loop(self):
+        """Poll power source on a slow cadence and fold it into the profile"""
+        loop = asyncio.get_running_loop()
+        try:
+            while True:
+                state = await loop.run_in_executor(None, self._read_battery_state)
+                if state is not None and state != self._on_battery:
+                    self._on_battery = state
+                    logger.info("🔋 [POWER] Power source changed",
+                               on_battery=state)
+                    await self._apply()
+                await asyncio.sleep(self.battery_poll_interval)
+        except asyncio.CancelledError:
+            pass
+        except Exception as e:
+            logger.error("❌ [POWER] Battery watcher failed", error=str(e))
+
+    async def _apply(self):
+        """Recompute the effective profile and notify listeners on change"""
+        desired = (self.user_override if self.user_override is not None
+                   else self._on_battery)
+        if desired == self.low_power_active:
+            return
+
+        self.low_power_active = desired
+        logger.info("🔋 [POWER] Low-power profile " +
+                    ("activated" if desired else "deactivated"),
+                   on_battery=self._on_battery, user_override=self.user_override)
+
+        for listener in list(self._listeners):
+            try:
+                result = listener(desired)
+                if asyncio.iscoroutine(result):
+                    await result
+            except Exception as e:
+                logger.warning("⚠️ [POWER] Profile listener failed", error=str(e))
+
+
+# Global power profile instance
+power_profile = PowerProfileManager()
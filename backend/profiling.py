@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+On-Demand In-Process Statistical Profiler for DeployBot
+
+Attaching an external profiler to the bundled runtime on a user's
+machine is painful, so this samples the interpreter from inside the
+process instead: a background thread walks sys._current_frames() at a
+fixed interval and aggregates collapsed call stacks (the flamegraph
+input format, "module:func;module:func 42"). Sampling costs nothing
+when stopped and a few percent while running, so it is safe to flip on
+during a live slow session via the profile-start/profile-stop commands.
+"""
+
+import sys
+import threading
+import time
+import traceback
+from typing import Dict, Any, Optional
+
+import structlog
+
+logger = structlog.get_logger()
+
+DEFAULT_INTERVAL_MS = 10.0
+MAX_REPORT_STACKS = 100
+
+
+class StatisticalProfiler:
+    """Samples all thread stacks on an interval and aggregates collapsed stacks"""
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self._thread: Optional[threading.Thread] = None
+        self._stop_event = threading.Event()
+        self._stack_counts: Dict[str, int] = {}
+        self._sample_count = 0
+        self._started_at: Optional[float] = None
+        self._interval_s = DEFAULT_INTERVAL_MS / 1000.0
+
+    @property
+    def running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def start(self, interval_ms: float = DEFAULT_INTERVAL_MS) -> bool:
+        """Start the sampling thread; returns False if already running"""
+        with self._lock:
+            if self.running:
+                logger.warning("⚠️ [PROFILER] Profiler already running")
+                return False
+
+            self._interval_s = max(1.0, float(interval_ms)) / 1000.0
+            self._stack_counts = {}
+            self._sample_count = 0
+            self._started_at = time.time()
+            self._stop_event.clear()
+            self._thread = threading.Thread(
+                target=self._sample_loop, name="deploybot-profiler", daemon=True
+            )
+            self._thread.start()
+
+        logger.info("🔬 [PROFILER] Statistical profiler started",
+                    interval_ms=self._interval_s * 1000)
+        return True
+
+    def stop(self) -> Dict[str, Any]:
+        """Stop sampling and return the collapsed-stack report"""
+        with self._lock:
+            if not self.running:
+                logger.warning("⚠️ [PROFILER] Profiler not running")
+                return {"running": False, "samples": 0, "stacks": []}
+
+            self._stop_event.set()
+            thread = self._thread
+        thread.join(timeout=2.0)
+
+        with self._lock:
+            self._thread = None
+            duration = time.time() - (self._started_at or time.time())
+            ranked = sorted(self._stack_counts.items(), key=lambda kv: kv[1], reverse=True)
+
+            report = {
+                "running": False,
+                "samples": self._sample_count,
+                "duration_seconds": round(duration, 2),
+                "interval_ms": self._interval_s * 1000,
+                "distinct_stacks": len(ranked),
+                # Flamegraph-ready collapsed format, heaviest stacks first
+                "stacks": [f"{stack} {count}" for stack, count in ranked[:MAX_REPORT_STACKS]],
+            }
+
+        logger.info("🔬 [PROFILER] Statistical profiler stopped",
+                    samples=report["samples"], distinct_stacks=report["distinct_stacks"])
+        return report
+
+    def get_status(self) -> Dict[str, Any]:
+        """Lightweight status for the profile-status side of the command"""
+        return {
+            "running": self.running,
+            "samples": self._sample_count,
+            "interval_ms": self._interval_s * 1000,
+            "started_at": self._started_at,
+        }
+
+    def _sample_loop(self):
+        """Sampling thread body - never raises, never blocks the loop"""
+        own_ident = threading.get_ident()
+        while not self._stop_event.wait(self._interval_s):
+            try:
+                frames = sys._current_frames()
+                for ident, frame in frames.items():
+                    if ident == own_ident:
+                        continue
+                    stack = self._collapse_stack(frame)
+                    if stack:
+                        self._stack_counts[stack] = self._stack_counts.get(stack, 0) + 1
+                self._sample_count += 1
+            except Exception:
+                # Sampling must never take down the backend
+                logger.warning("⚠️ [PROFILER] Sample failed",
+                               error=traceback.format_exc(limit=1))
+
+    @staticmethod
+    def _collapse_stack(frame) -> str:
+        """Render a frame chain as 'outermost;...;innermost' collapsed form"""
+        parts = []
+        while frame is not None:
+            code = frame.f_code
+            module = code.co_filename.rsplit("/", 1)[-1]
+            parts.append(f"{module}:{code.co_name}")
+            frame = frame.f_back
+        parts.reverse()
+        return ";".join(parts)
+
+
+# Global profiler instance
+stack_profiler = StatisticalProfiler()
@@ -9,6 +9,7 @@ This enables users to store projects anywhere on their filesystem rather than be
 restricted to the default DeployBot/projects directory.
 """
 
+import asyncio
 import json
 import os
 from pathlib import Path
@@ -16,6 +17,8 @@ from typing import Dict, Any, List, Optional, Tuple
 from datetime import datetime
 import structlog
 
+import jsoncodec
+
 logger = structlog.get_logger()
 
 class ProjectDirectoryManager:
@@ -52,9 +55,15 @@ class ProjectDirectoryManager:
         # Default projects directory (for backward compatibility)
         self.default_projects_root = Path(__file__).parent.parent / "projects"
         
-        # In-memory cache of mappings
+        # In-memory cache of mappings, invalidated when the mappings file's
+        # mtime changes on disk (path resolution sits on hot paths like
+        # per-entry activity logging, so lookups must not re-read the file)
         self._mappings_cache: Dict[str, str] = {}
         self._cache_loaded = False
+        self._mappings_mtime_ns: Optional[int] = None
+
+        # Cache of resolved default-directory paths (avoids a stat per lookup)
+        self._default_path_cache: Dict[str, str] = {}
         
         logger.info("📂 [PROJECT_DIR_MANAGER] ProjectDirectoryManager initialized", 
                    config_dir=str(self.config_dir),
@@ -68,25 +77,35 @@ class ProjectDirectoryManager:
         Returns:
             Dictionary mapping project names to directory paths
         """
-        logger.info("📖 [PROJECT_DIR_MANAGER] Loading project directory mappings...")
-        
         try:
             if not self.mappings_file.exists():
                 logger.info("📄 [PROJECT_DIR_MANAGER] No mappings file found, creating empty mappings")
                 await self._save_mappings({})
                 return {}
-            
+
+            # Serve from the in-memory cache when the file on disk hasn't
+            # changed - a single stat instead of a read + JSON parse
+            file_mtime_ns = self.mappings_file.stat().st_mtime_ns
+            if self._cache_loaded and file_mtime_ns == self._mappings_mtime_ns:
+                logger.debug("📖 [PROJECT_DIR_MANAGER] Serving mappings from cache",
+                            project_count=len(self._mappings_cache))
+                return self._mappings_cache.copy()
+
+            logger.info("📖 [PROJECT_DIR_MANAGER] Loading project directory mappings...")
+
             with open(self.mappings_file, 'r', encoding='utf-8') as f:
-                data = json.load(f)
-            
+                data = jsoncodec.load(f)
+
             # Extract just the mappings from the stored data
             mappings = data.get("project_mappings", {})
-            
+
             # Update cache
             self._mappings_cache = mappings.copy()
             self._cache_loaded = True
-            
-            logger.info("✅ [PROJECT_DIR_MANAGER] Project mappings loaded successfully", 
+            self._mappings_mtime_ns = file_mtime_ns
+            self._default_path_cache.clear()
+
+            logger.info("✅ [PROJECT_DIR_MANAGER] Project mappings loaded successfully",
                        project_count=len(mappings),
                        projects=list(mappings.keys()))
             
@@ -140,7 +159,12 @@ class ProjectDirectoryManager:
             # Update cache
             self._mappings_cache = mappings.copy()
             self._cache_loaded = True
-            
+            try:
+                self._mappings_mtime_ns = self.mappings_file.stat().st_mtime_ns
+            except OSError:
+                self._mappings_mtime_ns = None
+            self._default_path_cache.clear()
+
             logger.info("✅ [PROJECT_DIR_MANAGER] Project mappings saved successfully")
             return True
             
@@ -261,11 +285,17 @@ class ProjectDirectoryManager:
                            project_name=project_name, path=custom_path)
                 return custom_path
             
-            # Fallback to default directory
+            # Fallback to default directory (positive results cached so repeat
+            # lookups skip the filesystem stat; misses stay uncached so newly
+            # created projects are picked up immediately)
+            if project_name in self._default_path_cache:
+                return self._default_path_cache[project_name]
+
             default_path = self.default_projects_root / project_name
             if default_path.exists():
-                logger.debug("📍 [PROJECT_DIR_MANAGER] Found in default directory", 
+                logger.debug("📍 [PROJECT_DIR_MANAGER] Found in default directory",
                            project_name=project_name, path=str(default_path))
+                self._default_path_cache[project_name] = str(default_path)
                 return str(default_path)
             
             logger.debug("❓ [PROJECT_DIR_MANAGER] Project not found", 
@@ -333,16 +363,66 @@ class ProjectDirectoryManager:
     async def validate_project_directory(self, project_path: str) -> Dict[str, Any]:
         """
         Validate that a directory is suitable for a DeployBot project
-        
+
         Args:
             project_path: Path to validate
-            
+
         Returns:
             Validation result with details
         """
-        logger.info("🔍 [PROJECT_DIR_MANAGER] Validating project directory", 
+        logger.info("🔍 [PROJECT_DIR_MANAGER] Validating project directory",
                    project_path=project_path)
-        
+
+        # Run the blocking filesystem checks off the event loop so concurrent
+        # validations (bulk-add flow) actually overlap
+        loop = asyncio.get_event_loop()
+        return await loop.run_in_executor(None, self._validate_directory_sync, project_path)
+
+    async def validate_project_directories(self, project_paths: List[str],
+                                           progress_callback=None) -> List[Dict[str, Any]]:
+        """
+        Validate multiple directories concurrently
+
+        Each directory's filesystem checks run in the thread pool, bounded so
+        a large bulk-add doesn't exhaust executor threads. Results arrive in
+        roughly the time of a single validation instead of one per directory.
+
+        Args:
+            project_paths: Paths to validate
+            progress_callback: Optional async callable invoked with each result
+                               as it completes (for incremental UI updates)
+
+        Returns:
+            Validation results in the same order as project_paths
+        """
+        logger.info("🔍 [PROJECT_DIR_MANAGER] Validating directories in batch",
+                   directory_count=len(project_paths))
+
+        loop = asyncio.get_event_loop()
+        validate_semaphore = asyncio.Semaphore(16)
+        results: List[Optional[Dict[str, Any]]] = [None] * len(project_paths)
+
+        async def validate_one(index: int, project_path: str):
+            async with validate_semaphore:
+                result = await loop.run_in_executor(
+                    None, self._validate_directory_sync, project_path)
+            results[index] = result
+            if progress_callback:
+                await progress_callback(index, result)
+
+        await asyncio.gather(*[
+            validate_one(index, project_path)
+            for index, project_path in enumerate(project_paths)
+        ])
+
+        logger.info("✅ [PROJECT_DIR_MANAGER] Batch validation completed",
+                   directory_count=len(project_paths),
+                   valid_count=sum(1 for r in results if r and r.get("valid")))
+
+        return results
+
+    def _validate_directory_sync(self, project_path: str) -> Dict[str, Any]:
+        """Blocking validation body - always called from the thread pool"""
         try:
             path_obj = Path(project_path).resolve()
             
@@ -420,10 +500,19 @@ class ProjectDirectoryManager:
                 "issues": [f"Validation error: {str(e)}"]
             }
 
-    async def migrate_existing_projects(self) -> Dict[str, Any]:
+    async def migrate_existing_projects(self, progress_callback=None) -> Dict[str, Any]:
         """
         Migrate existing projects from the default directory to the mapping system
-        
+
+        Candidates are checked with bounded parallelism (same pattern as batch
+        directory validation) and each project's outcome is reported through
+        progress_callback as it lands, so a first-run migration of many
+        projects shows visible progress instead of a silent stall.
+
+        Args:
+            progress_callback: Optional async callable invoked as
+                               (index, total, result) per examined project
+
         Returns:
             Migration report with details
         """
@@ -446,41 +535,71 @@ class ProjectDirectoryManager:
                 logger.info("📂 [PROJECT_DIR_MANAGER] No default projects directory found")
                 return migration_report
             
-            for project_dir in self.default_projects_root.iterdir():
-                if not project_dir.is_dir():
-                    continue
-                
+            project_dirs = [p for p in sorted(self.default_projects_root.iterdir())
+                            if p.is_dir()]
+            total = len(project_dirs)
+            migration_report["projects_found"] = total
+
+            # Check project structure with bounded parallelism (the stats run
+            # in the thread pool, so examining N projects overlaps instead of
+            # paying the filesystem latency serially) and report each outcome
+            # as it lands
+            loop = asyncio.get_event_loop()
+            migrate_semaphore = asyncio.Semaphore(16)
+            outcomes: List[Optional[Dict[str, Any]]] = [None] * total
+
+            def has_project_structure(project_dir: Path) -> bool:
+                return (project_dir / "config.json").exists() and \
+                       (project_dir / "TODO.md").exists()
+
+            async def examine_one(index: int, project_dir: Path):
                 project_name = project_dir.name
-                migration_report["projects_found"] += 1
-                
-                # Skip if already mapped
                 if project_name in current_mappings:
-                    logger.info("⏭️ [PROJECT_DIR_MANAGER] Project already mapped, skipping", 
-                              project_name=project_name)
+                    result = {"project_name": project_name, "status": "already_mapped"}
+                else:
+                    async with migrate_semaphore:
+                        is_valid = await loop.run_in_executor(
+                            None, has_project_structure, project_dir)
+                    result = {
+                        "project_name": project_name,
+                        "status": "migrated" if is_valid else "invalid_structure"
+                    }
+                outcomes[index] = result
+                if progress_callback:
+                    await progress_callback(index, total, result)
+
+            await asyncio.gather(*[
+                examine_one(index, project_dir)
+                for index, project_dir in enumerate(project_dirs)
+            ])
+
+            new_mappings = dict(current_mappings)
+            for project_dir, outcome in zip(project_dirs, outcomes):
+                status = outcome["status"]
+                if status == "already_mapped":
+                    logger.info("⏭️ [PROJECT_DIR_MANAGER] Project already mapped, skipping",
+                              project_name=outcome["project_name"])
                     migration_report["projects_skipped"] += 1
-                    continue
-                
-                # Check if it's a valid DeployBot project
-                config_file = project_dir / "config.json"
-                todo_file = project_dir / "TODO.md"
-                
-                if not (config_file.exists() and todo_file.exists()):
-                    logger.warning("⚠️ [PROJECT_DIR_MANAGER] Invalid project structure, skipping", 
-                                 project_name=project_name)
+                elif status == "invalid_structure":
+                    logger.warning("⚠️ [PROJECT_DIR_MANAGER] Invalid project structure, skipping",
+                                 project_name=outcome["project_name"])
                     migration_report["projects_skipped"] += 1
-                    continue
-                
-                # Add to mappings (pointing to current location)
-                success = await self.add_project_mapping(project_name, str(project_dir))
-                
-                if success:
-                    migration_report["projects_migrated"] += 1
-                    logger.info("✅ [PROJECT_DIR_MANAGER] Project migrated successfully", 
-                               project_name=project_name)
                 else:
-                    migration_report["errors"].append(f"Failed to migrate {project_name}")
-                    logger.error("❌ [PROJECT_DIR_MANAGER] Failed to migrate project", 
-                               project_name=project_name)
+                    new_mappings[outcome["project_name"]] = str(project_dir.resolve())
+
+            # Persist all new mappings in one save instead of a load+save
+            # round-trip per project
+            migrated = len(new_mappings) - len(current_mappings)
+            if migrated > 0:
+                if await self._save_mappings(new_mappings):
+                    migration_report["projects_migrated"] = migrated
+                    logger.info("✅ [PROJECT_DIR_MANAGER] Projects migrated successfully",
+                               migrated_count=migrated)
+                else:
+                    migration_report["errors"].append(
+                        f"Failed to save mappings for {migrated} migrated projects")
+                    logger.error("❌ [PROJECT_DIR_MANAGER] Failed to save migrated mappings",
+                               migrated_count=migrated)
             
             logger.info("🎉 [PROJECT_DIR_MANAGER] Migration completed", 
                        found=migration_report["projects_found"],
@@ -10,9 +10,12 @@ ProjectDirectoryManager system, allowing projects to be stored anywhere
 on the filesystem rather than being restricted to DeployBot/projects.
 """
 
+import asyncio
 import json
 import os
 import shutil
+import subprocess
+import sys
 from pathlib import Path
 from typing import Dict, Any, List, Optional
 from datetime import datetime
@@ -49,11 +52,118 @@ class ProjectManager:
         
         # Store reference to the project directory manager
         self.directory_manager = project_directory_manager
-        
-        logger.info("📁 [PROJECT_MANAGER] ProjectManager initialized with custom directory support", 
+
+        # Persistent manifest of parsed project summaries, invalidated per
+        # entry by file mtimes so unchanged projects are never re-parsed
+        self.manifest_file = Path.home() / ".deploybot" / "project_manifest.json"
+        self._manifest = self._load_manifest()
+        self._manifest_dirty = False
+
+        # In-memory config registry validated by mtime: repeated loads are
+        # dict lookups, and external edits are picked up immediately when the
+        # project-root watcher (or the next access) notices the new mtime
+        self._config_registry = {}  # str(project_dir) -> (mtime_ns, config)
+
+        # Project templates instantiated by clonefile/reflink (or hardlinks)
+        # so a heavyweight scaffold appears instantly instead of file by file
+        self.templates_root = Path.home() / ".deploybot" / "templates"
+
+        # Two-phase deletion: projects are renamed here instantly and the
+        # actual tree removal happens in a background reclamation task
+        self.trash_root = Path.home() / ".deploybot" / "trash"
+
+        # WebSocket server for pushing deletion/reclaim progress to the UI
+        self.websocket_server = None
+
+        logger.info("📁 [PROJECT_MANAGER] ProjectManager initialized with custom directory support",
                    default_projects_root=str(self.projects_root),
                    uses_custom_directories=True,
-                   directory_manager_available=self.directory_manager is not None)
+                   directory_manager_available=self.directory_manager is not None,
+                   manifest_entries=len(self._manifest))
+
+    def set_websocket_server(self, websocket_server):
+        """Set the WebSocket server for broadcasting project events"""
+        self.websocket_server = websocket_server
+
+    async def _broadcast_project_event(self, event: str, data: Dict[str, Any]):
+        """Push a project lifecycle event to connected clients (best effort)"""
+        if not self.websocket_server:
+            return
+        try:
+            await self.websocket_server.broadcast({
+                "type": "project",
+                "event": event,
+                "data": {**data, "timestamp": datetime.now().isoformat()}
+            })
+        except Exception as e:
+            logger.warning("⚠️ [PROJECT_MANAGER] Failed to broadcast project event",
+                         event=event, error=str(e))
+
+    def _load_manifest(self) -> Dict[str, Any]:
+        """Load the persisted project manifest (empty on first run or corruption)"""
+        try:
+            if self.manifest_file.exists():
+                return json.loads(self.manifest_file.read_text(encoding='utf-8'))
+        except Exception as e:
+            logger.warning("⚠️ [PROJECT_MANAGER] Failed to load project manifest", error=str(e))
+        return {}
+
+    def _save_manifest(self):
+        """Write the manifest back to disk if anything changed"""
+        if not self._manifest_dirty:
+            return
+        try:
+            self.manifest_file.parent.mkdir(parents=True, exist_ok=True)
+            temp_file = self.manifest_file.with_suffix('.tmp')
+            temp_file.write_text(json.dumps(self._manifest), encoding='utf-8')
+            temp_file.replace(self.manifest_file)
+            self._manifest_dirty = False
+        except Exception as e:
+            logger.warning("⚠️ [PROJECT_MANAGER] Failed to save project manifest", error=str(e))
+
+    @staticmethod
+    def _file_mtime_ns(path: Path) -> Optional[int]:
+        """mtime_ns of a file, or None when it doesn't exist"""
+        try:
+            return path.stat().st_mtime_ns
+        except OSError:
+            return None
+
+    def _read_config(self, project_dir: Path) -> Optional[Dict[str, Any]]:
+        """Read a project's config.json through the mtime-validated registry"""
+        config_file = project_dir / "config.json"
+        mtime = self._file_mtime_ns(config_file)
+        if mtime is None:
+            self._config_registry.pop(str(project_dir), None)
+            return None
+
+        cached = self._config_registry.get(str(project_dir))
+        if cached and cached[0] == mtime:
+            return cached[1]
+
+        with open(config_file, 'r') as f:
+            config = json.load(f)
+        self._config_registry[str(project_dir)] = (mtime, config)
+        return config
+
+    def refresh_config(self, project_dir: str) -> Optional[Dict[str, Any]]:
+        """Drop and re-read a project's config after an external change"""
+        path_obj = Path(project_dir)
+        self._config_registry.pop(str(path_obj), None)
+        try:
+            return self._read_config(path_obj)
+        except Exception as e:
+            logger.warning("⚠️ [PROJECT_MANAGER] Failed to refresh config",
+                          project_dir=project_dir, error=str(e))
+            return None
+
+    def _project_fingerprint(self, project_dir: Path) -> Dict[str, Optional[int]]:
+        """Mtime fingerprint of the files a project summary is derived from"""
+        return {
+            "config": self._file_mtime_ns(project_dir / "config.json"),
+            "todo": self._file_mtime_ns(project_dir / "TODO.md"),
+            "activity": self._file_mtime_ns(project_dir / "logs" / "activity.log")
+        }
 
     async def create_project(self, project_data: Dict[str, Any]) -> Dict[str, Any]:
         """
@@ -127,32 +237,70 @@ class ProjectManager:
                     "message": f"A project named '{project_name}' already exists"
                 }
             
-            # Create project directory structure
-            project_path.mkdir(parents=True)
-            (project_path / "logs").mkdir()
-            
-            # Create default config.json
+            # Instantiate from a template (clonefile/reflink, hardlinks as
+            # fallback) or create the bare directory structure
+            template_name = (project_data.get("template") or "").strip()
+            template_method = None
+            if template_name:
+                template_dir = self._resolve_template(template_name)
+                if template_dir is None:
+                    return {
+                        "success": False,
+                        "error": "Template not found",
+                        "message": f"Project template '{template_name}' does not exist"
+                    }
+
+                project_path.parent.mkdir(parents=True, exist_ok=True)
+                template_method = await self._instantiate_template(template_dir, project_path)
+                if template_method is None:
+                    return {
+                        "success": False,
+                        "error": "Template instantiation failed",
+                        "message": f"Could not instantiate template '{template_name}'"
+                    }
+                (project_path / "logs").mkdir(exist_ok=True)
+            else:
+                project_path.mkdir(parents=True)
+                (project_path / "logs").mkdir()
+
+            # Create default config.json. Cloned/hardlinked files share the
+            # template's inode, so personalized files are unlinked first -
+            # writing through the link would edit the template itself
             config = self._create_default_config(project_name, project_data)
             config_file = project_path / "config.json"
+            if template_method:
+                config_file.unlink(missing_ok=True)
             with open(config_file, 'w') as f:
                 json.dump(config, f, indent=2)
-            
-            # Create default TODO.md
-            todo_content = self._create_default_todo(project_name)
+
+            # Create default TODO.md unless the template ships its own
             todo_file = project_path / "TODO.md"
-            todo_file.write_text(todo_content)
-            
+            if not todo_file.exists():
+                todo_file.write_text(self._create_default_todo(project_name))
+
             # Create initial activity log
             activity_log = project_path / "logs" / "activity.log"
+            if template_method:
+                activity_log.unlink(missing_ok=True)
             timestamp = datetime.now().strftime("[%Y-%m-%d %H:%M:%S]")
             with open(activity_log, 'w') as f:
                 f.write(f"{timestamp} PROJECT CREATED: {project_name} initialized\n")
                 f.write(f"{timestamp} CONFIG CREATED: Default configuration generated\n")
                 f.write(f"{timestamp} TODO CREATED: Default task list created\n")
-            
+                if template_method:
+                    f.write(f"{timestamp} TEMPLATE APPLIED: {template_name} via {template_method}\n")
+
             # Create empty deploy log
             deploy_log = project_path / "logs" / "deploy_log.txt"
+            if template_method:
+                deploy_log.unlink(missing_ok=True)
             deploy_log.touch()
+
+            # Placeholder substitution across the cloned tree runs in the
+            # background - the project is usable immediately
+            if template_method:
+                asyncio.create_task(
+                    self._finish_template_fixup(project_name, project_path, template_method))
             
             # Register the project in the directory mapping system
             mapping_success = await self.directory_manager.add_project_mapping(project_name, str(project_path))
@@ -176,7 +324,9 @@ class ProjectManager:
                     "config": config,
                     "created_at": config["createdAt"],
                     "uses_custom_directory": bool(custom_directory),
-                    "custom_directory": custom_directory if custom_directory else None
+                    "custom_directory": custom_directory if custom_directory else None,
+                    "template": template_name if template_method else None,
+                    "template_method": template_method
                 }
             }
             
@@ -246,26 +396,49 @@ class ProjectManager:
                        in_custom_mapping=is_custom_mapped,
                        will_proceed=True)
             
-            # Remove the entire project directory
-            shutil.rmtree(path_obj)
-            
+            # Phase 1: rename the tree into the trash area - an O(1) rename
+            # regardless of project size, so the command returns instantly.
+            # Cross-filesystem projects can't be renamed; those fall back to
+            # an executor rmtree (still off the event loop, just not O(1))
+            self.trash_root.mkdir(parents=True, exist_ok=True)
+            trash_path = self.trash_root / f"{path_obj.name}.{os.getpid()}.{datetime.now().strftime('%Y%m%d%H%M%S%f')}"
+            reclaim_scheduled = False
+            try:
+                path_obj.rename(trash_path)
+                reclaim_scheduled = True
+            except OSError as e:
+                logger.warning("⚠️ [PROJECT_MANAGER] Trash rename failed - removing inline",
+                             project_path=str(path_obj), error=str(e))
+                loop = asyncio.get_event_loop()
+                await loop.run_in_executor(None, shutil.rmtree, path_obj)
+
+            # Drop cached state for the deleted tree
+            self._config_registry.pop(str(path_obj), None)
+
             # Clean up the project mapping if it exists
             mapping_removed = await self.directory_manager.remove_project_mapping(project_name)
-            
-            logger.info("✅ [PROJECT_MANAGER] Project deleted successfully", 
-                       project_name=project_name, 
+
+            # Phase 2: reclaim the trashed tree in the background with
+            # progress events - the UI is already done at this point
+            if reclaim_scheduled:
+                asyncio.create_task(self._reclaim_trash(project_name, trash_path))
+
+            logger.info("✅ [PROJECT_MANAGER] Project deleted successfully",
+                       project_name=project_name,
                        project_path=project_path,
-                       mapping_cleaned_up=mapping_removed)
-            
+                       mapping_cleaned_up=mapping_removed,
+                       reclaim_in_background=reclaim_scheduled)
+
             return {
                 "success": True,
                 "message": f"Project '{project_name}' deleted successfully",
                 "deleted_path": project_path,
-                "mapping_cleaned_up": mapping_removed
+                "mapping_cleaned_up": mapping_removed,
+                "reclaim_in_background": reclaim_scheduled
             }
             
         except Exception as e:
-            logger.error("❌ [PROJECT_MANAGER] Failed to delete project", 
+            logger.error("❌ [PROJECT_MANAGER] Failed to delete project",
                         project_path=project_path, error=str(e))
             return {
                 "success": False,
@@ -273,72 +446,183 @@ class ProjectManager:
                 "message": f"Failed to delete project: {str(e)}"
             }
 
-    async def list_projects(self) -> Dict[str, Any]:
+    async def _reclaim_trash(self, project_name: str, trash_path: Path):
+        """
+        Background reclamation of a trashed project tree
+
+        Removes top-level entries one at a time in the executor, broadcasting
+        progress after each so a deletion with gigabytes of build artifacts
+        shows visible movement instead of a silent disk grind.
+        """
+        loop = asyncio.get_event_loop()
+        started = datetime.now()
+
+        try:
+            entries = sorted(trash_path.iterdir(), key=lambda p: p.name)
+        except OSError:
+            entries = []
+
+        await self._broadcast_project_event("delete_reclaim_started", {
+            "project_name": project_name,
+            "entries_total": len(entries)
+        })
+
+        removed = 0
+        for entry in entries:
+            try:
+                if entry.is_dir() and not entry.is_symlink():
+                    await loop.run_in_executor(
+                        None, lambda e=entry: shutil.rmtree(e, ignore_errors=True))
+                else:
+                    await loop.run_in_executor(None, lambda e=entry: e.unlink(missing_ok=True))
+                removed += 1
+                await self._broadcast_project_event("delete_reclaim_progress", {
+                    "project_name": project_name,
+                    "entries_removed": removed,
+                    "entries_total": len(entries)
+                })
+            except Exception as e:
+                logger.warning("⚠️ [PROJECT_MANAGER] Failed to reclaim trash entry",
+                             entry=str(entry), error=str(e))
+
+        try:
+            await loop.run_in_executor(
+                None, lambda: shutil.rmtree(trash_path, ignore_errors=True))
+        except Exception:
+            pass
+
+        duration = (datetime.now() - started).total_seconds()
+        await self._broadcast_project_event("delete_reclaim_complete", {
+            "project_name": project_name,
+            "entries_removed": removed,
+            "duration_seconds": round(duration, 2)
+        })
+        logger.info("🧹 [PROJECT_MANAGER] Trash reclamation complete",
+                   project_name=project_name, entries_removed=removed,
+                   duration_seconds=round(duration, 2))
+
+    async def sweep_trash(self):
+        """Remove trash left behind by a previous session (crash mid-reclaim)"""
+        if not self.trash_root.is_dir():
+            return
+
+        loop = asyncio.get_event_loop()
+        try:
+            leftovers = list(self.trash_root.iterdir())
+        except OSError:
+            return
+
+        for leftover in leftovers:
+            logger.info("🧹 [PROJECT_MANAGER] Sweeping leftover trash from previous session",
+                       path=str(leftover))
+            try:
+                if leftover.is_dir() and not leftover.is_symlink():
+                    await loop.run_in_executor(
+                        None, lambda p=leftover: shutil.rmtree(p, ignore_errors=True))
+                else:
+                    await loop.run_in_executor(None, lambda p=leftover: p.unlink(missing_ok=True))
+            except Exception as e:
+                logger.warning("⚠️ [PROJECT_MANAGER] Failed to sweep trash entry",
+                             path=str(leftover), error=str(e))
+
+    async def list_projects(self, lightweight: bool = False) -> Dict[str, Any]:
         """
         List all available projects from both default and custom directories
-        
+
         PHASE 1 ENHANCED: Now uses ProjectDirectoryManager to find projects
         in both default and custom locations
+
+        Args:
+            lightweight: Return only name/path/location per project, skipping
+                config and TODO.md parsing entirely - enough to populate the
+                selector dropdown instantly; full details load on selection
         """
-        logger.info("📋 [PROJECT_MANAGER] Listing all projects from all locations...")
-        
+        logger.info("📋 [PROJECT_MANAGER] Listing all projects from all locations...",
+                   lightweight=lightweight)
+
         try:
             projects = []
             default_count = 0
             custom_count = 0
-            
+
             # Get all projects using the directory manager
             all_project_locations = await self.directory_manager.list_all_projects()
-            
-            logger.info("🔍 [PROJECT_MANAGER] Found project locations", 
+
+            logger.info("🔍 [PROJECT_MANAGER] Found project locations",
                        total_locations=len(all_project_locations))
-            
-            # Process each project location
+
+            # Validate locations first, then load info for the valid ones
+            valid_locations = []
             for project_name, project_path in all_project_locations:
                 project_dir = Path(project_path)
-                
+
                 # Check if it's a valid DeployBot project
                 config_file = project_dir / "config.json"
                 todo_file = project_dir / "TODO.md"
-                
+
                 if not config_file.exists() or not todo_file.exists():
-                    logger.warning("⚠️ [PROJECT_MANAGER] Skipping invalid project directory", 
+                    logger.warning("⚠️ [PROJECT_MANAGER] Skipping invalid project directory",
                                  project_name=project_name,
                                  directory=str(project_dir),
                                  has_config=config_file.exists(),
                                  has_todo=todo_file.exists())
                     continue
-                
-                try:
-                    # Load project metadata
-                    project_info = await self._load_project_info(project_dir)
-                    if project_info:
-                        # Add location metadata
-                        is_in_default = str(project_dir).startswith(str(self.projects_root))
-                        project_info["is_custom_directory"] = not is_in_default
-                        project_info["location_type"] = "default" if is_in_default else "custom"
-                        
-                        if is_in_default:
-                            default_count += 1
-                        else:
-                            custom_count += 1
-                        
-                        projects.append(project_info)
-                        
-                        logger.debug("📂 [PROJECT_MANAGER] Loaded project info", 
-                                   project_name=project_name,
-                                   location_type=project_info["location_type"],
-                                   path=str(project_dir))
-                        
-                except Exception as e:
-                    logger.warning("⚠️ [PROJECT_MANAGER] Error loading project info", 
-                                 project_name=project_name,
-                                 project_dir=str(project_dir), 
-                                 error=str(e))
+
+                valid_locations.append((project_name, project_dir))
+
+            # Load metadata for all valid projects with a bounded parallel
+            # scan - per-directory awaits used to serialize 80 directories
+            load_semaphore = asyncio.Semaphore(8)
+
+            async def load_one(project_name: str, project_dir: Path) -> Optional[Dict[str, Any]]:
+                is_in_default = str(project_dir).startswith(str(self.projects_root))
+
+                if lightweight:
+                    return {
+                        "name": project_name,
+                        "path": str(project_dir),
+                        "is_custom_directory": not is_in_default,
+                        "location_type": "default" if is_in_default else "custom",
+                        "lightweight": True
+                    }
+
+                async with load_semaphore:
+                    try:
+                        project_info = await self._load_project_info(project_dir)
+                    except Exception as e:
+                        logger.warning("⚠️ [PROJECT_MANAGER] Error loading project info",
+                                     project_name=project_name,
+                                     project_dir=str(project_dir),
+                                     error=str(e))
+                        return None
+
+                if project_info:
+                    project_info["is_custom_directory"] = not is_in_default
+                    project_info["location_type"] = "default" if is_in_default else "custom"
+                    logger.debug("📂 [PROJECT_MANAGER] Loaded project info",
+                               project_name=project_name,
+                               location_type=project_info["location_type"],
+                               path=str(project_dir))
+                return project_info
+
+            loaded = await asyncio.gather(
+                *(load_one(name, project_dir) for name, project_dir in valid_locations)
+            )
+
+            for project_info in loaded:
+                if not project_info:
                     continue
-            
+                if project_info["location_type"] == "default":
+                    default_count += 1
+                else:
+                    custom_count += 1
+                projects.append(project_info)
+
+            # Persist any manifest entries refreshed during the scan
+            self._save_manifest()
+
             # Sort projects by last modified time (most recent first)
-            projects.sort(key=lambda x: x.get("lastModified", ""), reverse=True)
+            projects.sort(key=lambda x: x.get("lastModified", "") or "", reverse=True)
             
             logger.info("✅ [PROJECT_MANAGER] Projects listed successfully", 
                        total_projects=len(projects),
@@ -383,23 +667,36 @@ class ProjectManager:
                     "message": f"Project at path '{project_path}' does not exist"
                 }
             
-            # Load configuration
-            config_file = path_obj / "config.json"
-            if not config_file.exists():
+            # Load configuration through the registry (disk read only when
+            # the file actually changed); copy so callers can't mutate it
+            registry_config = self._read_config(path_obj)
+            if registry_config is None:
                 return {
                     "success": False,
                     "error": "Invalid project",
                     "message": "Project config.json not found"
                 }
-            
-            with open(config_file, 'r') as f:
-                config = json.load(f)
-            
-            # Load TODO.md tasks
+            config = dict(registry_config)
+
+            # Load TODO.md tasks, reusing the manifest's parse when the file
+            # hasn't changed since the last load
             todo_file = path_obj / "TODO.md"
             tasks = []
             if todo_file.exists():
-                tasks = await self._parse_todo_file(todo_file)
+                manifest_key = str(path_obj)
+                todo_mtime = self._file_mtime_ns(todo_file)
+                entry = self._manifest.get(manifest_key, {})
+                if entry.get("tasks_mtime") == todo_mtime and entry.get("tasks") is not None:
+                    logger.debug("📦 [PROJECT_MANAGER] Tasks served from manifest",
+                                project_path=manifest_key)
+                    tasks = [dict(task) for task in entry["tasks"]]
+                else:
+                    tasks = await self._parse_todo_file(todo_file)
+                    self._manifest.setdefault(manifest_key, {})
+                    self._manifest[manifest_key]["tasks_mtime"] = todo_mtime
+                    self._manifest[manifest_key]["tasks"] = [dict(task) for task in tasks]
+                    self._manifest_dirty = True
+                    self._save_manifest()
             
             # Load recent activity logs
             activity_log = path_obj / "logs" / "activity.log"
@@ -460,18 +757,21 @@ class ProjectManager:
                     "message": "Project config.json not found"
                 }
             
-            # Load current config
-            with open(config_file, 'r') as f:
-                config = json.load(f)
-            
+            # Load current config (registry hit when unchanged)
+            config = dict(self._read_config(path_obj) or {})
+
             # Update config with new values
             config.update(config_updates)
             config["lastModified"] = datetime.now().isoformat()
-            
+
             # Save updated config
             with open(config_file, 'w') as f:
                 json.dump(config, f, indent=2)
-            
+
+            # Reflect the write in the registry so the follow-up read that
+            # settings round trips do is a dict lookup, not a disk read
+            self._config_registry[str(path_obj)] = (self._file_mtime_ns(config_file), config)
+
             # Log the update
             await self._log_activity(path_obj, f"CONFIG UPDATED: Configuration modified")
             
@@ -541,22 +841,57 @@ class ProjectManager:
         
         return await self.directory_manager.validate_project_directory(directory_path)
 
-    async def migrate_existing_projects(self) -> Dict[str, Any]:
+    async def validate_custom_directories(self, directory_paths: List[str],
+                                          progress_callback=None) -> List[Dict[str, Any]]:
+        """
+        Validate multiple custom directories concurrently
+
+        Used by the bulk-add flow so validating many directories takes
+        roughly the time of one.
+
+        Args:
+            directory_paths: Paths to validate
+            progress_callback: Optional async callable invoked per result
+
+        Returns:
+            Validation results in input order
+        """
+        logger.info("🔍 [PROJECT_MANAGER] Validating custom directories in batch",
+                   directory_count=len(directory_paths))
+
+        return await self.directory_manager.validate_project_directories(
+            directory_paths, progress_callback=progress_callback)
+
+    async def migrate_existing_projects(self, progress_callback=None) -> Dict[str, Any]:
         """
         Migrate existing projects to the new directory mapping system
-        
+
         PHASE 1 NEW METHOD: Helps transition existing projects to the new system
-        
+
+        Args:
+            progress_callback: Optional async callable invoked as
+                               (index, total, result) per examined project
+
         Returns:
             Migration report with details
         """
         logger.info("🔄 [PROJECT_MANAGER] Starting project migration...")
-        
-        return await self.directory_manager.migrate_existing_projects()
+
+        return await self.directory_manager.migrate_existing_projects(
+            progress_callback=progress_callback)
 
     async def _load_project_info(self, project_dir: Path) -> Optional[Dict[str, Any]]:
-        """Load basic project information for listing"""
+        """Load basic project information for listing (manifest-cached)"""
         try:
+            # Serve from the manifest when the underlying files are unchanged
+            manifest_key = str(project_dir)
+            fingerprint = self._project_fingerprint(project_dir)
+            entry = self._manifest.get(manifest_key)
+            if entry and entry.get("fingerprint") == fingerprint and entry.get("info"):
+                logger.debug("📦 [PROJECT_MANAGER] Project info served from manifest",
+                            project_dir=manifest_key)
+                return dict(entry["info"])
+
             config_file = project_dir / "config.json"
             with open(config_file, 'r') as f:
                 config = json.load(f)
@@ -586,7 +921,7 @@ class ProjectManager:
                 except:
                     pass
             
-            return {
+            project_info = {
                 "name": config.get("projectName", project_dir.name),
                 "path": str(project_dir),
                 "description": config.get("description", ""),
@@ -597,7 +932,15 @@ class ProjectManager:
                 "completedTasks": completed_count,
                 "lastActivity": last_activity
             }
-            
+
+            # Record the freshly parsed summary in the manifest
+            self._manifest.setdefault(manifest_key, {})
+            self._manifest[manifest_key]["fingerprint"] = fingerprint
+            self._manifest[manifest_key]["info"] = dict(project_info)
+            self._manifest_dirty = True
+
+            return project_info
+
         except Exception as e:
             logger.warning("⚠️ [PROJECT_MANAGER] Error loading project info", 
                          project_dir=str(project_dir), error=str(e))
@@ -674,21 +1017,35 @@ class ProjectManager:
         # Default app
         return "Notion"
 
-    async def _load_recent_activities(self, activity_log: Path, limit: int = 20) -> List[str]:
-        """Load recent activity log entries"""
+    async def _load_recent_activities(self, activity_log: Path, limit: int = 20,
+                                      block_size: int = 8192) -> List[str]:
+        """
+        Load recent activity log entries by scanning fixed-size blocks
+        backwards from EOF (same approach as the activity logger's tail
+        reads). This runs per project inside list_projects, so its cost is
+        bounded by the lines requested rather than the log's full history.
+        """
         activities = []
-        
+
         try:
-            with open(activity_log, 'r') as f:
-                lines = f.readlines()
-                # Get the last N lines
-                recent_lines = lines[-limit:] if len(lines) > limit else lines
-                activities = [line.strip() for line in recent_lines if line.strip()]
-        
+            buffer = b""
+            with open(activity_log, 'rb') as f:
+                f.seek(0, os.SEEK_END)
+                position = f.tell()
+
+                while position > 0 and buffer.count(b"\n") <= limit:
+                    read_size = min(block_size, position)
+                    position -= read_size
+                    f.seek(position)
+                    buffer = f.read(read_size) + buffer
+
+            lines = buffer.decode('utf-8', errors='replace').splitlines()
+            activities = [line.strip() for line in lines[-limit:] if line.strip()]
+
         except Exception as e:
-            logger.error("❌ [PROJECT_MANAGER] Failed to load activity log", 
+            logger.error("❌ [PROJECT_MANAGER] Failed to load activity log",
                         activity_log=str(activity_log), error=str(e))
-        
+
         return activities
 
     async def _log_activity(self, project_path: Path, message: str):
@@ -704,6 +1061,119 @@ class ProjectManager:
             logger.warning("⚠️ [PROJECT_MANAGER] Failed to log activity", 
                          project_path=str(project_path), error=str(e))
 
+    def _resolve_template(self, template_name: str) -> Optional[Path]:
+        """Resolve a template name to its directory (absolute path or ~/.deploybot/templates/<name>)"""
+        candidate = Path(template_name).expanduser()
+        if not candidate.is_absolute():
+            candidate = self.templates_root / template_name
+
+        if candidate.is_dir():
+            return candidate
+
+        logger.warning("⚠️ [PROJECT_MANAGER] Template directory not found",
+                     template=template_name, resolved=str(candidate))
+        return None
+
+    async def _instantiate_template(self, template_dir: Path, project_path: Path) -> Optional[str]:
+        """
+        Instantiate a template directory at project_path as cheaply as possible
+
+        Tries copy-on-write cloning first (clonefile on APFS via `cp -c`,
+        reflinks on btrfs/XFS via `cp --reflink=auto`), then a hardlink copy,
+        then a plain recursive copy. Returns the method used, or None.
+        """
+        loop = asyncio.get_event_loop()
+
+        if sys.platform == "darwin":
+            clone_cmd = ["cp", "-c", "-R", str(template_dir), str(project_path)]
+            clone_method = "clonefile"
+        else:
+            clone_cmd = ["cp", "-R", "--reflink=auto", str(template_dir), str(project_path)]
+            clone_method = "reflink"
+
+        try:
+            result = await loop.run_in_executor(
+                None, lambda: subprocess.run(clone_cmd, capture_output=True, timeout=60))
+            if result.returncode == 0:
+                logger.info("📦 [PROJECT_MANAGER] Template instantiated via CoW clone",
+                           template=str(template_dir), method=clone_method)
+                return clone_method
+            logger.warning("⚠️ [PROJECT_MANAGER] CoW clone failed, falling back to hardlinks",
+                         stderr=result.stderr.decode(errors="replace").strip())
+        except Exception as e:
+            logger.warning("⚠️ [PROJECT_MANAGER] CoW clone errored, falling back to hardlinks",
+                         error=str(e))
+
+        shutil.rmtree(project_path, ignore_errors=True)
+
+        try:
+            await loop.run_in_executor(
+                None, lambda: shutil.copytree(template_dir, project_path, copy_function=os.link))
+            logger.info("📦 [PROJECT_MANAGER] Template instantiated via hardlinks",
+                       template=str(template_dir))
+            return "hardlink"
+        except Exception as e:
+            logger.warning("⚠️ [PROJECT_MANAGER] Hardlink copy failed, falling back to plain copy",
+                         error=str(e))
+
+        shutil.rmtree(project_path, ignore_errors=True)
+
+        try:
+            await loop.run_in_executor(
+                None, lambda: shutil.copytree(template_dir, project_path))
+            logger.info("📦 [PROJECT_MANAGER] Template instantiated via plain copy",
+                       template=str(template_dir))
+            return "copy"
+        except Exception as e:
+            logger.error("❌ [PROJECT_MANAGER] Template instantiation failed",
+                        template=str(template_dir), error=str(e))
+            shutil.rmtree(project_path, ignore_errors=True)
+            return None
+
+    async def _finish_template_fixup(self, project_name: str, project_path: Path, method: str):
+        """
+        Background pass substituting {{project_name}}/{{created_at}} placeholders
+
+        Runs after create_project has already returned - the cloned tree is
+        usable immediately and personalization trickles in. Files are rewritten
+        atomically via tmp + replace, which also breaks any hardlink back to
+        the template so the template itself is never mutated.
+        """
+        text_suffixes = {".md", ".txt", ".json", ".yml", ".yaml", ".toml",
+                         ".py", ".js", ".jsx", ".ts", ".html", ".css", ".sh"}
+        max_fixup_size = 256 * 1024
+        created_at = datetime.now().isoformat()
+
+        def fixup() -> int:
+            rewritten = 0
+            for file_path in project_path.rglob("*"):
+                try:
+                    if not file_path.is_file() or file_path.suffix.lower() not in text_suffixes:
+                        continue
+                    if file_path.stat().st_size > max_fixup_size:
+                        continue
+                    content = file_path.read_text(encoding="utf-8")
+                    if "{{project_name}}" not in content and "{{created_at}}" not in content:
+                        continue
+                    content = content.replace("{{project_name}}", project_name)
+                    content = content.replace("{{created_at}}", created_at)
+                    tmp_path = file_path.with_suffix(file_path.suffix + ".tmp")
+                    tmp_path.write_text(content, encoding="utf-8")
+                    tmp_path.replace(file_path)
+                    rewritten += 1
+                except (UnicodeDecodeError, OSError):
+                    continue
+            return rewritten
+
+        try:
+            loop = asyncio.get_event_loop()
+            rewritten = await loop.run_in_executor(None, fixup)
+            logger.info("✨ [PROJECT_MANAGER] Template fixup complete",
+                       project_name=project_name, method=method, files_rewritten=rewritten)
+        except Exception as e:
+            logger.warning("⚠️ [PROJECT_MANAGER] Template fixup failed",
+                         project_name=project_name, error=str(e))
+
     def _sanitize_project_name(self, name: str) -> str:
         """Sanitize project name for filesystem usage"""
         import re
@@ -14,17 +14,56 @@ import asyncio
 import json
 import os
 import subprocess
+import sys
+import time
 import urllib.parse
 from datetime import datetime
 from pathlib import Path
+from string import Template
 from typing import Dict, Any, Optional, List, Union
 import structlog
 
+from scripting import scripting_session
+from fileindex import project_file_index
+
 # Check if debug mode is enabled
 DEBUG_MODE = os.getenv('DEPLOYBOT_DEBUG', '0') == '1'
 
 logger = structlog.get_logger()
 
+# Note templates compiled once at import time - generating a note at redirect
+# time is a single substitution instead of rebuilding the text line by line
+BEAR_NOTE_TEMPLATE = Template(
+    "# $title\n"
+    "\n"
+    "**Created:** $created\n"
+    "**Source:** DeployBot (during deployment)\n"
+    "\n"
+    "$meta"
+    "\n"
+    "## Notes\n"
+    "\n"
+    "Start working on this task...\n"
+    "\n"
+    "## Progress\n"
+    "\n"
+    "- [ ] Task started\n"
+    "- [ ] In progress\n"
+    "- [ ] Completed"
+)
+
+BEAR_SIMPLIFIED_TEMPLATE = Template(
+    "# $title\n"
+    "\n"
+    "Created by DeployBot on $created\n"
+    "\n"
+    "$meta"
+    "\n"
+    "## Notes\n"
+    "\n"
+    "Start working on this task..."
+)
+
 class AppRedirector:
     """Enhanced application redirection system for DeployBot"""
     
@@ -120,7 +159,24 @@ class AppRedirector:
             "terminal": "Terminal",
             "notes": "Notes"
         }
-        
+
+        # Cached capability map so redirect decisions are in-memory lookups
+        # instead of a subprocess probe per app per call
+        self._availability_cache = {}
+        self._availability_checked_at = 0.0
+        self.availability_cache_ttl = 300.0  # Re-probe at most every 5 minutes
+        self._applications_mtime = None  # /Applications mtime at last probe
+        self._method_cache = {}  # app_name -> redirect method that last worked
+
+        # Project-tree scan results precomputed at suggestion time so the
+        # redirect click itself never walks the filesystem
+        self._file_suggestion_cache = {}  # (task_text, project_path) -> file lists
+
+        # Complete redirect plans prebuilt at suggestion time: strategy,
+        # deep-link URL, note content and CLI command are all computable the
+        # moment a task is suggested, so the "switch" click just executes
+        self._redirect_plans = {}  # (task_text, project_path) -> plan dict
+
         logger.info("🔀 [REDIRECT] AppRedirector initialized", 
                    supported_apps=len(self.app_configs),
                    debug_mode=DEBUG_MODE)
@@ -144,26 +200,52 @@ class AppRedirector:
             app_name = task.get('app', 'Notion')
             task_text = task.get('text', '')
             tags = task.get('tags', [])
-            
-            # Prepare task context for redirection
-            task_context = self._prepare_task_context(task, context or {})
-            
+
+            # Prebuilt plan from suggestion time: task context, deep-link
+            # URL and CLI command are already computed, so the click path
+            # does no string building or tree scanning at all
+            plan = self._redirect_plans.get(self._file_cache_key(task, context or {}))
+            if plan is not None:
+                task_context = plan['task_context']
+                logger.debug("📦 [REDIRECT] Executing prebuilt redirect plan",
+                            app=app_name, built_at=plan.get('built_at'))
+            else:
+                # Prepare task context for redirection
+                task_context = self._prepare_task_context(task, context or {})
+
             # Check if app supports enhanced redirection
             if app_name in self.app_configs:
-                result = await self._redirect_with_context(app_name, task, task_context)
+                result = await self._redirect_with_context(app_name, task, task_context, plan=plan)
             else:
                 # Fallback to simple app opening
                 result = await self._simple_app_redirect(app_name, task_text)
             
             # Log the redirection result
             if result.get('success'):
-                logger.info("✅ [REDIRECT] Task redirection successful", 
-                           app=app_name, 
+                # Remember what worked so the next redirect skips discovery
+                self._method_cache[app_name] = result.get('method')
+
+                # ⏱️ Dispatch succeeded, but the app may not have focus yet -
+                # register a probe so the focus stream measures the real
+                # switch latency for this app/strategy pair
+                try:
+                    from analytics import analytics_manager
+                    await analytics_manager.track_redirect_dispatch(
+                        app_name, result.get('method', 'unknown'))
+                except Exception as e:
+                    logger.debug("⏱️ [REDIRECT] Focus probe registration failed",
+                                error=str(e))
+
+                logger.info("✅ [REDIRECT] Task redirection successful",
+                           app=app_name,
                            method=result.get('method', 'unknown'),
                            task=task_text)
             else:
-                logger.error("❌ [REDIRECT] Task redirection failed", 
-                           app=app_name, 
+                # Forget stale capabilities and force a fresh probe next time
+                self._method_cache.pop(app_name, None)
+                self._availability_checked_at = 0.0
+                logger.error("❌ [REDIRECT] Task redirection failed",
+                           app=app_name,
                            error=result.get('error', 'Unknown error'),
                            task=task_text)
             
@@ -211,23 +293,60 @@ class AppRedirector:
         
         return task_context
 
-    async def _redirect_with_context(self, app_name: str, task: Dict[str, Any], context: Dict[str, Any]) -> Dict[str, Any]:
+    async def _redirect_with_context(self, app_name: str, task: Dict[str, Any], context: Dict[str, Any],
+                                     plan: Optional[Dict[str, Any]] = None) -> Dict[str, Any]:
         """Enhanced redirection with app-specific context and deep linking"""
-        
+
         app_config = self.app_configs[app_name]
-        logger.debug("🔀 [REDIRECT] Using enhanced redirection", 
-                    app=app_name, 
-                    supports_deep_linking=app_config.get('supports_deep_linking', False))
-        
+        logger.debug("🔀 [REDIRECT] Using enhanced redirection",
+                    app=app_name,
+                    supports_deep_linking=app_config.get('supports_deep_linking', False),
+                    prebuilt_plan=plan is not None)
+
+        # URL and command prebuilt at suggestion time, when available
+        prebuilt_link = (plan.get('url'), plan.get('action')) if plan else None
+        prebuilt_command = plan.get('command') if plan else None
+
+        # If a previous redirect found the working method for this app, go
+        # straight to it instead of re-walking the capability cascade. When
+        # enough dispatch-to-focus probes have resolved, the strategy with
+        # the lowest measured latency on this machine wins over the cache.
+        try:
+            from analytics import analytics_manager
+            measured_method = analytics_manager.get_fastest_redirect_method(app_name)
+        except Exception:
+            measured_method = None
+
+        remembered_method = measured_method or self._method_cache.get(app_name)
+        if remembered_method == "deep_linking" and app_config.get('supports_deep_linking', False):
+            deep_link_result = await self._try_deep_linking(app_name, task, context, app_config,
+                                                            prebuilt=prebuilt_link)
+            if deep_link_result.get('success'):
+                return deep_link_result
+            self._method_cache.pop(app_name, None)
+        elif remembered_method == "command_line" and app_config.get('command_line'):
+            cli_result = await self._try_command_line(app_name, task, context, app_config,
+                                                      prebuilt_command=prebuilt_command)
+            if cli_result.get('success'):
+                return cli_result
+            self._method_cache.pop(app_name, None)
+        elif remembered_method == "simple_open":
+            simple_result = await self._simple_app_redirect(app_name, task.get('text', ''))
+            if simple_result.get('success'):
+                return simple_result
+            self._method_cache.pop(app_name, None)
+
         # Try deep linking first if supported
         if app_config.get('supports_deep_linking', False):
-            deep_link_result = await self._try_deep_linking(app_name, task, context, app_config)
+            deep_link_result = await self._try_deep_linking(app_name, task, context, app_config,
+                                                            prebuilt=prebuilt_link)
             if deep_link_result.get('success'):
                 return deep_link_result
-        
+
         # Try command line integration
         if app_config.get('command_line'):
-            cli_result = await self._try_command_line(app_name, task, context, app_config)
+            cli_result = await self._try_command_line(app_name, task, context, app_config,
+                                                      prebuilt_command=prebuilt_command)
             if cli_result.get('success'):
                 return cli_result
         
@@ -235,78 +354,97 @@ class AppRedirector:
         logger.debug("🔀 [REDIRECT] Falling back to simple app opening", app=app_name)
         return await self._simple_app_redirect(app_name, task.get('text', ''))
 
-    async def _try_deep_linking(self, app_name: str, task: Dict[str, Any], context: Dict[str, Any], 
-                               app_config: Dict[str, Any]) -> Dict[str, Any]:
-        """Attempt to use deep linking for enhanced app integration"""
-        
-        try:
-            task_actions = app_config.get('task_actions', {})
-            task_text = task.get('text', '')
-            tags = task.get('tags', [])
-            
-            # Determine the best action based on task type
-            action_url = None
-            action_type = None
-            
-            if app_name == "Bear":
-                # Create a new note in Bear (works for any Bear task, not just writing)
-                # Create a new note in Bear with task context
-                note_content = self._generate_bear_note_content(task, context)
-                logger.debug("🐻 [REDIRECT] Generated Bear note content", 
-                           content_length=len(note_content), 
-                           content_preview=note_content[:100])
-                
-                # Try full content first
+    def _build_deep_link(self, app_name: str, task: Dict[str, Any], context: Dict[str, Any],
+                         app_config: Dict[str, Any]) -> tuple:
+        """
+        Construct the deep-link URL and action type for an app/task pair.
+
+        Pure string work - no subprocess, no I/O - so it can run at
+        suggestion time to prebuild the redirect plan.
+        """
+        task_actions = app_config.get('task_actions', {})
+        task_text = task.get('text', '')
+        tags = task.get('tags', [])
+
+        action_url = None
+        action_type = None
+
+        if app_name == "Bear":
+            # Create a new note in Bear (works for any Bear task, not just writing)
+            # Create a new note in Bear with task context
+            note_content = self._generate_bear_note_content(task, context)
+            logger.debug("🐻 [REDIRECT] Generated Bear note content",
+                       content_length=len(note_content),
+                       content_preview=note_content[:100])
+
+            # Try full content first
+            action_url = task_actions['create_note'].format(
+                title=urllib.parse.quote(task_text),
+                content=urllib.parse.quote(note_content)
+            )
+
+            # If URL is too long, use simplified content
+            if len(action_url) > 2000:
+                logger.warning("🐻 [REDIRECT] URL too long, using simplified content",
+                             original_length=len(action_url))
+                simplified_content = self._generate_simplified_bear_content(task, context)
                 action_url = task_actions['create_note'].format(
                     title=urllib.parse.quote(task_text),
-                    content=urllib.parse.quote(note_content)
+                    content=urllib.parse.quote(simplified_content)
                 )
-                
-                # If URL is too long, use simplified content
-                if len(action_url) > 2000:
-                    logger.warning("🐻 [REDIRECT] URL too long, using simplified content", 
-                                 original_length=len(action_url))
-                    simplified_content = self._generate_simplified_bear_content(task, context)
-                    action_url = task_actions['create_note'].format(
-                        title=urllib.parse.quote(task_text),
-                        content=urllib.parse.quote(simplified_content)
-                    )
-                    logger.debug("🐻 [REDIRECT] Simplified Bear URL created", 
-                               url_length=len(action_url))
-                
-                action_type = "create_note"
-                
-                logger.debug("🐻 [REDIRECT] Final Bear URL created", 
-                           url_length=len(action_url),
-                           url_preview=action_url[:150])
-                
-            elif app_name == "VSCode" and context.get('project_path'):
-                # Open VSCode with project context
-                project_path = context['project_path']
-                action_url = f"code {project_path}"
-                action_type = "open_project"
-                
-            elif app_name == "Safari" and '#research' in tags:
-                # Open Safari with relevant search
-                search_query = self._extract_search_query(task_text)
-                action_url = task_actions['search'].format(query=urllib.parse.quote(search_query))
-                action_type = "search"
-                
-            elif app_name == "Things":
-                # Add task to Things with proper formatting
-                tags_str = ','.join([tag.replace('#', '') for tag in tags])
-                action_url = task_actions['add_todo'].format(
-                    title=urllib.parse.quote(task_text),
-                    notes=urllib.parse.quote(f"Created by DeployBot during deploy"),
-                    tags=urllib.parse.quote(tags_str)
-                )
-                action_type = "add_todo"
-                
-            elif app_name == "Notion":
-                # Open Notion workspace
-                action_url = task_actions['open_workspace']
-                action_type = "open_workspace"
-            
+                logger.debug("🐻 [REDIRECT] Simplified Bear URL created",
+                           url_length=len(action_url))
+
+            action_type = "create_note"
+
+            logger.debug("🐻 [REDIRECT] Final Bear URL created",
+                       url_length=len(action_url),
+                       url_preview=action_url[:150])
+
+        elif app_name == "VSCode" and context.get('project_path'):
+            # Open VSCode with project context
+            project_path = context['project_path']
+            action_url = f"code {project_path}"
+            action_type = "open_project"
+
+        elif app_name == "Safari" and '#research' in tags:
+            # Open Safari with relevant search
+            search_query = self._extract_search_query(task_text)
+            action_url = task_actions['search'].format(query=urllib.parse.quote(search_query))
+            action_type = "search"
+
+        elif app_name == "Things":
+            # Add task to Things with proper formatting
+            tags_str = ','.join([tag.replace('#', '') for tag in tags])
+            action_url = task_actions['add_todo'].format(
+                title=urllib.parse.quote(task_text),
+                notes=urllib.parse.quote(f"Created by DeployBot during deploy"),
+                tags=urllib.parse.quote(tags_str)
+            )
+            action_type = "add_todo"
+
+        elif app_name == "Notion":
+            # Open Notion workspace
+            action_url = task_actions['open_workspace']
+            action_type = "open_workspace"
+
+        return action_url, action_type
+
+    async def _try_deep_linking(self, app_name: str, task: Dict[str, Any], context: Dict[str, Any],
+                               app_config: Dict[str, Any],
+                               prebuilt: Optional[tuple] = None) -> Dict[str, Any]:
+        """Attempt to use deep linking for enhanced app integration"""
+
+        try:
+            tags = task.get('tags', [])
+            task_text = task.get('text', '')
+
+            # A prebuilt plan already carries the URL; otherwise build it now
+            if prebuilt and prebuilt[0]:
+                action_url, action_type = prebuilt
+            else:
+                action_url, action_type = self._build_deep_link(app_name, task, context, app_config)
+
             if action_url:
                 logger.info("🔗 [REDIRECT] Attempting deep link", 
                            app=app_name, action=action_type, url_length=len(action_url))
@@ -347,29 +485,41 @@ class AppRedirector:
         
         return {"success": False, "method": "deep_linking"}
 
-    async def _try_command_line(self, app_name: str, task: Dict[str, Any], context: Dict[str, Any], 
-                               app_config: Dict[str, Any]) -> Dict[str, Any]:
+    def _build_cli_command(self, app_name: str, task: Dict[str, Any], context: Dict[str, Any],
+                           app_config: Dict[str, Any]) -> Optional[str]:
+        """Build the command-line invocation for an app/task pair (plan time)"""
+
+        command_line = app_config.get('command_line')
+        if not command_line:
+            return None
+
+        # Build command based on app and context
+        if app_name == "VSCode" and context.get('project_path'):
+            command = f"{command_line} {context['project_path']}"
+
+            # If it's a code task, try to open specific files
+            if '#code' in task.get('tags', []):
+                # Look for relevant files in project
+                relevant_files = self._find_relevant_files(task, context)
+                if relevant_files:
+                    command += f" {relevant_files[0]}"
+
+            return command
+
+        return None
+
+    async def _try_command_line(self, app_name: str, task: Dict[str, Any], context: Dict[str, Any],
+                               app_config: Dict[str, Any],
+                               prebuilt_command: Optional[str] = None) -> Dict[str, Any]:
         """Try command line integration for supported apps"""
-        
+
         try:
-            command_line = app_config.get('command_line')
-            if not command_line:
-                return {"success": False, "method": "command_line"}
-            
-            # Build command based on app and context
-            if app_name == "VSCode" and context.get('project_path'):
-                command = f"{command_line} {context['project_path']}"
-                
-                # If it's a code task, try to open specific files
-                if '#code' in task.get('tags', []):
-                    # Look for relevant files in project
-                    relevant_files = self._find_relevant_files(task, context)
-                    if relevant_files:
-                        command += f" {relevant_files[0]}"
-                
+            command = prebuilt_command or self._build_cli_command(app_name, task, context, app_config)
+
+            if command:
                 logger.debug("🖥️ [REDIRECT] Executing command", command=command)
                 result = await self._execute_command(command)
-                
+
                 if result:
                     return {
                         "success": True,
@@ -377,11 +527,11 @@ class AppRedirector:
                         "command": command,
                         "app": app_name
                     }
-                    
+
         except Exception as e:
-            logger.warning("⚠️ [REDIRECT] Command line execution failed", 
+            logger.warning("⚠️ [REDIRECT] Command line execution failed",
                           app=app_name, error=str(e))
-        
+
         return {"success": False, "method": "command_line"}
 
     async def _simple_app_redirect(self, app_name: str, task_text: str) -> Dict[str, Any]:
@@ -419,13 +569,34 @@ class AppRedirector:
                 "app": app_name
             }
 
+    async def activate_application(self, app_name: str) -> bool:
+        """
+        Bring an already-running application to the front without going
+        through `open`'s LaunchServices round trip. Executes over the
+        persistent helper, so the cost is a pipe write plus osascript.
+        """
+        try:
+            safe_name = app_name.replace('"', '\\"')
+            command = ['osascript', '-e', f'tell application "{safe_name}" to activate']
+            result = await self._execute_subprocess(command, timeout=5)
+            return result.returncode == 0
+        except Exception as e:
+            logger.debug("🔄 [REDIRECT] Activation failed",
+                        app=app_name, error=str(e))
+            return False
+
     async def _execute_subprocess(self, command: List[str], timeout: int = 10) -> subprocess.CompletedProcess:
         """Execute subprocess command with timeout and enhanced debugging"""
-        
+
         if DEBUG_MODE:
-            logger.debug("🖥️ [REDIRECT] Executing subprocess command", 
+            logger.debug("🖥️ [REDIRECT] Executing subprocess command",
                        command=command, timeout=timeout, cwd=os.getcwd())
-        
+
+        # Route open/osascript through the shared scripting session so the
+        # redirect path doesn't pay a fresh spawn from this (large) process
+        if command and command[0] in ("open", "osascript"):
+            return await scripting_session.run(command, timeout)
+
         loop = asyncio.get_event_loop()
         try:
             result = await loop.run_in_executor(
@@ -513,64 +684,35 @@ class AppRedirector:
 
     def _generate_bear_note_content(self, task: Dict[str, Any], context: Dict[str, Any]) -> str:
         """Generate formatted content for Bear note"""
-        
-        content_lines = [
-            f"# {task.get('text', 'Task from DeployBot')}",
-            "",
-            f"**Created:** {datetime.now().strftime('%Y-%m-%d %H:%M')}",
-            f"**Source:** DeployBot (during deployment)",
-            ""
-        ]
-        
+
+        meta_lines = []
         if context.get('project_name'):
-            content_lines.append(f"**Project:** {context['project_name']}")
-        
+            meta_lines.append(f"**Project:** {context['project_name']}")
         if context.get('deploy_command'):
-            content_lines.append(f"**Deploy Command:** `{context['deploy_command']}`")
-        
+            meta_lines.append(f"**Deploy Command:** `{context['deploy_command']}`")
         if task.get('tags'):
-            tags_str = ' '.join(task['tags'])
-            content_lines.append(f"**Tags:** {tags_str}")
-        
-        content_lines.extend([
-            "",
-            "## Notes",
-            "",
-            "Start working on this task...",
-            "",
-            "## Progress",
-            "",
-            "- [ ] Task started",
-            "- [ ] In progress",
-            "- [ ] Completed"
-        ])
-        
-        return '\n'.join(content_lines)
+            meta_lines.append(f"**Tags:** {' '.join(task['tags'])}")
+
+        return BEAR_NOTE_TEMPLATE.substitute(
+            title=task.get('text', 'Task from DeployBot'),
+            created=datetime.now().strftime('%Y-%m-%d %H:%M'),
+            meta='\n'.join(meta_lines) + '\n' if meta_lines else ''
+        )
 
     def _generate_simplified_bear_content(self, task: Dict[str, Any], context: Dict[str, Any]) -> str:
         """Generate simplified Bear note content for URL scheme limits"""
-        
-        content_lines = [
-            f"# {task.get('text', 'Task from DeployBot')}",
-            "",
-            f"Created by DeployBot on {datetime.now().strftime('%Y-%m-%d %H:%M')}",
-            ""
-        ]
-        
+
+        meta_lines = []
         if context.get('project_name'):
-            content_lines.append(f"Project: {context['project_name']}")
-        
+            meta_lines.append(f"Project: {context['project_name']}")
         if task.get('tags'):
-            content_lines.append(f"Tags: {' '.join(task['tags'])}")
-        
-        content_lines.extend([
-            "",
-            "## Notes",
-            "",
-            "Start working on this task..."
-        ])
-        
-        return '\n'.join(content_lines)
+            meta_lines.append(f"Tags: {' '.join(task['tags'])}")
+
+        return BEAR_SIMPLIFIED_TEMPLATE.substitute(
+            title=task.get('text', 'Task from DeployBot'),
+            created=datetime.now().strftime('%Y-%m-%d %H:%M'),
+            meta='\n'.join(meta_lines) + '\n' if meta_lines else ''
+        )
 
     def _generate_writing_starter(self, task: Dict[str, Any]) -> str:
         """Generate writing starter content based on task"""
@@ -587,35 +729,154 @@ class AppRedirector:
         else:
             return f"# {task_text}\n\n## Outline\n\n- \n- \n- \n\n## Content\n\n"
 
+    def _file_cache_key(self, task: Dict[str, Any], context: Dict[str, Any]) -> tuple:
+        """Cache key for precomputed file suggestions"""
+        return (task.get('text', ''), context.get('project_path', ''))
+
+    async def prime_task_context(self, task: Dict[str, Any], context: Optional[Dict[str, Any]] = None):
+        """
+        Precompute the project-tree scans for a task ahead of redirect time
+
+        Called fire-and-forget at suggestion time so that if the user clicks
+        "Switch to task", _prepare_task_context serves the file lists from
+        memory instead of walking the tree synchronously.
+        """
+        context = context or {}
+        key = self._file_cache_key(task, context)
+        if key in self._file_suggestion_cache:
+            return
+
+        try:
+            loop = asyncio.get_event_loop()
+            code_files = await loop.run_in_executor(None, self._scan_code_files, task, context)
+            relevant_files = await loop.run_in_executor(None, self._scan_relevant_files, task, context)
+
+            # Bound the cache - suggestions are short-lived
+            if len(self._file_suggestion_cache) > 64:
+                self._file_suggestion_cache.clear()
+
+            self._file_suggestion_cache[key] = {
+                "code": code_files,
+                "relevant": relevant_files
+            }
+            logger.debug("📂 [REDIRECT] Task context primed",
+                        task=task.get('text', '')[:50],
+                        code_files=len(code_files),
+                        relevant_files=len(relevant_files))
+        except Exception as e:
+            logger.warning("⚠️ [REDIRECT] Failed to prime task context", error=str(e))
+
+    async def prepare_redirect_plan(self, task: Dict[str, Any],
+                                    context: Optional[Dict[str, Any]] = None) -> Optional[Dict[str, Any]]:
+        """
+        Build the complete redirect plan for a suggestion ahead of time.
+
+        Primes the file-suggestion cache first (tree scans off the loop),
+        then does all the string work - task context, deep-link URL, note
+        content, CLI command - so a later "Switch to task" click executes
+        the plan with zero computation in the interaction path. Returns a
+        compact summary suitable for attaching to the notification payload.
+        """
+        context = context or {}
+        try:
+            await self.prime_task_context(task, context)
+
+            app_name = task.get('app', 'Notion')
+            task_context = self._prepare_task_context(task, context)
+
+            plan = {
+                "app": app_name,
+                "task_context": task_context,
+                "url": None,
+                "action": None,
+                "command": None,
+                "built_at": datetime.now().isoformat()
+            }
+
+            app_config = self.app_configs.get(app_name)
+            if app_config:
+                if app_config.get('supports_deep_linking', False):
+                    plan["url"], plan["action"] = self._build_deep_link(
+                        app_name, task, task_context, app_config)
+                if app_config.get('command_line'):
+                    plan["command"] = self._build_cli_command(
+                        app_name, task, task_context, app_config)
+
+            # Bound the plan cache - plans are as short-lived as suggestions
+            if len(self._redirect_plans) > 64:
+                self._redirect_plans.clear()
+            self._redirect_plans[self._file_cache_key(task, context)] = plan
+
+            logger.debug("📦 [REDIRECT] Redirect plan prebuilt",
+                        app=app_name,
+                        has_url=plan["url"] is not None,
+                        has_command=plan["command"] is not None)
+
+            # Payload summary: everything except the bulky task context
+            return {
+                "app": app_name,
+                "action": plan["action"],
+                "url": plan["url"],
+                "command": plan["command"],
+                "built_at": plan["built_at"]
+            }
+        except Exception as e:
+            logger.warning("⚠️ [REDIRECT] Failed to prebuild redirect plan", error=str(e))
+            return None
+
     def _suggest_code_files(self, task: Dict[str, Any], context: Dict[str, Any]) -> List[str]:
-        """Suggest relevant code files based on task and project context"""
-        
+        """Suggest relevant code files (precomputed at suggestion time when possible)"""
+
+        cached = self._file_suggestion_cache.get(self._file_cache_key(task, context))
+        if cached is not None:
+            return cached["code"]
+        return self._scan_code_files(task, context)
+
+    def _scan_code_files(self, task: Dict[str, Any], context: Dict[str, Any]) -> List[str]:
+        """Find code files matching the task (index query, walk fallback)"""
+
         suggestions = []
         project_path = context.get('project_path', '')
-        
+
         if project_path:
             project_dir = Path(project_path)
             task_lower = task.get('text', '').lower()
-            
+
             # Common file patterns based on task content
-            patterns = []
+            extensions = []
+            name_terms = []
             if 'component' in task_lower or 'ui' in task_lower:
-                patterns.extend(['*.jsx', '*.tsx', '*.vue', '*.svelte'])
+                extensions.extend(['.jsx', '.tsx', '.vue', '.svelte'])
             elif 'api' in task_lower or 'backend' in task_lower:
-                patterns.extend(['*.py', '*.js', '*.ts', '*.go', '*.rs'])
+                extensions.extend(['.py', '.js', '.ts', '.go', '.rs'])
             elif 'style' in task_lower or 'css' in task_lower:
-                patterns.extend(['*.css', '*.scss', '*.sass', '*.less'])
+                extensions.extend(['.css', '.scss', '.sass', '.less'])
             elif 'test' in task_lower:
-                patterns.extend(['*test*', '*spec*'])
-            
-            # Find matching files
+                name_terms.extend(['test', 'spec'])
+
+            # Preferred path: the background index answers without touching
+            # the tree. A miss kicks off a build for next time.
+            indexed = project_file_index.lookup_by_extensions(project_path, extensions) \
+                if extensions else None
+            if indexed is None and name_terms:
+                hits = [project_file_index.lookup_by_name(project_path, term, limit=3)
+                        for term in name_terms]
+                if all(h is not None for h in hits):
+                    indexed = [path for hit in hits for path in hit]
+            if indexed is not None:
+                return indexed
+            project_file_index.request_index(project_path)
+
+            # Fallback: walk the tree the old way until the index is ready
+            patterns = [f"*{ext}" for ext in extensions] + \
+                       [f"*{term}*" for term in name_terms]
             for pattern in patterns:
                 try:
                     matches = list(project_dir.glob(f"**/{pattern}"))
                     suggestions.extend([str(f) for f in matches[:3]])  # Limit to 3 files
                 except:
                     pass
-        
+
         return suggestions
 
     def _generate_search_queries(self, task: Dict[str, Any]) -> List[str]:
@@ -683,51 +944,94 @@ class AppRedirector:
         return clean_text.strip()
 
     def _find_relevant_files(self, task: Dict[str, Any], context: Dict[str, Any]) -> List[str]:
-        """Find relevant files in project for code tasks"""
-        
+        """Find relevant files (precomputed at suggestion time when possible)"""
+
+        cached = self._file_suggestion_cache.get(self._file_cache_key(task, context))
+        if cached is not None:
+            return cached["relevant"]
+        return self._scan_relevant_files(task, context)
+
+    def _scan_relevant_files(self, task: Dict[str, Any], context: Dict[str, Any]) -> List[str]:
+        """Find files related to the task (index query, walk fallback)"""
+
         project_path = context.get('project_path', '')
         if not project_path:
             return []
-        
+
         # This is a simplified version - in practice, you'd use more sophisticated matching
         relevant_files = []
         task_lower = task.get('text', '').lower()
-        
+
         try:
             project_dir = Path(project_path)
-            
+
             # Look for files mentioned in task or related patterns
             if 'readme' in task_lower:
-                readme_files = list(project_dir.glob('**/README*'))
-                relevant_files.extend([str(f) for f in readme_files])
-            
+                indexed = project_file_index.lookup_by_name(project_path, 'readme')
+                if indexed is None:
+                    project_file_index.request_index(project_path)
+                    indexed = [str(f) for f in project_dir.glob('**/README*')]
+                relevant_files.extend(indexed)
+
             if 'package' in task_lower:
-                package_files = list(project_dir.glob('**/package.json'))
-                relevant_files.extend([str(f) for f in package_files])
-                
+                indexed = project_file_index.lookup_by_name(project_path, 'package.json')
+                if indexed is None:
+                    project_file_index.request_index(project_path)
+                    indexed = [str(f) for f in project_dir.glob('**/package.json')]
+                relevant_files.extend(indexed)
+
         except Exception as e:
             logger.debug("🔍 [REDIRECT] Error finding relevant files", error=str(e))
-        
+
         return relevant_files[:5]  # Limit to 5 files
 
-    async def get_app_availability(self) -> Dict[str, bool]:
-        """Check which configured apps are available on the system"""
-        
-        availability = {}
-        
-        for app_name, config in self.app_configs.items():
+    def _applications_dir_mtime(self) -> Optional[float]:
+        """Current mtime of /Applications (None when it doesn't exist)"""
+        try:
+            return Path('/Applications').stat().st_mtime
+        except OSError:
+            return None
+
+    def _availability_cache_fresh(self) -> bool:
+        """Whether the cached capability map can be served without re-probing"""
+        if not self._availability_cache:
+            return False
+        if time.monotonic() - self._availability_checked_at > self.availability_cache_ttl:
+            return False
+        # An install/uninstall touches /Applications, invalidating the cache
+        return self._applications_dir_mtime() == self._applications_mtime
+
+    async def get_app_availability(self, force_refresh: bool = False) -> Dict[str, bool]:
+        """Check which configured apps are available on the system (cached)"""
+
+        if not force_refresh and self._availability_cache_fresh():
+            logger.debug("📱 [REDIRECT] Serving app availability from cache",
+                        app_count=len(self._availability_cache))
+            return dict(self._availability_cache)
+
+        async def probe(app_name: str) -> bool:
             try:
                 # Try to check if app is installed
                 command = ['open', '-a', app_name]
                 result = await self._execute_subprocess(command + ['--args', '--version'], timeout=5)
-                availability[app_name] = result.returncode == 0
+                return result.returncode == 0
             except:
-                availability[app_name] = False
-        
-        logger.info("📱 [REDIRECT] App availability check completed", 
+                return False
+
+        # Probe all apps concurrently - a refresh costs one round of
+        # subprocesses instead of a serial walk
+        app_names = list(self.app_configs.keys())
+        results = await asyncio.gather(*(probe(app_name) for app_name in app_names))
+        availability = dict(zip(app_names, results))
+
+        self._availability_cache = availability
+        self._availability_checked_at = time.monotonic()
+        self._applications_mtime = self._applications_dir_mtime()
+
+        logger.info("📱 [REDIRECT] App availability check completed",
                    available_apps=[app for app, available in availability.items() if available])
-        
-        return availability
+
+        return dict(availability)
 
     async def test_redirection(self, app_name: str, task_text: str = "Test task") -> Dict[str, Any]:
         """Test redirection for a specific app (useful for debugging)"""
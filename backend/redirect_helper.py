@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Redirect Helper for DeployBot
+
+A tiny long-lived co-process that executes open/osascript commands on
+behalf of the backend. Spawning children from this small process is much
+cheaper than forking from the full Python backend, so the "Switch to
+task" interaction doesn't pay the fork/spawn cost of a large process on
+every redirect.
+
+Protocol: JSON lines on stdin/stdout.
+  request:  {"id": <int>, "command": [<argv>...], "timeout": <seconds>}
+        or  {"id": <int>, "op": "notify", "title": <str>, "message": <str>,
+             "subtitle": <str>}
+  response: {"id": <int>, "returncode": <int>, "stdout": <str>, "stderr": <str>}
+            or {"id": <int>, "error": <str>}
+
+The "notify" op posts a macOS notification through a single persistent
+`osascript -i` session held open by the helper: one pipe write per
+notification instead of an osascript spawn per notification. The session
+starts on first use and is re-spawned if it dies.
+
+The helper exits when stdin closes (backend shutdown or crash).
+"""
+
+import json
+import subprocess
+import sys
+
+# Persistent interactive osascript session for the notify op
+_notify_session = None
+
+
+def _escape_applescript(text):
+    """Escape a string for embedding in a double-quoted AppleScript literal"""
+    return (text.replace("\\", "\\\\").replace('"', '\\"')
+                .replace("\n", " ").replace("\r", " "))
+
+
+def _get_notify_session():
+    """Return the live osascript -i session, (re)spawning it if needed"""
+    global _notify_session
+    if _notify_session is not None and _notify_session.poll() is None:
+        return _notify_session
+
+    _notify_session = subprocess.Popen(
+        ["osascript", "-i"],
+        stdin=subprocess.PIPE,
+        stdout=subprocess.DEVNULL,
+        stderr=subprocess.DEVNULL,
+        text=True
+    )
+    return _notify_session
+
+
+def _post_notification(request):
+    """Post one notification over the persistent session (retry once on a dead pipe)"""
+    title = _escape_applescript(request.get("title", "DeployBot"))
+    message = _escape_applescript(request.get("message", ""))
+    subtitle = _escape_applescript(request.get("subtitle", "DeployBot"))
+    line = (f'display notification "{message}" '
+            f'with title "{title}" subtitle "{subtitle}"\n')
+
+    global _notify_session
+    for attempt in (1, 2):
+        session = _get_notify_session()
+        try:
+            session.stdin.write(line)
+            session.stdin.flush()
+            return {"returncode": 0, "stdout": "", "stderr": ""}
+        except (BrokenPipeError, OSError):
+            _notify_session = None
+            if attempt == 2:
+                raise
+    return {"returncode": 1, "stdout": "", "stderr": "notify session unavailable"}
+
+
+def main():
+    for line in sys.stdin:
+        line = line.strip()
+        if not line:
+            continue
+
+        try:
+            request = json.loads(line)
+        except json.JSONDecodeError:
+            continue
+
+        request_id = request.get("id")
+        response = {"id": request_id}
+
+        if request.get("op") == "notify":
+            try:
+                response.update(_post_notification(request))
+            except Exception as e:
+                response["error"] = str(e)
+            sys.stdout.write(json.dumps(response) + "\n")
+            sys.stdout.flush()
+            continue
+
+        try:
+            result = subprocess.run(
+                request["command"],
+                capture_output=True,
+                text=True,
+                timeout=request.get("timeout", 10)
+            )
+            response["returncode"] = result.returncode
+            response["stdout"] = result.stdout
+            response["stderr"] = result.stderr
+        except subprocess.TimeoutExpired:
+            response["error"] = "timeout"
+        except Exception as e:
+            response["error"] = str(e)
+
+        sys.stdout.write(json.dumps(response) + "\n")
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""
+Shared Scripting Session for DeployBot
+
+One persistent helper co-process (redirect_helper.py) executes every
+open/osascript command the backend issues - redirects, system
+notification fallbacks, and any future AppleScript path. Callers pay a
+pipe write per operation instead of a fresh process spawn from the large
+backend interpreter.
+
+The session is lazy: the helper starts on first use, is re-spawned if it
+wedges, and exits on its own when the backend's stdin pipe closes.
+"""
+
+import asyncio
+import json
+import subprocess
+import sys
+from pathlib import Path
+from typing import List
+
+import structlog
+
+logger = structlog.get_logger()
+
+
+class ScriptingSession:
+    """Persistent executor for open/osascript commands over a pipe protocol"""
+
+    def __init__(self):
+        self._helper_proc = None
+        self._helper_lock = None  # Created lazily on the running loop
+        self._helper_request_id = 0
+
+    async def _ensure_helper(self):
+        """Spawn (or re-spawn) the persistent helper process"""
+        if self._helper_proc and self._helper_proc.returncode is None:
+            return self._helper_proc
+
+        helper_script = Path(__file__).parent / "redirect_helper.py"
+        self._helper_proc = await asyncio.create_subprocess_exec(
+            sys.executable, str(helper_script),
+            stdin=asyncio.subprocess.PIPE,
+            stdout=asyncio.subprocess.PIPE,
+            stderr=asyncio.subprocess.DEVNULL
+        )
+        logger.info("🧰 [SCRIPTING] Scripting helper process started",
+                   pid=self._helper_proc.pid)
+        return self._helper_proc
+
+    async def _roundtrip_via_helper(self, request: dict, timeout: int) -> dict:
+        """One request/response exchange over the helper's pipe"""
+        if self._helper_lock is None:
+            self._helper_lock = asyncio.Lock()
+
+        async with self._helper_lock:
+            helper = await self._ensure_helper()
+
+            self._helper_request_id += 1
+            request = {"id": self._helper_request_id, **request}
+            helper.stdin.write((json.dumps(request) + "\n").encode('utf-8'))
+            await helper.stdin.drain()
+
+            # The helper enforces the command timeout itself; the small grace
+            # covers pipe latency
+            line = await asyncio.wait_for(helper.stdout.readline(), timeout=timeout + 2)
+
+        if not line:
+            raise RuntimeError("Scripting helper closed its pipe")
+
+        return json.loads(line.decode('utf-8'))
+
+    async def _execute_via_helper(self, command: List[str], timeout: int) -> subprocess.CompletedProcess:
+        """Run a command over the pre-spawned helper's pipe protocol"""
+        response = await self._roundtrip_via_helper(
+            {"command": command, "timeout": timeout}, timeout)
+
+        if response.get("error") == "timeout":
+            raise subprocess.TimeoutExpired(command, timeout)
+        if "error" in response:
+            raise RuntimeError(response["error"])
+
+        return subprocess.CompletedProcess(
+            command,
+            response.get("returncode", 1),
+            stdout=response.get("stdout", ""),
+            stderr=response.get("stderr", "")
+        )
+
+    def _reset_helper(self):
+        """Drop a wedged helper so the next call re-spawns it"""
+        if self._helper_proc and self._helper_proc.returncode is None:
+            try:
+                self._helper_proc.kill()
+            except ProcessLookupError:
+                pass
+        self._helper_proc = None
+
+    async def run(self, command: List[str], timeout: int = 10) -> subprocess.CompletedProcess:
+        """
+        Execute an open/osascript command through the persistent helper,
+        falling back to a direct spawn if the helper is unavailable.
+        """
+        try:
+            return await self._execute_via_helper(command, timeout)
+        except subprocess.TimeoutExpired:
+            raise
+        except Exception as e:
+            logger.warning("⚠️ [SCRIPTING] Helper execution failed, falling back to direct spawn",
+                          error=str(e))
+            self._reset_helper()
+
+        loop = asyncio.get_event_loop()
+        return await loop.run_in_executor(
+            None,
+            lambda: subprocess.run(
+                command,
+                capture_output=True,
+                text=True,
+                timeout=timeout
+            )
+        )
+
+    async def run_applescript(self, script: str, timeout: int = 10) -> subprocess.CompletedProcess:
+        """Execute an AppleScript source string via osascript"""
+        return await self.run(['osascript', '-e', script], timeout)
+
+    async def notify(self, title: str, message: str,
+                     subtitle: str = "DeployBot", timeout: int = 5) -> bool:
+        """
+        Post a macOS notification through the helper's persistent osascript
+        session - one pipe write, no process spawn anywhere on the path.
+        Returns False if the session path is unavailable so the caller can
+        fall back to the spawn-based methods.
+        """
+        try:
+            response = await self._roundtrip_via_helper(
+                {"op": "notify", "title": title, "message": message,
+                 "subtitle": subtitle}, timeout)
+        except Exception as e:
+            logger.warning("⚠️ [SCRIPTING] Notify session unavailable",
+                          error=str(e))
+            self._reset_helper()
+            return False
+
+        if response.get("error") or response.get("returncode", 1) != 0:
+            logger.warning("⚠️ [SCRIPTING] Notify op failed",
+                          error=response.get("error") or response.get("stderr"))
+            return False
+        return True
+
+
+# Global scripting session instance - shared by redirect and notification paths
+scripting_session = ScriptingSession()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""
+Startup Self-Benchmark for DeployBot
+
+Collects a wall-clock timestamp for each startup stage - interpreter
+boot, backend imports, per-module initialization, socket bind, first
+Electron connection - so launch-time regressions show up as numbers in a
+report instead of being discovered by feel.
+
+Marks are recorded unconditionally (a handful of appends cost nothing);
+the machine-readable report is assembled on demand by the
+"startup-report" command, which process_manager.js fetches when launched
+with --startup-report. Interpreter boot time comes from the
+DEPLOYBOT_SPAWN_TS environment variable process_manager.js stamps at
+spawn, compared against the wall clock at the top of deploybot_main.py -
+same machine, same clock.
+"""
+
+import os
+import time
+
+# (stage, epoch seconds) in recording order
+_marks = []
+
+# Wall clock at the top of deploybot_main.py - everything before this is
+# interpreter boot, everything after is ours
+_main_start = None
+
+
+def enabled() -> bool:
+    """Whether the launcher asked for a startup report"""
+    return os.environ.get("DEPLOYBOT_STARTUP_REPORT") == "1"
+
+
+def begin(main_start: float):
+    """Anchor the report at the launcher script's first line of Python"""
+    global _main_start
+    _main_start = main_start
+    _marks.append(("python_main", main_start))
+
+
+def mark(stage: str):
+    """Record one named startup stage at the current wall clock"""
+    _marks.append((stage, time.time()))
+
+
+def mark_once(stage: str):
+    """Record a stage only the first time it happens (e.g. first client
+    connection - reconnects after a drop aren't startup)"""
+    if not any(existing == stage for existing, _ in _marks):
+        _marks.append((stage, time.time()))
+
+
+def get_report() -> dict:
+    """Assemble the machine-readable startup report"""
+    report = {
+        "marks": [
+            {
+                "stage": stage,
+                "at": at,
+                "since_main_ms": round((at - _main_start) * 1000, 1)
+                if _main_start is not None else None
+            }
+            for stage, at in _marks
+        ]
+    }
+
+    # Interpreter boot: spawn timestamp (stamped by process_manager.js in
+    # milliseconds) to the first line of deploybot_main.py
+    spawn_ts = os.environ.get("DEPLOYBOT_SPAWN_TS")
+    if spawn_ts and _main_start is not None:
+        try:
+            report["interpreter_boot_ms"] = round(
+                _main_start * 1000 - float(spawn_ts), 1)
+        except ValueError:
+            pass
+
+    return report
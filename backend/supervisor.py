@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""
+Supervised Background Tasks for DeployBot
+
+Every long-running loop in the backend (monitor polling, timer ticks, the
+activity-log queue, analytics rollup) used to be a bare asyncio.create_task:
+an unhandled exception killed the loop silently and the only remedy was a
+full process restart by process_manager.js, dropping the WebSocket and all
+warm caches. The supervisor wraps each loop instead - a crashed subsystem
+is logged, backed off exponentially, and restarted in place while the rest
+of the process keeps serving.
+
+Loops still exit cleanly by returning (their *_active flags work as
+before); only exceptions trigger a restart. Cancellation passes through,
+so existing task.cancel()/await shutdown paths are unchanged.
+"""
+
+import asyncio
+import time
+from typing import Any, Callable, Dict
+
+import structlog
+
+logger = structlog.get_logger()
+
+# A run that survives this long resets the backoff - the crash was
+# transient, not a tight failure loop
+STABLE_RUN_SECONDS = 60.0
+
+
+class TaskSupervisor:
+    """Owns restart policy and backoff for the backend's background loops"""
+
+    def __init__(self):
+        self.backoff_base = 0.1
+        self.backoff_cap = 30.0
+        self.default_max_restarts = 50
+        self._tasks = {}  # name -> {task, restarts, last_error, last_error_at, state}
+
+    def spawn(self, name: str, factory: Callable, max_restarts: int = None) -> asyncio.Task:
+        """
+        Run factory() under supervision and return the wrapper task.
+
+        factory is a zero-argument callable producing a fresh coroutine, so
+        the loop can be re-entered after a crash. The returned task behaves
+        like the old bare task for cancel()/await shutdown purposes.
+        """
+        if max_restarts is None:
+            max_restarts = self.default_max_restarts
+
+        entry = {"restarts": 0, "last_error": None,
+                 "last_error_at": None, "state": "running"}
+        entry["task"] = asyncio.create_task(
+            self._run_supervised(name, factory, max_restarts, entry))
+        self._tasks[name] = entry
+        return entry["task"]
+
+    async def _run_supervised(self, name: str, factory: Callable,
+                              max_restarts: int, entry: Dict[str, Any]):
+        backoff = self.backoff_base
+        while True:
+            run_started = time.monotonic()
+            try:
+                await factory()
+                entry["state"] = "finished"
+                return  # clean exit - the loop decided it was done
+            except asyncio.CancelledError:
+                entry["state"] = "cancelled"
+                raise
+            except Exception as e:
+                entry["restarts"] += 1
+                entry["last_error"] = str(e)
+                entry["last_error_at"] = time.time()
+
+                if entry["restarts"] > max_restarts:
+                    entry["state"] = "failed"
+                    logger.error("💀 [SUPERVISOR] Task exceeded restart budget - giving up",
+                                task=name, restarts=entry["restarts"], error=str(e))
+                    return
+
+                # A long stable run means the failure was transient, not a
+                # crash loop - start the backoff ladder over
+                if time.monotonic() - run_started >= STABLE_RUN_SECONDS:
+                    backoff = self.backoff_base
+
+                logger.error("🔁 [SUPERVISOR] Task crashed - restarting",
+                            task=name, restarts=entry["restarts"],
+                            backoff_seconds=round(backoff, 2), error=str(e))
+                entry["state"] = "backoff"
+                await asyncio.sleep(backoff)
+                backoff = min(backoff * 2, self.backoff_cap)
+                entry["state"] = "running"
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Per-task restart counters and states for perf-stats"""
+        tasks = {}
+        for name, entry in self._tasks.items():
+            task = entry["task"]
+            state = entry["state"]
+            if task.done() and state == "running":
+                state = "finished"
+            tasks[name] = {
+                "state": state,
+                "restarts": entry["restarts"],
+                "last_error": entry["last_error"],
+                "last_error_at": entry["last_error_at"]
+            }
+        return {
+            "supervised_tasks": len(self._tasks),
+            "total_restarts": sum(e["restarts"] for e in self._tasks.values()),
+            "tasks": tasks
+        }
+
+
+# Global supervisor instance
+task_supervisor = TaskSupervisor()
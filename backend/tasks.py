@@ -10,6 +10,7 @@ This module handles:
 """
 
 import asyncio
+import hashlib
 import json
 import os
 import re
@@ -23,23 +24,57 @@ import structlog
 from dotenv import load_dotenv
 load_dotenv()
 
-# OpenAI integration - Updated for modern client
-try:
-    from openai import OpenAI
-    OPENAI_AVAILABLE = True
-    logger = structlog.get_logger()
-    logger.info("✅ [TASKS] OpenAI library available for LLM task selection")
-except ImportError:
-    OPENAI_AVAILABLE = False
-    logger = structlog.get_logger()
-    logger.warning("⚠️ [TASKS] OpenAI library not available - using heuristic fallback only")
+logger = structlog.get_logger()
+
+# OpenAI integration - the SDK import is deferred to first LLM use because it
+# is slow to import and unnecessary when no API key is configured
+OPENAI_AVAILABLE = None  # unknown until the lazy import runs
+
+# Bit flags for the tags the heuristics care about. Task masks are computed
+# once at parse time so context filtering and scoring are integer AND tests
+# instead of lowercasing and scanning the tag list on every call
+TAG_BACKEND = 1 << 0
+TAG_LONG = 1 << 1
+TAG_SHORT = 1 << 2
+TAG_SOLO = 1 << 3
+TAG_CREATIVE = 1 << 4
+TAG_WRITING = 1 << 5
+TAG_RESEARCH = 1 << 6
+
+HEURISTIC_TAG_FLAGS = {
+    "#backend": TAG_BACKEND,
+    "#long": TAG_LONG,
+    "#short": TAG_SHORT,
+    "#solo": TAG_SOLO,
+    "#creative": TAG_CREATIVE,
+    "#writing": TAG_WRITING,
+    "#research": TAG_RESEARCH,
+}
+
+# Section headings treated as archives during TODO.md parsing. Tasks under
+# these headings never feed selection, so their lines are counted for
+# statistics but not enriched or materialized.
+ARCHIVED_SECTION_PATTERN = re.compile(
+    r'\b(done|completed?|archived?|log|history|changelog)\b', re.IGNORECASE)
 
 class TaskSelector:
     """Intelligent task selection system for DeployBot"""
     
     def __init__(self):
         self.openai_client = None
-        self.task_cache = {}  # Cache for LLM responses
+        self.openai_async_client = None  # Pooled async client, preferred for API calls
+        self.llm_timeout_budget = 8.0  # Per-call budget (seconds) before heuristic fallback
+        self.task_cache = {}  # Cache for LLM responses keyed by selection fingerprint
+        self.llm_cache_ttl = 6 * 3600  # Persisted LLM selections expire after 6 hours
+        self._llm_cache_loaded = set()  # Project paths whose persisted cache is in memory
+        self._todo_parse_cache = {}  # Parsed TODO.md cache keyed by path -> (mtime_ns, size, tasks)
+        self._todo_enrichment_cache = {}  # path -> {raw task line -> enriched fields}
+        self._todo_stats_cache = {}  # path -> (mtime_ns, size, statistics)
+        self._todo_archived_counts = {}  # path -> {"tasks", "completed"} from skipped sections
+        self._todo_pending_available = {}  # path -> bool, derived at parse time
+        self._task_vector_index = {}  # project_path -> {task text hash: token vector}
+        self._task_index_loaded = set()  # Project paths whose vector index is in memory
+        self.llm_candidate_limit = 10  # Similarity ranking trims the LLM prompt to this many tasks
         self.tag_app_mapping = {
             "writing": "Bear",
             "creative": "Figma", 
@@ -53,117 +88,241 @@ class TaskSelector:
             "email": "Mail"
         }
         
-        # Initialize OpenAI if available
-        self._initialize_openai()
-        
+        # OpenAI initialization is deferred to first LLM use (lazy import)
+        self._openai_initialized = False
+
         # Initialize analytics integration
         from analytics import analytics_manager
         self.analytics = analytics_manager
-        
-        logger.info("🎯 [TASKS] TaskSelector initialized", 
-                   openai_enabled=self.openai_client is not None,
+
+        logger.info("🎯 [TASKS] TaskSelector initialized",
+                   openai_enabled="deferred",
                    analytics_enabled=True)
-    
+
+    def _ensure_openai(self):
+        """Run the deferred OpenAI initialization exactly once"""
+        if not self._openai_initialized:
+            self._initialize_openai()
+
     def _initialize_openai(self):
-        """Initialize OpenAI client with API key"""
+        """Initialize OpenAI client with API key (imports the SDK lazily)"""
+        global OPENAI_AVAILABLE
+        self._openai_initialized = True
+
+        # Resolve SDK availability on first use so backend startup never pays
+        # the import cost
+        if OPENAI_AVAILABLE is None:
+            try:
+                import openai  # noqa: F401
+                OPENAI_AVAILABLE = True
+                logger.info("✅ [TASKS] OpenAI library available for LLM task selection")
+            except ImportError:
+                OPENAI_AVAILABLE = False
+                logger.warning("⚠️ [TASKS] OpenAI library not available - using heuristic fallback only")
+
         if not OPENAI_AVAILABLE:
             logger.info("📡 [TASKS] OpenAI library not available - using heuristic fallback only")
             return
-        
+
         # Check for API key in environment
         api_key = os.getenv('OPENAI_API_KEY')
         if not api_key:
             logger.warning("⚠️ [TASKS] OPENAI_API_KEY not found in environment - LLM features disabled")
             logger.info("💡 [TASKS] Add OPENAI_API_KEY to your .env file to enable AI task selection")
             return
-        
+
         try:
-            # Initialize modern OpenAI client
+            # Initialize modern OpenAI clients. The async client keeps a pooled
+            # HTTP connection open between calls, so repeated selections skip
+            # the TLS handshake; the sync client is kept as a fallback
+            from openai import OpenAI, AsyncOpenAI
             self.openai_client = OpenAI(api_key=api_key)
-            logger.info("✅ [TASKS] OpenAI client initialized successfully")
+            self.openai_async_client = AsyncOpenAI(
+                api_key=api_key,
+                timeout=self.llm_timeout_budget,
+                max_retries=1
+            )
+            logger.info("✅ [TASKS] OpenAI clients initialized successfully",
+                       timeout_budget=self.llm_timeout_budget)
             logger.info("🤖 [TASKS] AI-powered task selection enabled")
         except Exception as e:
             logger.error("❌ [TASKS] Failed to initialize OpenAI client", error=str(e))
             self.openai_client = None
+            self.openai_async_client = None
 
     async def parse_todo_file(self, todo_file_path: Path) -> List[Dict[str, Any]]:
         """Parse TODO.md file and extract tasks with tags and metadata"""
-        logger.info("📋 [TASKS] Parsing TODO.md file", file_path=str(todo_file_path))
-        
         tasks = []
-        
+
         try:
             if not todo_file_path.exists():
                 logger.warning("⚠️ [TASKS] TODO.md file not found", file_path=str(todo_file_path))
+                self._todo_pending_available[str(todo_file_path)] = False
                 return tasks
-            
+
+            # Serve the enriched task list from cache when the file is unchanged
+            # (same mtime and size) so repeated suggestions don't re-parse
+            file_stat = todo_file_path.stat()
+            cache_key = str(todo_file_path)
+            cached = self._todo_parse_cache.get(cache_key)
+            if cached and cached[0] == file_stat.st_mtime_ns and cached[1] == file_stat.st_size:
+                logger.debug("📋 [TASKS] TODO.md parse cache hit",
+                            file_path=cache_key, total_tasks=len(cached[2]))
+                # Copy per-task dicts so callers can annotate (e.g. suggestion_id)
+                # without polluting the cache
+                return [dict(task) for task in cached[2]]
+
+            logger.info("📋 [TASKS] Parsing TODO.md file", file_path=str(todo_file_path))
+
             content = todo_file_path.read_text(encoding='utf-8')
             lines = content.split('\n')
-            
+
+            # Section pre-pass: record which ## sections still contain an open
+            # task. Oversized TODO files are dominated by archive sections
+            # ("Done", pasted logs) whose lines would otherwise pay the full
+            # per-task enrichment below; this pass is a startswith scan, so
+            # those sections can be counted and skipped instead.
+            section_has_open = [False]  # index 0 = implicit preamble section
+            section_index = 0
+            for raw_line in lines:
+                stripped = raw_line.strip()
+                if stripped.startswith('##'):
+                    section_index += 1
+                    section_has_open.append(False)
+                elif stripped.startswith('- [ ]'):
+                    section_has_open[section_index] = True
+
             task_id = 1
             current_section = "Unknown"
-            
+            section_index = 0
+            materialize = section_has_open[0]
+            skipped_tasks = 0
+            skipped_completed = 0
+            stable_id_counts: Dict[str, int] = {}
+            parsed_at = datetime.now().isoformat()
+
+            # Enrichment results from the previous parse keyed by raw task
+            # text: a typical edit touches one checkbox, so almost every line
+            # is unchanged and can reuse its enriched fields instead of
+            # re-running the tag regexes and app/priority/duration heuristics
+            previous_enrichment = self._todo_enrichment_cache.get(cache_key, {})
+            enrichment: Dict[str, Dict[str, Any]] = {}
+            reused_lines = 0
+
             for line_num, line in enumerate(lines, 1):
                 line = line.strip()
-                
+
                 # Track sections (## Pending Tasks, ## Completed Tasks, etc.)
                 if line.startswith('##'):
                     current_section = line.replace('##', '').strip()
+                    section_index += 1
+                    # Materialize only sections that still hold open tasks;
+                    # archive headings are skipped even if one slipped through
+                    materialize = (section_has_open[section_index]
+                                   and not ARCHIVED_SECTION_PATTERN.search(current_section))
                     continue
-                
+
                 # Look for task lines (- [ ] or - [x])
                 if line.startswith('- ['):
                     completed = line.startswith('- [x]')
-                    
-                    # Extract task text (remove checkbox part)
-                    if completed:
-                        task_text = line[5:].strip()  # Remove "- [x] "
+
+                    # Skipped sections contribute counts for statistics but
+                    # no enriched task objects - selection never sees them
+                    if not materialize:
+                        skipped_tasks += 1
+                        if completed:
+                            skipped_completed += 1
+                        continue
+
+                    # Extract task text (remove checkbox part). Toggling a
+                    # checkbox leaves the text identical, so the enrichment
+                    # cache still hits.
+                    task_text = line[5:].strip()
+
+                    enriched = previous_enrichment.get(task_text)
+                    if enriched is None:
+                        # Changed or new line: pay the full enrichment cost
+                        tags = re.findall(r'#\w+', task_text)
+                        clean_text = re.sub(r'\s*#\w+', '', task_text).strip()
+                        enriched = {
+                            "text": clean_text,
+                            "tags": tags,
+                            "tag_mask": self._tags_to_mask(tags),
+                            "app": self._determine_app_for_task(tags, clean_text),
+                            "priority": self._calculate_task_priority(tags, clean_text),
+                            "estimated_duration": self._estimate_task_duration(tags, clean_text),
+                        }
                     else:
-                        task_text = line[5:].strip()  # Remove "- [ ] "
-                    
-                    # Extract hashtags using regex
-                    tags = re.findall(r'#\w+', task_text)
-                    
-                    # Remove tags from task text for clean display
-                    clean_text = re.sub(r'\s*#\w+', '', task_text).strip()
-                    
-                    # Determine app based on tags
-                    app = self._determine_app_for_task(tags, clean_text)
-                    
-                    # Calculate task priority based on tags
-                    priority = self._calculate_task_priority(tags, clean_text)
-                    
-                    # Estimate duration from tags
-                    estimated_duration = self._estimate_task_duration(tags, clean_text)
-                    
+                        reused_lines += 1
+                    enrichment[task_text] = enriched
+
+                    # Content-derived id that survives reordering and edits to
+                    # other lines, so the renderer can key rows on it and React
+                    # reconciliation stays O(visible rows). Duplicate task text
+                    # gets an occurrence suffix to keep ids unique.
+                    occurrence = stable_id_counts.get(task_text, 0)
+                    stable_id_counts[task_text] = occurrence + 1
+                    stable_id = hashlib.sha1(
+                        f"{task_text}#{occurrence}".encode('utf-8')).hexdigest()[:12]
+
                     task = {
                         "id": task_id,
-                        "text": clean_text,
+                        "stable_id": stable_id,
+                        "text": enriched["text"],
                         "original_text": task_text,
-                        "tags": tags,
+                        "tags": enriched["tags"],
+                        "tag_mask": enriched["tag_mask"],
                         "completed": completed,
-                        "app": app,
+                        "app": enriched["app"],
                         "section": current_section,
                         "line_number": line_num,
-                        "priority": priority,
-                        "estimated_duration": estimated_duration,
-                        "parsed_at": datetime.now().isoformat()
+                        "priority": enriched["priority"],
+                        "estimated_duration": enriched["estimated_duration"],
+                        "parsed_at": parsed_at
                     }
-                    
+
                     tasks.append(task)
                     task_id += 1
-            
-            logger.info("✅ [TASKS] TODO.md parsed successfully", 
+
+            # Cache the fully enriched list for subsequent calls this session,
+            # plus the per-line enrichment for the next incremental re-parse
+            self._todo_parse_cache[cache_key] = (file_stat.st_mtime_ns, file_stat.st_size, tasks)
+            self._todo_enrichment_cache[cache_key] = enrichment
+            self._todo_archived_counts[cache_key] = {
+                "tasks": skipped_tasks, "completed": skipped_completed}
+            self._todo_pending_available[cache_key] = any(
+                not task['completed'] for task in tasks
+            )
+
+            logger.info("✅ [TASKS] TODO.md parsed successfully",
                        total_tasks=len(tasks),
+                       reused_lines=reused_lines,
+                       skipped_tasks=skipped_tasks,
                        pending_tasks=len([t for t in tasks if not t['completed']]),
                        completed_tasks=len([t for t in tasks if t['completed']]))
-            
+
+            return [dict(task) for task in tasks]
+
+
         except Exception as e:
             logger.error("❌ [TASKS] Failed to parse TODO.md file", 
                         file_path=str(todo_file_path), error=str(e))
         
         return tasks
 
+    def tasks_available(self, project_path: str) -> Optional[bool]:
+        """
+        Parse-time availability flag for the project's TODO.md: True/False
+        once this session has parsed the file, None if it never has. Costs a
+        dict lookup with no file I/O, so the deploy hot path can consult it
+        directly. The TODO watcher keeps it current between parses.
+        """
+        return self._todo_pending_available.get(str(Path(project_path) / "TODO.md"))
+
+    def invalidate_tasks_available(self, todo_path: str) -> None:
+        """Drop the availability flag when a watcher reports a TODO change"""
+        self._todo_pending_available.pop(str(todo_path), None)
+
     def _determine_app_for_task(self, tags: List[str], task_text: str) -> str:
         """Determine the appropriate app for a task based on tags and content"""
         
@@ -280,45 +439,69 @@ class TaskSelector:
         logger.info("🎯 [TASKS] Selecting best task for context", 
                    project_path=project_path, context=context)
         
+        # 📊 The analytics context is keyed by project name and independent of
+        # the TODO pipeline - fetch it concurrently with parsing and ranking
+        # so the two I/O stages overlap instead of running back to back
+        project_name = context.get('project_name', Path(project_path).name)
+        analytics_future = asyncio.ensure_future(
+            self.analytics.get_task_analytics(project_name)
+        )
+
         # Load tasks from TODO.md
         todo_file = Path(project_path) / "TODO.md"
         tasks = await self.parse_todo_file(todo_file)
-        
+
         if not tasks:
             logger.warning("⚠️ [TASKS] No tasks found in TODO.md", file_path=str(todo_file))
+            analytics_future.cancel()
             return None
-        
+
         # Filter to pending tasks only
         pending_tasks = [task for task in tasks if not task['completed']]
-        
+
         if not pending_tasks:
             logger.warning("⚠️ [TASKS] No pending tasks found")
+            analytics_future.cancel()
             return None
-        
+
         # Apply context-based filtering
         filtered_tasks = self._filter_tasks_by_context(pending_tasks, context)
-        
+
         if not filtered_tasks:
             logger.warning("⚠️ [TASKS] No suitable tasks after filtering")
+            analytics_future.cancel()
             return None
-        
-        # 📊 ANALYTICS ENHANCEMENT: Load analytics data for intelligent selection
-        project_name = context.get('project_name', Path(project_path).name)
-        analytics_data = await self.analytics.get_task_analytics(project_name)
-        
+
+        # 🧭 Rank by context similarity so the LLM only sees the top candidates
+        filtered_tasks = self._rank_tasks_by_similarity(filtered_tasks, context, project_path)
+
+        # Warm the OpenAI client while the analytics fetch finishes
+        if context.get("use_llm", True):
+            self._ensure_openai()
+
+        # 📊 ANALYTICS ENHANCEMENT: Join the concurrent analytics fetch
+        try:
+            analytics_data = await analytics_future
+        except Exception as e:
+            logger.warning("⚠️ [TASKS] Analytics fetch failed, selecting without it",
+                          error=str(e))
+            analytics_data = None
+
         # Ensure analytics_data is never None
         if analytics_data is None:
             analytics_data = {}
-        
-        logger.info("📊 [TASKS] Analytics data loaded for task selection", 
+
+        logger.info("📊 [TASKS] Analytics data loaded for task selection",
                    project=project_name,
                    suggestions_count=analytics_data.get('suggestions_count', 0),
                    acceptance_rate=analytics_data.get('acceptance_rate', 0.0))
-        
+
         # Try LLM selection first, fallback to heuristic
         if self.openai_client and context.get("use_llm", True):
             try:
-                selected_task = await self._select_task_with_llm(filtered_tasks, context, analytics_data)
+                # Only ship the highest-similarity candidates to the LLM
+                llm_candidates = filtered_tasks[:self.llm_candidate_limit]
+                selected_task = await self._select_task_with_llm(llm_candidates, context, analytics_data)
                 if selected_task:
                     logger.info("✅ [TASKS] Task selected using LLM", task=selected_task['text'])
                     
@@ -348,52 +531,149 @@ class TaskSelector:
         
         return selected_task
 
+    @staticmethod
+    def _tags_to_mask(tags: List[str]) -> int:
+        """Collapse a task's tags into a bitmask of the flags the heuristics use"""
+        mask = 0
+        for tag in tags:
+            mask |= HEURISTIC_TAG_FLAGS.get(tag.lower(), 0)
+        return mask
+
+    @staticmethod
+    def _vectorize_text(text: str) -> Dict[str, int]:
+        """Build a token-frequency vector for lightweight similarity ranking"""
+        vector: Dict[str, int] = {}
+        for token in re.findall(r"[a-z0-9']+", text.lower()):
+            vector[token] = vector.get(token, 0) + 1
+        return vector
+
+    @staticmethod
+    def _cosine_similarity(a: Dict[str, int], b: Dict[str, int]) -> float:
+        """Cosine similarity between two sparse token vectors"""
+        if not a or not b:
+            return 0.0
+        dot = sum(count * b[token] for token, count in a.items() if token in b)
+        if not dot:
+            return 0.0
+        norm_a = sum(v * v for v in a.values()) ** 0.5
+        norm_b = sum(v * v for v in b.values()) ** 0.5
+        return dot / (norm_a * norm_b)
+
+    def _task_index_file(self, project_path: str) -> Path:
+        """Location of the persisted task vector index inside .deploybot"""
+        return Path(project_path) / ".deploybot" / "task_index.json"
+
+    def _load_task_index(self, project_path: str) -> Dict[str, Dict[str, int]]:
+        """Load the persisted vector index for a project once per session"""
+        index = self._task_vector_index.setdefault(project_path, {})
+        if project_path in self._task_index_loaded:
+            return index
+        self._task_index_loaded.add(project_path)
+
+        index_file = self._task_index_file(project_path)
+        if index_file.exists():
+            try:
+                index.update(json.loads(index_file.read_text(encoding='utf-8')))
+                logger.debug("🧭 [TASKS] Loaded task vector index",
+                            project_path=project_path, entries=len(index))
+            except Exception as e:
+                logger.warning("⚠️ [TASKS] Failed to load task vector index",
+                              index_file=str(index_file), error=str(e))
+        return index
+
+    def _persist_task_index(self, project_path: str, index: Dict[str, Dict[str, int]]) -> None:
+        """Write the vector index back to the project's .deploybot dir"""
+        try:
+            index_file = self._task_index_file(project_path)
+            index_file.parent.mkdir(parents=True, exist_ok=True)
+            temp_file = index_file.with_suffix('.tmp')
+            temp_file.write_text(json.dumps(index), encoding='utf-8')
+            temp_file.replace(index_file)
+        except Exception as e:
+            logger.warning("⚠️ [TASKS] Failed to persist task vector index",
+                          project_path=project_path, error=str(e))
+
+    def _rank_tasks_by_similarity(self, tasks: List[Dict[str, Any]], context: Dict[str, Any],
+                                  project_path: str) -> List[Dict[str, Any]]:
+        """
+        Rank tasks by similarity between their text and the deploy context
+
+        Vectors are computed incrementally - only tasks whose text hasn't been
+        seen before are vectorized - and the index is persisted per project so
+        warm starts skip the work entirely. The ranking happens fully in-memory
+        and keeps the priority ordering for ties.
+        """
+        index = self._load_task_index(project_path)
+
+        context_text = " ".join(str(v) for v in (
+            context.get('project_name', ''),
+            context.get('deploy_command', ''),
+        ) if v)
+        context_vector = self._vectorize_text(context_text)
+
+        index_changed = False
+        for task in tasks:
+            text_hash = hashlib.sha256(task['text'].encode('utf-8')).hexdigest()[:16]
+            vector = index.get(text_hash)
+            if vector is None:
+                vector = self._vectorize_text(task['text'])
+                index[text_hash] = vector
+                index_changed = True
+            task['similarity_score'] = self._cosine_similarity(context_vector, vector)
+
+        if index_changed:
+            self._persist_task_index(project_path, index)
+
+        # Stable sort: similarity first, existing priority order breaks ties
+        ranked = sorted(tasks, key=lambda t: t.get('similarity_score', 0.0), reverse=True)
+
+        logger.debug("🧭 [TASKS] Similarity ranking complete",
+                    task_count=len(ranked),
+                    top_score=ranked[0].get('similarity_score', 0.0) if ranked else 0.0)
+        return ranked
+
     def _filter_tasks_by_context(self, tasks: List[Dict[str, Any]], context: Dict[str, Any]) -> List[Dict[str, Any]]:
         """Filter tasks based on deployment context and preferences"""
         logger.debug("🔍 [TASKS] Filtering tasks by context", task_count=len(tasks), context=context)
-        
+
         filtered = []
-        
+
+        # Hoist per-call context out of the loop
+        deploy_active = context.get('deploy_active', False)
+        timer_duration = context.get('timer_duration', 1800)  # 30 minutes default
+        current_hour = datetime.now().hour
+
         for task in tasks:
-            should_include = True
-            tags = [tag.lower() for tag in task.get('tags', [])]
-            
+            mask = task.get('tag_mask')
+            if mask is None:
+                mask = self._tags_to_mask(task.get('tags', []))
+
             # During deploy: exclude backend tasks
-            if context.get('deploy_active', False):
-                if '#backend' in tags:
-                    logger.debug("🚫 [TASKS] Excluding backend task during deploy", task=task['text'])
-                    should_include = False
-                    continue
-            
-            # Time-based filtering
-            timer_duration = context.get('timer_duration', 1800)  # 30 minutes default
+            if deploy_active and mask & TAG_BACKEND:
+                logger.debug("🚫 [TASKS] Excluding backend task during deploy", task=task['text'])
+                continue
+
+            # Time-based filtering: for short timers, prefer short tasks
             estimated_duration = task.get('estimated_duration', 45)
-            
-            # For short timers, prefer short tasks
             if timer_duration <= 900:  # 15 minutes or less
-                if '#long' in tags or estimated_duration > 60:
+                if mask & TAG_LONG or estimated_duration > 60:
                     logger.debug("🚫 [TASKS] Excluding long task for short timer", task=task['text'])
-                    should_include = False
                     continue
-            
-            # Time of day considerations
-            current_hour = datetime.now().hour
-            
-            # Creative tasks better in morning/afternoon  
-            if '#creative' in tags and (current_hour < 8 or current_hour > 18):
+
+            # Creative tasks better in morning/afternoon
+            if mask & TAG_CREATIVE and (current_hour < 8 or current_hour > 18):
                 task['priority'] = max(1, task.get('priority', 5) - 1)
-            
+
             # Research tasks good anytime
-            if '#research' in tags:
+            if mask & TAG_RESEARCH:
                 task['priority'] = task.get('priority', 5) + 1
-            
+
             # Writing tasks good for focus periods
-            if '#writing' in tags and context.get('deploy_active', False):
+            if mask & TAG_WRITING and deploy_active:
                 task['priority'] = task.get('priority', 5) + 2
-            
-            if should_include:
-                filtered.append(task)
-        
+
+            filtered.append(task)
+
         # Sort by priority (highest first)
         filtered.sort(key=lambda t: t.get('priority', 5), reverse=True)
         
@@ -403,23 +683,84 @@ class TaskSelector:
         
         return filtered
 
+    def _selection_fingerprint(self, tasks: List[Dict[str, Any]], context: Dict[str, Any]) -> str:
+        """Stable fingerprint of a task set + context for the LLM response cache"""
+        payload = {
+            "tasks": [task['text'] for task in tasks],
+            "context": {k: str(v) for k, v in sorted(context.items())}
+        }
+        return hashlib.sha256(json.dumps(payload, sort_keys=True).encode('utf-8')).hexdigest()
+
+    def _llm_cache_file(self, project_path: str) -> Path:
+        """Location of the persisted LLM cache inside the project's .deploybot dir"""
+        return Path(project_path) / ".deploybot" / "llm_cache.json"
+
+    def _load_llm_cache(self, project_path: str) -> None:
+        """Load the persisted LLM cache for a project once per session"""
+        if not project_path or project_path in self._llm_cache_loaded:
+            return
+        self._llm_cache_loaded.add(project_path)
+
+        cache_file = self._llm_cache_file(project_path)
+        if not cache_file.exists():
+            return
+
+        try:
+            entries = json.loads(cache_file.read_text(encoding='utf-8'))
+            now = time.time()
+            loaded = 0
+            for fingerprint, entry in entries.items():
+                if now - entry.get('cached_at', 0) < self.llm_cache_ttl:
+                    self.task_cache[fingerprint] = entry
+                    loaded += 1
+            logger.info("📦 [TASKS] Loaded persisted LLM cache",
+                       project_path=project_path, entries=loaded)
+        except Exception as e:
+            logger.warning("⚠️ [TASKS] Failed to load persisted LLM cache",
+                          cache_file=str(cache_file), error=str(e))
+
+    def _persist_llm_cache(self, project_path: str) -> None:
+        """Write this project's unexpired LLM cache entries back to disk"""
+        if not project_path:
+            return
+
+        try:
+            cache_file = self._llm_cache_file(project_path)
+            cache_file.parent.mkdir(parents=True, exist_ok=True)
+
+            now = time.time()
+            entries = {
+                fingerprint: entry
+                for fingerprint, entry in self.task_cache.items()
+                if entry.get('project') == project_path
+                and now - entry.get('cached_at', 0) < self.llm_cache_ttl
+            }
+
+            temp_file = cache_file.with_suffix('.tmp')
+            temp_file.write_text(json.dumps(entries, indent=2), encoding='utf-8')
+            temp_file.replace(cache_file)
+        except Exception as e:
+            logger.warning("⚠️ [TASKS] Failed to persist LLM cache",
+                          project_path=project_path, error=str(e))
+
     async def _select_task_with_llm(self, tasks: List[Dict[str, Any]], context: Dict[str, Any], analytics_data: Optional[Dict[str, Any]] = None) -> Optional[Dict[str, Any]]:
         """Use OpenAI to intelligently select the best task"""
         logger.info("🤖 [TASKS] Using LLM for task selection", task_count=len(tasks))
-        
-        # Create cache key for this selection
-        task_texts = [task['text'] for task in tasks]
-        cache_key = hash(tuple(task_texts) + tuple(sorted(context.items())))
-        
-        # Check cache first
-        if cache_key in self.task_cache:
+
+        # Create cache key for this selection (stable across restarts)
+        project_path = context.get('project_path', '')
+        self._load_llm_cache(project_path)
+        cache_key = self._selection_fingerprint(tasks, context)
+
+        # Check cache first (in-memory, seeded from the persisted project cache)
+        cached_result = self.task_cache.get(cache_key)
+        if cached_result and time.time() - cached_result.get('cached_at', 0) < self.llm_cache_ttl:
             logger.debug("📦 [TASKS] Using cached LLM response")
-            cached_result = self.task_cache[cache_key]
             # Find the task that matches the cached selection
             for task in tasks:
                 if task['text'] == cached_result['task_text']:
                     return task
-        
+
         # Prepare context for LLM
         context_str = self._format_context_for_llm(context)
         tasks_str = self._format_tasks_for_llm(tasks)
@@ -467,13 +808,17 @@ Respond with ONLY a JSON object:
             result = self._parse_llm_response(response, tasks)
             
             if result:
-                # Cache the result
+                # Cache the result and persist it for future sessions
                 self.task_cache[cache_key] = {
                     "task_text": result['text'],
                     "reasoning": response.get('reasoning', ''),
+                    "confidence": response.get('confidence', 0.0),
+                    "project": project_path,
+                    "cached_at": time.time(),
                     "timestamp": datetime.now().isoformat()
                 }
-                
+                self._persist_llm_cache(project_path)
+
                 logger.info("✅ [TASKS] LLM task selection successful", 
                            task=result['text'],
                            reasoning=response.get('reasoning', ''))
@@ -490,27 +835,35 @@ Respond with ONLY a JSON object:
         """Make API call to OpenAI with proper error handling - Updated for modern client"""
         
         # Safety check: ensure OpenAI client is available
+        self._ensure_openai()
         if not self.openai_client:
             logger.error("❌ [TASKS] OpenAI client not available for API call")
             raise Exception("OpenAI client not initialized")
         
         # Type assertion - we know client is not None after the check above
         client = self.openai_client
-        
+
         try:
             logger.debug("🤖 [TASKS] Making OpenAI API call...")
-            
-            # Use the modern OpenAI client API
-            response = await asyncio.get_event_loop().run_in_executor(
-                None,
-                lambda: client.chat.completions.create(
-                    model="gpt-3.5-turbo",
-                    messages=[{"role": "user", "content": prompt}],
-                    max_tokens=200,
-                    temperature=0.7
+
+            request_kwargs = {
+                "model": "gpt-3.5-turbo",
+                "messages": [{"role": "user", "content": prompt}],
+                "max_tokens": 200,
+                "temperature": 0.7
+            }
+
+            if self.openai_async_client:
+                # Preferred path: pooled async client, no executor hop, and the
+                # client-level timeout keeps the call inside the budget
+                response = await self.openai_async_client.chat.completions.create(**request_kwargs)
+            else:
+                # Fallback: sync client on the default executor
+                response = await asyncio.get_event_loop().run_in_executor(
+                    None,
+                    lambda: client.chat.completions.create(**request_kwargs)
                 )
-            )
-            
+
             # Safely extract content from response
             if not response or not response.choices or not response.choices[0]:
                 logger.error("❌ [TASKS] Invalid response structure from OpenAI")
@@ -570,23 +923,27 @@ Respond with ONLY a JSON object:
         # Already filtered and sorted by priority in _filter_tasks_by_context
         # Apply additional heuristic scoring
         
+        deploy_active = context.get('deploy_active', False)
+        timer_duration = context.get('timer_duration', 1800)
+
         for task in tasks:
             score = task.get('priority', 5)
-            tags = [tag.lower() for tag in task.get('tags', [])]
-            
+            mask = task.get('tag_mask')
+            if mask is None:
+                mask = self._tags_to_mask(task.get('tags', []))
+
             # Boost solo tasks during deploys (easier to start/stop)
-            if context.get('deploy_active', False) and '#solo' in tags:
+            if deploy_active and mask & TAG_SOLO:
                 score += 2
-            
+
             # Boost short tasks for short timers
-            timer_duration = context.get('timer_duration', 1800)
-            if timer_duration <= 1800 and '#short' in tags:  # 30 minutes or less
+            if timer_duration <= 1800 and mask & TAG_SHORT:  # 30 minutes or less
                 score += 1
-            
+
             # Boost creative/writing tasks (good for focus)
-            if '#creative' in tags or '#writing' in tags:
+            if mask & (TAG_CREATIVE | TAG_WRITING):
                 score += 1
-            
+
             task['heuristic_score'] = score
         
         # Sort by heuristic score
@@ -673,37 +1030,62 @@ Respond with ONLY a JSON object:
         return '\n'.join(context_lines)
 
     async def get_task_statistics(self, project_path: str) -> Dict[str, Any]:
-        """Get statistics about tasks in the project"""
+        """Get statistics about tasks in the project (cached per file version)"""
         todo_file = Path(project_path) / "TODO.md"
+        cache_key = str(todo_file)
+
+        # Statistics ride the parse cache's versioning: for an unchanged file
+        # a UI refresh costs a stat() and a dict lookup instead of a parse
+        # plus a full re-derivation
+        file_stat = None
+        try:
+            file_stat = todo_file.stat()
+            cached = self._todo_stats_cache.get(cache_key)
+            if cached and cached[0] == file_stat.st_mtime_ns and cached[1] == file_stat.st_size:
+                return dict(cached[2])
+        except OSError:
+            pass
+
         tasks = await self.parse_todo_file(todo_file)
-        
-        if not tasks:
+
+        # Sections skipped by lazy parsing (archives, all-completed sections)
+        # still count toward totals; only their per-task detail is absent
+        archived = self._todo_archived_counts.get(cache_key, {"tasks": 0, "completed": 0})
+
+        if not tasks and not archived["tasks"]:
             return {"error": "No tasks found"}
-        
+
         pending_tasks = [t for t in tasks if not t['completed']]
         completed_tasks = [t for t in tasks if t['completed']]
-        
+        total_count = len(tasks) + archived["tasks"]
+        completed_count = len(completed_tasks) + archived["completed"]
+
         # Tag analysis
         all_tags = []
         for task in tasks:
             all_tags.extend(task.get('tags', []))
-        
+
         tag_counts = {}
         for tag in all_tags:
             tag_counts[tag] = tag_counts.get(tag, 0) + 1
-        
+
         # Duration analysis
         total_estimated_time = sum(task.get('estimated_duration', 45) for task in pending_tasks)
-        
-        return {
-            "total_tasks": len(tasks),
+
+        statistics = {
+            "total_tasks": total_count,
             "pending_tasks": len(pending_tasks),
-            "completed_tasks": len(completed_tasks),
-            "completion_rate": len(completed_tasks) / len(tasks) if tasks else 0,
+            "completed_tasks": completed_count,
+            "completion_rate": completed_count / total_count if total_count else 0,
             "estimated_remaining_time": total_estimated_time,
             "most_common_tags": sorted(tag_counts.items(), key=lambda x: x[1], reverse=True)[:5],
             "avg_priority": sum(task.get('priority', 5) for task in pending_tasks) / len(pending_tasks) if pending_tasks else 0
         }
 
+        if file_stat is not None:
+            self._todo_stats_cache[cache_key] = (file_stat.st_mtime_ns, file_stat.st_size, statistics)
+
+        return statistics
+
 # Global instance
 task_selector = TaskSelector() 
\ No newline at end of file
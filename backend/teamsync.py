@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+"""
+Team Analytics Sync for DeployBot
+
+Optional subsystem that shares per-project analytics across a team
+through a shared directory (Dropbox, NFS, a mounted drive - anything
+that looks like a folder). Enabled by pointing DEPLOYBOT_TEAM_SYNC_DIR
+at the shared location; without it the module is inert.
+
+The sync is conflict-free by construction:
+  - analytics records are immutable and id-addressed, and the local
+    monthly JSONL segments are append-only, so exporting is a plain byte
+    copy of each segment's unseen tail into a per-peer delta file
+    (<sync_dir>/<project>/<prefix>.<peer_id>.jsonl) - every file has
+    exactly one writer, so there is nothing to merge on the write side
+  - merging reads peers' delta files from a remembered byte offset and
+    folds only the new records into a running team rollup, so each
+    record is consumed exactly once and team-wide numbers come from
+    compact logs instead of N full exports
+
+Cursors (export and import offsets) plus the rollup live in
+~/.deploybot/team_sync_state.json, written atomically.
+"""
+
+import asyncio
+import getpass
+import os
+import secrets
+import socket
+import time
+from pathlib import Path
+from typing import Any, Dict, Optional
+
+import structlog
+
+import jsoncodec
+from supervisor import task_supervisor
+
+logger = structlog.get_logger()
+
+# Record types shared with the team - the append-only JSONL segments
+SYNC_PREFIXES = ("suggestions", "interactions", "sessions", "deploy_patterns")
+
+
+class TeamSyncManager:
+    """Exports local analytics deltas and merges peers' into a team rollup"""
+
+    def __init__(self):
+        sync_dir = os.environ.get("DEPLOYBOT_TEAM_SYNC_DIR")
+        self.sync_root = Path(sync_dir).expanduser() if sync_dir else None
+        self.sync_interval = 300.0  # Seconds between sync passes
+        self.state_file = Path.home() / ".deploybot" / "team_sync_state.json"
+        self.peer_id_file = Path.home() / ".deploybot" / "sync_peer_id"
+
+        self._sync_task = None
+        self._state = None  # Loaded lazily: {"export": {}, "import": {}, "rollup": {}}
+        self._last_sync_at = None
+        self._last_error = None
+        self.peer_id = None
+
+    def enabled(self) -> bool:
+        """Whether a shared sync directory is configured"""
+        return self.sync_root is not None
+
+    def _load_peer_id(self) -> str:
+        """Stable identity for this machine's delta files"""
+        try:
+            if self.peer_id_file.exists():
+                peer_id = self.peer_id_file.read_text().strip()
+                if peer_id:
+                    return peer_id
+        except Exception:
+            pass
+
+        peer_id = f"{getpass.getuser()}-{socket.gethostname().split('.')[0]}-{secrets.token_hex(2)}"
+        try:
+            self.peer_id_file.parent.mkdir(parents=True, exist_ok=True)
+            self.peer_id_file.write_text(peer_id)
+        except Exception as e:
+            logger.warning("⚠️ [TEAMSYNC] Failed to persist peer id", error=str(e))
+        return peer_id
+
+    def _load_state(self) -> Dict[str, Any]:
+        if self._state is not None:
+            return self._state
+        try:
+            if self.state_file.exists():
+                with open(self.state_file, 'r') as f:
+                    self._state = jsoncodec.load(f)
+        except Exception as e:
+            logger.warning("⚠️ [TEAMSYNC] Failed to load sync state, starting fresh",
+                          error=str(e))
+        if not isinstance(self._state, dict):
+            self._state = {}
+        self._state.setdefault("export", {})   # local segment path -> exported byte offset
+        self._state.setdefault("import", {})   # peer delta path -> consumed byte offset
+        self._state.setdefault("rollup", {})   # project -> merged team counters
+        return self._state
+
+    def _save_state(self):
+        """Persist cursors and rollup atomically (tmp + replace)"""
+        try:
+            self.state_file.parent.mkdir(parents=True, exist_ok=True)
+            tmp_file = self.state_file.with_suffix('.tmp')
+            with open(tmp_file, 'w') as f:
+                f.write(jsoncodec.dumps(self._state))
+            tmp_file.replace(self.state_file)
+        except Exception as e:
+            logger.error("❌ [TEAMSYNC] Failed to save sync state", error=str(e))
+
+    async def start(self):
+        """Start the periodic sync loop (no-op when not configured)"""
+        if not self.enabled():
+            logger.debug("🤝 [TEAMSYNC] No sync directory configured - team sync disabled")
+            return
+        if self._sync_task:
+            return
+
+        self.peer_id = self._load_peer_id()
+        self._sync_task = task_supervisor.spawn("team_sync_loop", self._sync_loop)
+        logger.info("🤝 [TEAMSYNC] Team analytics sync started",
+                   sync_root=str(self.sync_root), peer_id=self.peer_id)
+
+    async def stop(self):
+        """Stop the sync loop, flushing one last pass"""
+        if not self._sync_task:
+            return
+        self._sync_task.cancel()
+        try:
+            await self._sync_task
+        except asyncio.CancelledError:
+            pass
+        self._sync_task = None
+
+        try:
+            await asyncio.get_running_loop().run_in_executor(None, self._sync_once)
+        except Exception as e:
+            logger.warning("⚠️ [TEAMSYNC] Final sync pass failed", error=str(e))
+
+    async def _sync_loop(self):
+        """Periodic export + merge, entirely off the event loop"""
+        loop = asyncio.get_running_loop()
+        while True:
+            try:
+                await loop.run_in_executor(None, self._sync_once)
+                self._last_error = None
+            except Exception as e:
+                # Shared folders come and go (offline Dropbox, unmounted
+                # drive) - keep cursors intact and retry next interval
+                self._last_error = str(e)
+                logger.warning("⚠️ [TEAMSYNC] Sync pass failed", error=str(e))
+            await asyncio.sleep(self.sync_interval)
+
+    # SYNC PASS (blocking - runs in the default executor)
+
+    def _sync_once(self):
+        from analytics import analytics_manager
+
+        state = self._load_state()
+        exported = self._export_deltas(analytics_manager.projects_root, state)
+        merged = self._merge_peer_deltas(state)
+        if exported or merged:
+            self._save_state()
+        self._last_sync_at = time.time()
+        if exported or merged:
+            logger.info("🤝 [TEAMSYNC] Sync pass complete",
+                       exported_bytes=exported, merged_records=merged)
+
+    def _export_deltas(self, projects_root: Path, state: Dict[str, Any]) -> int:
+        """Byte-copy unseen segment tails into our per-peer delta files"""
+        total = 0
+        if not projects_root.exists():
+            return 0
+
+        for project_dir in sorted(projects_root.iterdir()):
+            analytics_dir = project_dir / "analytics"
+            if not analytics_dir.is_dir():
+                continue
+
+            for prefix in SYNC_PREFIXES:
+                for segment in sorted(analytics_dir.glob(f"{prefix}_*.jsonl")):
+                    cursor_key = str(segment)
+                    offset = state["export"].get(cursor_key, 0)
+                    size = segment.stat().st_size
+                    if size <= offset:
+                        continue
+
+                    delta_dir = self.sync_root / project_dir.name
+                    delta_dir.mkdir(parents=True, exist_ok=True)
+                    delta_file = delta_dir / f"{prefix}.{self.peer_id}.jsonl"
+
+                    with open(segment, 'rb') as src:
+                        src.seek(offset)
+                        chunk = src.read()
+                    with open(delta_file, 'ab') as dst:
+                        dst.write(chunk)
+
+                    state["export"][cursor_key] = size
+                    total += len(chunk)
+        return total
+
+    def _merge_peer_deltas(self, state: Dict[str, Any]) -> int:
+        """Fold peers' new delta records into the running team rollup"""
+        merged = 0
+        if not self.sync_root.exists():
+            return 0
+
+        for project_dir in sorted(self.sync_root.iterdir()):
+            if not project_dir.is_dir():
+                continue
+
+            for delta_file in sorted(project_dir.glob("*.jsonl")):
+                # name: <prefix>.<peer_id>.jsonl - skip our own deltas
+                parts = delta_file.name.split('.')
+                if len(parts) < 3:
+                    continue
+                prefix, peer_id = parts[0], parts[1]
+                if peer_id == self.peer_id or prefix not in SYNC_PREFIXES:
+                    continue
+
+                cursor_key = str(delta_file)
+                offset = state["import"].get(cursor_key, 0)
+                size = delta_file.stat().st_size
+                if size <= offset:
+                    continue
+
+                with open(delta_file, 'r') as f:
+                    f.seek(offset)
+                    for line in f:
+                        line = line.strip()
+                        if not line:
+                            continue
+                        try:
+                            record = jsoncodec.loads(line)
+                        except jsoncodec.JSONDecodeError:
+                            continue
+                        self._fold_record(state["rollup"], project_dir.name,
+                                          peer_id, prefix, record)
+                        merged += 1
+
+                state["import"][cursor_key] = size
+        return merged
+
+    def _fold_record(self, rollup: Dict[str, Any], project_name: str,
+                     peer_id: str, prefix: str, record: Dict[str, Any]):
+        """Bump the team counters for one peer record"""
+        project = rollup.setdefault(project_name, {
+            "suggestions": 0,
+            "interactions": {},
+            "sessions": 0,
+            "time_saved_seconds": 0,
+            "switch_presses": 0,
+            "deploys": 0,
+            "peers": {}
+        })
+        project["peers"][peer_id] = project["peers"].get(peer_id, 0) + 1
+
+        if prefix == "suggestions":
+            project["suggestions"] += 1
+        elif prefix == "interactions":
+            kind = record.get("interaction_type", "unknown")
+            project["interactions"][kind] = project["interactions"].get(kind, 0) + 1
+        elif prefix == "sessions":
+            project["sessions"] += 1
+            project["time_saved_seconds"] += record.get("estimated_time_saved_seconds", 0)
+            if record.get("switch_button_pressed"):
+                project["switch_presses"] += 1
+        elif prefix == "deploy_patterns":
+            project["deploys"] += 1
+
+    def get_team_overview(self) -> Dict[str, Any]:
+        """The merged team rollup plus sync status"""
+        state = self._load_state()
+        return {
+            "enabled": self.enabled(),
+            "peer_id": self.peer_id,
+            "sync_root": str(self.sync_root) if self.sync_root else None,
+            "last_sync_at": self._last_sync_at,
+            "last_error": self._last_error,
+            "projects": state["rollup"]
+        }
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Cursor/health snapshot for perf-stats"""
+        state = self._load_state() if self.enabled() else {"export": {}, "import": {}}
+        return {
+            "enabled": self.enabled(),
+            "peer_id": self.peer_id,
+            "tracked_segments": len(state["export"]),
+            "tracked_peer_files": len(state["import"]),
+            "last_sync_at": self._last_sync_at,
+            "last_error": self._last_error
+        }
+
+
+# Global team sync instance
+team_sync = TeamSyncManager()
@@ -9,13 +9,19 @@ and integrates with the LangGraph workflow for productivity redirections.
 """
 
 import asyncio
+import json
 import time
+from collections import deque
 from datetime import datetime, timedelta
+from pathlib import Path
 from typing import Dict, Any, Optional, Callable, List
 import structlog
 
 # 📊 PHASE 2: Analytics integration
 from analytics import analytics_manager
+from metrics import metrics_segment
+from powerprofile import power_profile
+from supervisor import task_supervisor
 
 logger = structlog.get_logger()
 
@@ -31,11 +37,28 @@ class DeployTimer:
         self.websocket_clients = set()  # WebSocket clients for real-time updates
         self.websocket_server = None
         self.update_interval = 2.0  # Update every 2 seconds instead of 1
+        self.sync_interval = 30.0  # Coalesced frames are drift-correction syncs, not a stream
+        self._next_sync = 0.0  # Monotonic deadline for the next coalesced sync frame
         self.timer_update_task = None
+        self._expiry_handles = {}  # project_name -> loop.call_at handle for expiry
+        self.state_version = 0  # Bumped whenever any timer state changes
+        self.tick_durations = deque(maxlen=200)  # Rolling update-loop tick latencies (ms) for perf-stats
         
         # 📊 PHASE 2: Analytics session tracking
         self.timer_to_session_mapping = {}  # project_name -> session_id
-        
+
+        # Sleep/wake detection: the wall-vs-monotonic offset is stable while
+        # the machine is awake and jumps by the sleep duration on wake
+        # (CLOCK_MONOTONIC pauses during suspend). A jump past the threshold
+        # triggers one reconciliation instead of a burst of catch-up ticks.
+        self.suspend_threshold = 5.0  # Seconds of divergence treated as a suspend
+        self.suspend_gaps = deque(maxlen=50)  # Recent wake gaps for diagnostics
+        self._clock_offset = None  # wall minus monotonic, sampled per tick
+
+        # Timer journal so sessions survive a backend restart (the Electron
+        # process manager auto-restarts a crashed backend)
+        self.journal_file = Path.home() / ".deploybot" / "timer_journal.json"
+
         logger.info("⏰ [TIMER] DeployTimer initialized with Phase 2 analytics integration")
 
     def add_timer_callback(self, callback: Callable):
@@ -109,13 +132,21 @@ class DeployTimer:
             }
             
             self.active_timers[project_name] = timer_info
-            
+            self.state_version += 1
+
             # 📊 PHASE 2: Store timer to session mapping
             self.timer_to_session_mapping[project_name] = session_id
+
+            # Journal the new session so a restart can recover it
+            self._write_timer_journal()
+
+            # Expiry fires at the absolute deadline, not from tick polling
+            self._schedule_expiry(project_name)
             
             # Start the update loop if not already running
             if not self.timer_update_task:
-                self.timer_update_task = asyncio.create_task(self._timer_update_loop())
+                self.timer_update_task = task_supervisor.spawn(
+                    "timer_update_loop", self._timer_update_loop)
             
             # Notify callbacks
             await self._notify_timer_event("timer_started", timer_info)
@@ -148,6 +179,7 @@ class DeployTimer:
             return False
         
         try:
+            self._cancel_expiry(project_name)
             timer_info = self.active_timers[project_name]
             timer_info["status"] = "stopped"
             timer_info["stop_reason"] = reason
@@ -177,7 +209,9 @@ class DeployTimer:
             
             # Remove from active timers
             del self.active_timers[project_name]
-            
+            self.state_version += 1
+            self._write_timer_journal()
+
             # Stop update loop if no active timers
             if not self.active_timers and self.timer_update_task:
                 self.timer_update_task.cancel()
@@ -213,6 +247,9 @@ class DeployTimer:
             timer_info["paused"] = True
             timer_info["pause_time"] = time.time()
             timer_info["status"] = "paused"
+            self.state_version += 1
+            self._write_timer_journal()
+            self._cancel_expiry(project_name)
             
             # Notify callbacks
             await self._notify_timer_event("timer_paused", timer_info)
@@ -257,6 +294,9 @@ class DeployTimer:
             timer_info["paused"] = False
             timer_info["pause_time"] = None
             timer_info["status"] = "running"
+            self.state_version += 1
+            self._write_timer_journal()
+            self._schedule_expiry(project_name)
             
             # Notify callbacks
             await self._notify_timer_event("timer_resumed", timer_info)
@@ -289,6 +329,9 @@ class DeployTimer:
             timer_info = self.active_timers[project_name]
             timer_info["end_time"] += additional_seconds
             timer_info["duration_seconds"] += additional_seconds
+            self.state_version += 1
+            self._write_timer_journal()
+            self._schedule_expiry(project_name)
             
             # Notify callbacks
             await self._notify_timer_event("timer_extended", timer_info)
@@ -308,43 +351,174 @@ class DeployTimer:
     async def _timer_update_loop(self):
         """Background loop that updates timer states and sends WebSocket updates"""
         logger.info("🔄 [TIMER] Starting timer update loop...")
-        
+
+        # Schedule ticks against the monotonic clock so sleep jitter never
+        # accumulates into visible countdown drift over long sessions
+        next_tick = time.monotonic() + self.update_interval
+
         while True:
             try:
+                tick_start = time.perf_counter()
                 current_time = time.time()
-                expired_timers = []
-                
-                # Update all active timers
-                for project_name, timer_info in self.active_timers.items():
-                    if timer_info["paused"]:
-                        # Don't update paused timers
-                        continue
-                    
-                    # Calculate remaining time
-                    remaining = timer_info["end_time"] - current_time
-                    timer_info["remaining_seconds"] = max(0, remaining)
-                    
-                    # Check if timer expired
-                    if remaining <= 0 and timer_info["status"] == "running":
-                        timer_info["status"] = "expired"
-                        expired_timers.append(project_name)
-                    
-                    # Send WebSocket update
-                    await self._send_websocket_update(timer_info)
-                
-                # Handle expired timers
-                for project_name in expired_timers:
-                    await self._handle_timer_expiry(project_name)
-                
-                # Wait before next update
-                await asyncio.sleep(self.update_interval)
-                
+                tick_payloads = []
+
+                # Suspend/resume detection: a jump in the wall-vs-monotonic
+                # offset means the machine slept. Reconcile once - expiry
+                # handles are re-armed and one corrected frame goes out -
+                # rather than letting stale deadlines and jumps leak through
+                offset = current_time - time.monotonic()
+                if self._clock_offset is not None and \
+                        abs(offset - self._clock_offset) >= self.suspend_threshold:
+                    await self._reconcile_after_wake(offset - self._clock_offset)
+                    next_tick = time.monotonic() + self.update_interval
+                self._clock_offset = offset
+
+                # Expiry is scheduled via loop.call_at on absolute deadlines,
+                # so ticks only refresh displayed state. When nobody is
+                # connected to display a countdown, skip that work entirely
+                clients_connected = bool(
+                    (self.websocket_server and getattr(self.websocket_server, "clients", None))
+                    or self.websocket_clients
+                )
+
+                if clients_connected:
+                    # Update all active timers
+                    for project_name, timer_info in self.active_timers.items():
+                        if timer_info["paused"]:
+                            # Don't update paused timers
+                            continue
+
+                        # Calculate remaining time
+                        timer_info["remaining_seconds"] = max(0, timer_info["end_time"] - current_time)
+                        tick_payloads.append(self._timer_update_payload(timer_info))
+
+                # Clients interpolate the countdown locally from the
+                # authoritative end_time_epoch, so coalesced frames only need
+                # to go out as periodic drift-correction syncs. In low power
+                # even those are skipped - interpolation carries the display
+                # and expiry still fires at its absolute deadline
+                if (tick_payloads and not power_profile.low_power_active
+                        and time.monotonic() >= self._next_sync):
+                    await self._send_coalesced_update(tick_payloads)
+                    self._next_sync = time.monotonic() + self.sync_interval
+
+                # Remaining times moved, so version-gated status consumers
+                # need to see a new version (no-op when nothing is running)
+                if tick_payloads:
+                    self.state_version += 1
+                    # Only ticks that did real work are meaningful latency samples
+                    self.tick_durations.append((time.perf_counter() - tick_start) * 1000)
+
+                # Sleep until the next monotonic deadline; re-anchor if a slow
+                # tick (or expiry handling) pushed us past it. Low power
+                # stretches the cadence - the display interpolates client-side
+                interval = self.update_interval
+                if power_profile.low_power_active:
+                    interval *= power_profile.cadence_factor
+
+                sleep_for = next_tick - time.monotonic()
+                if sleep_for <= 0:
+                    next_tick = time.monotonic() + interval
+                    sleep_for = 0
+                else:
+                    next_tick += interval
+                await asyncio.sleep(sleep_for)
+
             except asyncio.CancelledError:
                 logger.info("🔄 [TIMER] Timer update loop cancelled")
                 break
             except Exception as e:
                 logger.error("❌ [TIMER] Error in timer update loop", error=str(e))
                 await asyncio.sleep(self.update_interval * 2)
+                next_tick = time.monotonic() + self.update_interval
+
+    async def _reconcile_after_wake(self, gap_seconds: float):
+        """
+        One-shot deadline reconciliation after a suspend/resume.
+
+        Timer end_times are wall-clock epochs, so remaining time is already
+        correct on wake - what's stale is every loop.call_at expiry handle
+        (the loop's monotonic clock paused with the machine). Re-arm them
+        from wall time (timers that expired during sleep fire immediately),
+        emit one corrected sync frame, and record the gap.
+        """
+        gap_seconds = round(gap_seconds, 1)
+        logger.info("🌅 [TIMER] System wake detected - reconciling timer deadlines",
+                   gap_seconds=gap_seconds, active_timers=len(self.active_timers))
+
+        for project_name in list(self.active_timers):
+            if not self.active_timers[project_name].get("paused"):
+                self._schedule_expiry(project_name)
+
+        self.suspend_gaps.append({
+            "at": datetime.now().isoformat(),
+            "gap_seconds": gap_seconds
+        })
+        self.state_version += 1
+
+        # Force the next tick's coalesced frame out immediately so clients
+        # re-anchor their interpolated countdowns to the corrected deadlines
+        self._next_sync = 0.0
+
+        if self.websocket_server:
+            try:
+                await self.websocket_server.broadcast({
+                    "type": "timer",
+                    "event": "clock_resync",
+                    "data": {
+                        "gap_seconds": gap_seconds,
+                        "active_timers": len(self.active_timers),
+                        "timestamp": datetime.now().isoformat()
+                    }
+                })
+            except Exception as e:
+                logger.warning("⚠️ [TIMER] Failed to broadcast clock resync", error=str(e))
+
+    def _schedule_expiry(self, project_name: str):
+        """Arm expiry at the timer's absolute monotonic deadline via loop.call_at"""
+        self._cancel_expiry(project_name)
+
+        timer_info = self.active_timers.get(project_name)
+        if not timer_info or timer_info.get("paused"):
+            return
+
+        try:
+            loop = asyncio.get_running_loop()
+        except RuntimeError:
+            # No loop yet (e.g. during tests) - tickless expiry needs one
+            return
+
+        deadline = loop.time() + max(0.0, timer_info["end_time"] - time.time())
+        self._expiry_handles[project_name] = loop.call_at(
+            deadline, self._on_expiry_deadline, project_name
+        )
+        logger.debug("⏲️ [TIMER] Expiry scheduled at absolute deadline",
+                    project_name=project_name,
+                    seconds_out=max(0.0, timer_info["end_time"] - time.time()))
+
+    def _cancel_expiry(self, project_name: str):
+        """Cancel a previously scheduled expiry deadline"""
+        handle = self._expiry_handles.pop(project_name, None)
+        if handle:
+            handle.cancel()
+
+    def _on_expiry_deadline(self, project_name: str):
+        """loop.call_at callback - fires exactly at the timer deadline"""
+        self._expiry_handles.pop(project_name, None)
+
+        timer_info = self.active_timers.get(project_name)
+        if not timer_info or timer_info.get("paused") or timer_info["status"] != "running":
+            return
+
+        # The deadline may have moved since scheduling (extend/resume races) -
+        # if there is still time left, re-arm instead of expiring early
+        if timer_info["end_time"] - time.time() > 0.001:
+            self._schedule_expiry(project_name)
+            return
+
+        timer_info["status"] = "expired"
+        timer_info["remaining_seconds"] = 0
+        asyncio.create_task(self._handle_timer_expiry(project_name))
 
     async def _handle_timer_expiry(self, project_name: str):
         """
@@ -375,6 +549,7 @@ class DeployTimer:
         await asyncio.sleep(5)  # Keep for 5 seconds for UI transition
         if project_name in self.active_timers:
             del self.active_timers[project_name]
+            self._write_timer_journal()
 
     async def _notify_timer_event(self, event_type: str, timer_info: Dict[str, Any]):
         """Notify all registered callbacks of timer events"""
@@ -388,27 +563,160 @@ class DeployTimer:
                 logger.error("❌ [TIMER] Error in timer callback", 
                            event_type=event_type, error=str(e))
 
-    async def _send_websocket_update(self, timer_info: Dict[str, Any]):
-        """Send timer update to all WebSocket clients"""
-        message = {
-            "type": "timer_update",
+    def _write_timer_journal(self):
+        """Persist active timer state so a backend restart can recover sessions"""
+        # Every active_timers mutation passes through here, so it doubles as
+        # the publish point for the shared-memory timer count
+        metrics_segment.set_active_timers(len(self.active_timers))
+
+        try:
+            self.journal_file.parent.mkdir(parents=True, exist_ok=True)
+            temp_file = self.journal_file.with_suffix('.tmp')
+            temp_file.write_text(json.dumps(self.active_timers, indent=2), encoding='utf-8')
+            temp_file.replace(self.journal_file)
+        except Exception as e:
+            logger.warning("⚠️ [TIMER] Failed to write timer journal", error=str(e))
+
+    async def restore_timers(self) -> int:
+        """
+        Replay the timer journal after a restart
+
+        Running timers resume against their original absolute end time (no
+        elapsed wait is lost); paused timers come back paused; anything whose
+        deadline already passed is dropped. Returns the number of timers
+        restored.
+        """
+        if not self.journal_file.exists():
+            return 0
+
+        try:
+            journaled = json.loads(self.journal_file.read_text(encoding='utf-8'))
+        except Exception as e:
+            logger.warning("⚠️ [TIMER] Failed to read timer journal", error=str(e))
+            return 0
+
+        restored = 0
+        current_time = time.time()
+
+        for project_name, timer_info in journaled.items():
+            if timer_info.get("status") not in ("running", "paused"):
+                continue
+
+            # Paused timers keep their frozen remaining time; running timers
+            # must still have wall-clock time left
+            if not timer_info.get("paused") and timer_info.get("end_time", 0) <= current_time:
+                logger.info("⏰ [TIMER] Journaled timer already expired, dropping",
+                           project_name=project_name)
+                continue
+
+            if not timer_info.get("paused"):
+                timer_info["remaining_seconds"] = max(0, timer_info["end_time"] - current_time)
+
+            self.active_timers[project_name] = timer_info
+
+            # 📊 Re-link the analytics session so completion is still recorded
+            session_id = timer_info.get("session_id")
+            if session_id:
+                self.timer_to_session_mapping[project_name] = session_id
+
+            if not timer_info.get("paused"):
+                self._schedule_expiry(project_name)
+
+            restored += 1
+            logger.info("♻️ [TIMER] Restored timer from journal",
+                       project_name=project_name,
+                       status=timer_info.get("status"),
+                       remaining_seconds=timer_info.get("remaining_seconds"))
+
+        if restored:
+            self.state_version += 1
+            self._write_timer_journal()
+
+            # Resume the update loop for the recovered timers
+            if not self.timer_update_task:
+                self.timer_update_task = task_supervisor.spawn(
+                    "timer_update_loop", self._timer_update_loop)
+
+        logger.info("✅ [TIMER] Timer journal replay complete", restored=restored)
+        return restored
+
+    def _timer_update_payload(self, timer_info: Dict[str, Any]) -> Dict[str, Any]:
+        """Build the per-timer payload shared by single and coalesced updates"""
+        return {
+            "project_name": timer_info["project_name"],
+            "status": timer_info["status"],
+            "remaining_seconds": timer_info["remaining_seconds"],
+            "total_duration": timer_info["duration_seconds"],
+            "progress_percentage": self._calculate_progress(timer_info),
+            "time_remaining_formatted": self._format_time_remaining(timer_info["remaining_seconds"]),
+            "paused": timer_info.get("paused", False),
+            "deploy_command": timer_info.get("deploy_command"),
+            # Authoritative clock data so clients can interpolate locally
+            "end_time_epoch": timer_info["end_time"],
+            "server_time_epoch": time.time(),
+            "timestamp": datetime.now().isoformat()
+        }
+
+    @staticmethod
+    def _batch_update_message(payloads: List[Dict[str, Any]]) -> Dict[str, Any]:
+        """Wire frame for a coalesced multi-timer update"""
+        return {
+            "type": "timer_batch_update",
             "data": {
-                "project_name": timer_info["project_name"],
-                "status": timer_info["status"],
-                "remaining_seconds": timer_info["remaining_seconds"],
-                "total_duration": timer_info["duration_seconds"],
-                "progress_percentage": self._calculate_progress(timer_info),
-                "time_remaining_formatted": self._format_time_remaining(timer_info["remaining_seconds"]),
-                "paused": timer_info.get("paused", False),
-                "deploy_command": timer_info.get("deploy_command"),
+                "timer_count": len(payloads),
+                "timers": payloads,
                 "timestamp": datetime.now().isoformat()
             }
         }
-        
+
+    async def _send_coalesced_update(self, payloads: List[Dict[str, Any]]):
+        """Send one multi-timer frame per tick instead of a frame per timer"""
+        if not (hasattr(self, 'websocket_server') and self.websocket_server):
+            return
+
+        try:
+            # Per-project channels: clients that subscribed to timer channels
+            # get frames holding only the timers they display; everyone else
+            # gets the full batch as before
+            groups = None
+            if hasattr(self.websocket_server, "partition_timer_audiences"):
+                groups = self.websocket_server.partition_timer_audiences(
+                    [payload["project_name"] for payload in payloads])
+
+            if groups is None:
+                await self.websocket_server.broadcast(self._batch_update_message(payloads))
+                return
+
+            for clients, visible in groups:
+                subset = [p for p in payloads if p["project_name"] in visible]
+                if subset:
+                    await self.websocket_server.broadcast(
+                        self._batch_update_message(subset), clients=clients)
+        except Exception as e:
+            logger.warning("⚠️ [TIMER] Failed to broadcast coalesced timer update", error=str(e))
+
+    async def _send_websocket_update(self, timer_info: Dict[str, Any]):
+        """Send timer update to the clients displaying this timer"""
+        message = {
+            "type": "timer_update",
+            "data": self._timer_update_payload(timer_info)
+        }
+
         # Use WebSocket server broadcast if available, otherwise send to individual clients
         if hasattr(self, 'websocket_server') and self.websocket_server:
             try:
-                await self.websocket_server.broadcast(message)
+                # Per-project channels: None means no client opted in and the
+                # frame goes to everyone; an empty audience means nobody is
+                # displaying this timer and the frame is skipped entirely
+                audience = None
+                if hasattr(self.websocket_server, "timer_update_audience"):
+                    audience = self.websocket_server.timer_update_audience(
+                        timer_info["project_name"])
+                if audience is not None and not audience:
+                    logger.debug("📡 [TIMER] No subscribers for timer update",
+                                project_name=timer_info["project_name"])
+                    return
+                await self.websocket_server.broadcast(message, clients=audience)
                 return
             except Exception as e:
                 logger.warning("⚠️ [TIMER] Failed to broadcast timer update via server", error=str(e))
@@ -473,7 +781,10 @@ class DeployTimer:
             "time_remaining_formatted": self._format_time_remaining(timer_info["remaining_seconds"]),
             "deploy_command": timer_info.get("deploy_command"),
             "paused": timer_info.get("paused", False),
-            "created_at": timer_info["created_at"]
+            "created_at": timer_info["created_at"],
+            # Authoritative clock data so clients can interpolate locally
+            "end_time_epoch": timer_info["end_time"],
+            "server_time_epoch": time.time()
         }
 
     def get_all_timers_status(self) -> Dict[str, Any]:
@@ -505,9 +816,13 @@ class DeployTimer:
                 pass
             self.timer_update_task = None
         
+        # Cancel any remaining expiry deadlines
+        for project_name in list(self._expiry_handles.keys()):
+            self._cancel_expiry(project_name)
+
         # Clear WebSocket clients
         self.websocket_clients.clear()
-        
+
         logger.info("✅ [TIMER] Timer cleanup completed")
 
     # 📊 PHASE 2: NEW ANALYTICS INTEGRATION METHODS
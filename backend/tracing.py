@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+End-to-End Latency Tracing for DeployBot
+
+Answers "why did that notification take 4 seconds" by carrying stage
+timestamps through the deploy pipeline and aggregating per-stage deltas:
+
+    wrapper_write  - the timestamp the wrapper put in the event line
+    parsed         - monitor turned the line into an event
+    dispatched     - graph.on_deploy_detected picked it up
+    notification_sent - NotificationManager pushed it to the frontend
+    displayed      - the notification window acknowledged rendering
+
+Traces are keyed by project (rapid deploys on one project coalesce into
+one notification, so one open trace per project mirrors the pipeline).
+A trace is finalized when its notification is displayed, or lazily when
+the next deploy on the same project opens a new one.
+"""
+
+import time
+from collections import deque
+from typing import Dict, Any, Optional
+
+import structlog
+
+logger = structlog.get_logger()
+
+# Pipeline stages in order; deltas are aggregated between adjacent stages
+# that are both present in a finalized trace
+TRACE_STAGES = ["wrapper_write", "parsed", "dispatched", "notification_sent", "displayed"]
+
+
+class LatencyTracer:
+    """Aggregates per-stage latency across deploy-to-notification traces"""
+
+    def __init__(self):
+        self._open_traces = {}  # project_name -> {stage: epoch seconds}
+        self._notification_projects = {}  # notification_id -> project_name
+        self._stage_samples = {}  # "stage_a -> stage_b" -> deque of ms deltas
+        self._end_to_end_samples = deque(maxlen=200)
+        self._completed_traces = 0
+
+        logger.info("⏱️ [TRACING] LatencyTracer initialized")
+
+    def start_trace(self, project_name: str, wrapper_write_ts: float,
+                    parsed_ts: Optional[float] = None):
+        """Open a trace for a deploy event (finalizing any previous one)"""
+        previous = self._open_traces.pop(project_name, None)
+        if previous:
+            self._finalize(previous)
+
+        trace = {"wrapper_write": wrapper_write_ts,
+                 "parsed": parsed_ts if parsed_ts is not None else time.time()}
+        self._open_traces[project_name] = trace
+
+    def record_stage(self, project_name: str, stage: str,
+                     timestamp: Optional[float] = None):
+        """Attach a stage timestamp to the project's open trace"""
+        trace = self._open_traces.get(project_name)
+        if trace is None or stage in trace:
+            return
+        trace[stage] = timestamp if timestamp is not None else time.time()
+
+    def bind_notification(self, notification_id: str, project_name: str):
+        """Associate a sent notification with the project's open trace"""
+        if project_name in self._open_traces:
+            self._notification_projects[notification_id] = project_name
+
+            # Bound the mapping - stale ids mean the display ack never came
+            if len(self._notification_projects) > 64:
+                for stale_id in list(self._notification_projects)[:32]:
+                    del self._notification_projects[stale_id]
+
+    def record_display(self, notification_id: str,
+                       displayed_ts: Optional[float] = None) -> bool:
+        """Record the frontend display ack and finalize the trace"""
+        project_name = self._notification_projects.pop(notification_id, None)
+        if project_name is None:
+            return False
+
+        trace = self._open_traces.pop(project_name, None)
+        if trace is None:
+            return False
+
+        trace["displayed"] = displayed_ts if displayed_ts is not None else time.time()
+        self._finalize(trace)
+        return True
+
+    def _finalize(self, trace: Dict[str, float]):
+        """Fold a trace's adjacent-stage deltas into the rolling samples"""
+        recorded = [(stage, trace[stage]) for stage in TRACE_STAGES if stage in trace]
+        if len(recorded) < 2:
+            return
+
+        for (stage_a, ts_a), (stage_b, ts_b) in zip(recorded, recorded[1:]):
+            delta_ms = (ts_b - ts_a) * 1000
+            if delta_ms < 0:
+                continue  # clock skew between wrapper and backend - skip the pair
+            key = f"{stage_a} -> {stage_b}"
+            if key not in self._stage_samples:
+                self._stage_samples[key] = deque(maxlen=200)
+            self._stage_samples[key].append(delta_ms)
+
+        first_ts = recorded[0][1]
+        last_ts = recorded[-1][1]
+        if last_ts >= first_ts:
+            self._end_to_end_samples.append((last_ts - first_ts) * 1000)
+        self._completed_traces += 1
+
+    def get_stats(self, summarize) -> Dict[str, Any]:
+        """Build the per-stage breakdown using the caller's sample summarizer"""
+        return {
+            "stages": {key: summarize(samples)
+                       for key, samples in self._stage_samples.items()},
+            "end_to_end": summarize(self._end_to_end_samples),
+            "completed_traces": self._completed_traces,
+            "open_traces": len(self._open_traces)
+        }
+
+
+# Global latency tracer instance
+latency_tracer = LatencyTracer()
@@ -0,0 +1,165 @@
+/**
+ * Backend Bridge - main-process proxy for the backend host utility process
+ *
+ * Presents the same surface main.js used when PythonProcessManager lived
+ * in-process (startComplete, sendCommand, getStatus, events), but the real
+ * manager now runs in a utility process (backend_host.js). Main only sees
+ * already-parsed lifecycle events and command results as structured
+ * clones; per-frame WebSocket work never touches its event loop.
+ *
+ * Renderers get push traffic over MessagePorts wired host<->renderer via
+ * attachRenderer(), so a timer tick storm costs main nothing at all.
+ */
+const { utilityProcess, MessageChannelMain } = require('electron');
+const path = require('path');
+const { EventEmitter } = require('events');
+
+class BackendBridge extends EventEmitter {
+  constructor() {
+    super();
+
+    this.pendingRpcs = new Map(); // id -> { resolve, reject }
+    this.nextRpcId = 1;
+
+    // Status snapshot piggybacked on every host event, so getStatus()
+    // stays synchronous like the in-process manager's was
+    this.lastStatus = {
+      backend: 'stopped',
+      connection: 'disconnected',
+      lastError: null,
+      isConnected: false,
+      isHealthy: false,
+    };
+
+    console.log('🚀 [BACKEND_BRIDGE] Forking backend host utility process...');
+    this.host = utilityProcess.fork(path.join(__dirname, 'backend_host.js'), [], {
+      serviceName: 'DeployBot Backend Host',
+    });
+
+    this.host.on('message', (message) => this.handleHostMessage(message));
+    this.host.on('exit', (code) => {
+      console.error(`❌ [BACKEND_BRIDGE] Backend host exited with code ${code}`);
+      this.lastStatus = { ...this.lastStatus, backend: 'stopped', connection: 'disconnected', isConnected: false, isHealthy: false };
+      for (const pending of this.pendingRpcs.values()) {
+        pending.reject(new Error('Backend host process exited'));
+      }
+      this.pendingRpcs.clear();
+      this.emit('backend-state-changed', 'stopped');
+    });
+  }
+
+  handleHostMessage(message) {
+    if (message.type === 'rpc-result' || message.type === 'rpc-error') {
+      const pending = this.pendingRpcs.get(message.id);
+      if (!pending) return;
+      this.pendingRpcs.delete(message.id);
+      if (message.type === 'rpc-result') {
+        pending.resolve(message.result);
+      } else {
+        pending.reject(new Error(message.error));
+      }
+      return;
+    }
+
+    if (message.type === 'pm-event') {
+      if (message.status) {
+        this.lastStatus = message.status;
+      }
+      // Rehydrate the Error shape startup-failed listeners expect
+      const payload = message.event === 'startup-failed' && message.payload?.message
+        ? new Error(message.payload.message)
+        : message.payload;
+      this.emit(message.event, payload);
+    }
+  }
+
+  rpc(method, args = []) {
+    return new Promise((resolve, reject) => {
+      const id = this.nextRpcId++;
+      this.pendingRpcs.set(id, { resolve, reject });
+      try {
+        this.host.postMessage({ type: 'rpc', id, method, args });
+      } catch (error) {
+        this.pendingRpcs.delete(id);
+        reject(error);
+      }
+    });
+  }
+
+  /**
+   * Wire a renderer directly to the backend host: push frames flow
+   * host -> renderer over this channel without a main-process hop
+   */
+  attachRenderer(webContents) {
+    const { port1, port2 } = new MessageChannelMain();
+    this.host.postMessage({ type: 'renderer-port' }, [port1]);
+    webContents.postMessage('backend-port', null, [port2]);
+    console.log('🔌 [BACKEND_BRIDGE] Renderer attached to backend host via MessagePort');
+  }
+
+  startComplete(isDev = false) {
+    return this.rpc('startComplete', [isDev]);
+  }
+
+  sendCommand(command, data = {}) {
+    return this.rpc('sendCommand', [command, data]);
+  }
+
+  getStatus() {
+    return this.lastStatus;
+  }
+
+  /**
+   * Stamp a startup stage the main process observed (e.g. renderer paint)
+   * into the manager's startup report. Fire and forget.
+   */
+  recordStartupMark(stage, at = Date.now()) {
+    this.rpc('recordStartupMark', [stage, at]).catch(() => {});
+  }
+
+  async getHealthReport() {
+    const report = await this.rpc('getHealthReport');
+
+    // The host reported its own process under resources.main - relabel it
+    // and add the actual main process so freezes are attributed correctly
+    if (report && report.resources) {
+      report.resources.backendHost = report.resources.main;
+      const memory = process.memoryUsage();
+      report.resources.main = {
+        pid: process.pid,
+        heapUsedMb: Math.round(memory.heapUsed / 1048576 * 10) / 10,
+        rssMb: Math.round(memory.rss / 1048576 * 10) / 10,
+      };
+      if (typeof process.getCPUUsage === 'function') {
+        report.resources.main.cpuPercent = Math.round(process.getCPUUsage().percentCPUUsage * 10) / 10;
+      }
+    }
+    return report;
+  }
+
+  async shutdown() {
+    try {
+      await this.rpc('shutdown');
+    } finally {
+      this.killHost();
+    }
+  }
+
+  async emergencyCleanup() {
+    try {
+      await this.rpc('emergencyCleanup');
+    } finally {
+      this.killHost();
+    }
+  }
+
+  killHost() {
+    try {
+      this.host.kill();
+    } catch (error) {
+      // Already exited
+    }
+  }
+}
+
+module.exports = BackendBridge;
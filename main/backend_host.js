@@ -0,0 +1,131 @@
+/**
+ * Backend Host - utility process entry point for DeployBot
+ *
+ * Runs PythonProcessManager out of the Electron main process so that JSON
+ * parsing of every backend WebSocket frame happens here instead of
+ * competing with window management and IPC dispatch on the main loop.
+ *
+ * Wiring:
+ *  - process.parentPort carries RPCs from BackendBridge (sendCommand,
+ *    startComplete, health report, shutdown) and the lifecycle events the
+ *    main process still needs (state changes, notification requests).
+ *  - Renderer MessagePorts arrive via 'renderer-port' messages; backend
+ *    push frames fan out to them directly, bypassing main entirely.
+ */
+const ProcessManager = require('./process_manager');
+
+const parentPort = process.parentPort;
+const processManager = new ProcessManager();
+
+// Renderer-facing MessagePorts for direct push delivery
+const rendererPorts = new Set();
+
+// Lifecycle events the main process consumes (window updates, topic
+// replay after reconnect, snapshot refresh). Each carries a status
+// snapshot so the bridge can answer getStatus() synchronously.
+const FORWARDED_EVENTS = [
+  'backend-state-changed',
+  'connection-state-changed',
+  'python-output',
+  'python-error',
+  'startup-complete',
+  'startup-failed',
+];
+
+function postEvent(eventName, payload) {
+  try {
+    parentPort.postMessage({
+      type: 'pm-event',
+      event: eventName,
+      payload,
+      status: processManager.getStatus(),
+    });
+  } catch (error) {
+    console.error(`❌ [BACKEND_HOST] Failed to forward event ${eventName}:`, error.message);
+  }
+}
+
+for (const eventName of FORWARDED_EVENTS) {
+  processManager.on(eventName, (payload) => {
+    // Errors aren't structured-cloneable across the port - flatten them
+    if (eventName === 'startup-failed' && payload instanceof Error) {
+      postEvent(eventName, { message: payload.message });
+      return;
+    }
+    postEvent(eventName, payload);
+  });
+}
+
+// Raw push frames fan out to renderer ports as bytes - a Buffer clones as
+// a plain memcpy, so the per-frame cost here is one copy, not a full
+// structured-clone serialization of the parsed object tree
+processManager.on('websocket-frame', (bytes) => {
+  for (const port of rendererPorts) {
+    try {
+      port.postMessage(bytes);
+    } catch (error) {
+      rendererPorts.delete(port);
+    }
+  }
+});
+
+// Frames the manager had to parse locally (responses are consumed there;
+// these are the notification/system frames) still reach renderers as
+// parsed objects; main only needs the notification frames (window
+// creation is a main-process-only capability)
+processManager.on('websocket-message', (message) => {
+  for (const port of rendererPorts) {
+    try {
+      port.postMessage(message);
+    } catch (error) {
+      rendererPorts.delete(port);
+    }
+  }
+
+  if (message.type === 'notification' && message.event === 'show_custom' && message.data?.notification) {
+    postEvent('notification-request', message);
+  }
+});
+
+// RPC surface exposed to the bridge - mirrors ProcessManager's public API
+const RPC_METHODS = {
+  startComplete: (isDev) => processManager.startComplete(isDev),
+  sendCommand: (command, data) => processManager.sendCommand(command, data),
+  getStatus: () => processManager.getStatus(),
+  getHealthReport: () => processManager.getHealthReport(),
+  recordStartupMark: (stage, at) => processManager.recordStartupMark(stage, at),
+  shutdown: () => processManager.shutdown(),
+  emergencyCleanup: () => processManager.emergencyCleanup(),
+};
+
+parentPort.on('message', async (event) => {
+  const message = event.data || {};
+
+  if (message.type === 'renderer-port') {
+    const port = event.ports && event.ports[0];
+    if (port) {
+      rendererPorts.add(port);
+      port.on('close', () => rendererPorts.delete(port));
+      port.start();
+      console.log(`🔌 [BACKEND_HOST] Renderer port attached (${rendererPorts.size} active)`);
+    }
+    return;
+  }
+
+  if (message.type === 'rpc') {
+    const method = RPC_METHODS[message.method];
+    if (!method) {
+      parentPort.postMessage({ type: 'rpc-error', id: message.id, error: `Unknown method: ${message.method}` });
+      return;
+    }
+    try {
+      const result = await method(...(message.args || []));
+      parentPort.postMessage({ type: 'rpc-result', id: message.id, result });
+    } catch (error) {
+      parentPort.postMessage({ type: 'rpc-error', id: message.id, error: error.message });
+    }
+  }
+});
+
+parentPort.start();
+console.log('🚀 [BACKEND_HOST] Backend host utility process initialized');
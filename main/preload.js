@@ -4,6 +4,68 @@ const { contextBridge, ipcRenderer } = require('electron');
 // the ipcRenderer without exposing the entire object
 console.log('🔗 [PRELOAD] Setting up secure context bridge...');
 
+// Backend push frames arrive over a MessagePort wired directly to the
+// backend host utility process; main-process system events (connection
+// state, startup progress) still come over the 'backend-update' IPC
+// channel. Both transports feed one listener set so consumers don't care
+// which path a message took.
+const backendUpdateListeners = new Set();
+
+// Hidden-window idle throttling: a hidden window has nothing to paint, so
+// push delivery is suspended and the backend-side topic subscriptions are
+// parked (the ref-counted 'topic-unsubscribe' stops the backend from even
+// serializing frames for us). On show, every parked subscription is
+// re-registered and one resync pass fires so components reload fresh data
+// instead of having polled the whole time they were invisible.
+let windowHidden = false;
+const activeTopicSubscriptions = new Set(); // one topic array per events.on call
+const resyncListeners = new Set();
+
+function dispatchBackendUpdate(message) {
+  if (windowHidden) {
+    return;
+  }
+  for (const listener of backendUpdateListeners) {
+    try {
+      listener(message);
+    } catch (error) {
+      console.error('❌ [PRELOAD] Backend update listener failed:', error);
+    }
+  }
+}
+
+function handleVisibilityChange() {
+  const hidden = document.visibilityState === 'hidden';
+  if (hidden === windowHidden) {
+    return;
+  }
+  windowHidden = hidden;
+
+  if (hidden) {
+    console.log('😴 [PRELOAD] Window hidden - parking backend subscriptions');
+    for (const topics of activeTopicSubscriptions) {
+      ipcRenderer.invoke('topic-unsubscribe', topics).catch(() => {});
+    }
+    return;
+  }
+
+  console.log('👁️ [PRELOAD] Window visible - restoring backend subscriptions');
+  for (const topics of activeTopicSubscriptions) {
+    ipcRenderer.invoke('topic-subscribe', topics).catch(() => {});
+  }
+  for (const listener of resyncListeners) {
+    try {
+      listener();
+    } catch (error) {
+      console.error('❌ [PRELOAD] Resync listener failed:', error);
+    }
+  }
+}
+
+if (typeof document !== 'undefined') {
+  document.addEventListener('visibilitychange', handleVisibilityChange);
+}
+
 contextBridge.exposeInMainWorld('electronAPI', {
   // Python backend communication
   python: {
@@ -198,18 +260,186 @@ contextBridge.exposeInMainWorld('electronAPI', {
       console.log('📊 [PRELOAD] Getting directory information:', directoryPath);
       return ipcRenderer.invoke('get-directory-info', directoryPath);
     },
+
+    // Streaming directory listing - first page returns immediately, the
+    // rest is paged through the scan cursor held by the main process
+    scanDirectoryStart: (directoryPath, pageSize = 100) => {
+      console.log('📂 [PRELOAD] Starting directory scan:', directoryPath);
+      return ipcRenderer.invoke('directory-scan-start', directoryPath, pageSize);
+    },
+
+    scanDirectoryNext: (scanId, pageSize = 200) => {
+      return ipcRenderer.invoke('directory-scan-next', scanId, pageSize);
+    },
+
+    scanDirectoryCancel: (scanId) => {
+      return ipcRenderer.invoke('directory-scan-cancel', scanId);
+    },
   },
 
   // Real-time WebSocket events - NEW
   events: {
+    // One-call subscription surface: register a topic-filtered listener and
+    // make sure the backend is pushing those topics. Returns an unsubscribe
+    // function, so components register once instead of polling on a timer.
+    on: (topics, callback) => {
+      console.log('📡 [PRELOAD] Registering topic subscription:', topics);
+      const topicSet = new Set(Array.isArray(topics) ? topics : [topics]);
+      const listener = (message) => {
+        if (topicSet.size === 0 || topicSet.has(message.topic) || topicSet.has(message.type)) {
+          callback(message);
+        }
+      };
+      backendUpdateListeners.add(listener);
+      const topicList = [...topicSet];
+      activeTopicSubscriptions.add(topicList);
+      // A hidden window registers locally but defers the backend-side
+      // subscribe until the show handler restores everything at once
+      if (!windowHidden) {
+        ipcRenderer.invoke('topic-subscribe', topicList).catch((error) => {
+          console.warn('⚠️ [PRELOAD] Topic subscribe failed (will rely on broadcasts):', error);
+        });
+      }
+      return () => {
+        console.log('📡 [PRELOAD] Removing topic subscription:', topics);
+        backendUpdateListeners.delete(listener);
+        activeTopicSubscriptions.delete(topicList);
+        if (!windowHidden) {
+          ipcRenderer.invoke('topic-unsubscribe', topicList).catch(() => {});
+        }
+      };
+    },
+
     onBackendUpdate: (callback) => {
       console.log('📡 [PRELOAD] Registering backend update listener');
-      ipcRenderer.on('backend-update', (_event, data) => callback(data));
+      backendUpdateListeners.add(callback);
     },
-    
+
     removeBackendUpdateListener: (callback) => {
       console.log('📡 [PRELOAD] Removing backend update listener');
-      ipcRenderer.removeListener('backend-update', callback);
+      backendUpdateListeners.delete(callback);
+    },
+
+    subscribe: (topics) => {
+      console.log('📬 [PRELOAD] Subscribing to backend topics:', topics);
+      return ipcRenderer.invoke('python-command', 'subscribe', { topics });
+    },
+
+    unsubscribe: (topics) => {
+      console.log('📭 [PRELOAD] Unsubscribing from backend topics:', topics);
+      return ipcRenderer.invoke('python-command', 'unsubscribe', { topics });
+    },
+  },
+
+  // Window visibility - NEW. Components pause their polling intervals while
+  // the window is hidden and register here for the single resync pass that
+  // fires when it comes back
+  visibility: {
+    isHidden: () => windowHidden,
+
+    onResync: (callback) => {
+      resyncListeners.add(callback);
+      return () => {
+        resyncListeners.delete(callback);
+      };
+    },
+  },
+
+  // Paginated analytics history and chart series - NEW
+  analytics: {
+    getPage: (projectName, recordType = 'sessions', cursor = null, pageSize = 50) => {
+      console.log('📄 [PRELOAD] Requesting analytics page:', { projectName, recordType, cursor });
+      return ipcRenderer.invoke('python-command', 'get-analytics-page', {
+        project_name: projectName,
+        record_type: recordType,
+        cursor,
+        page_size: pageSize,
+      });
+    },
+
+    getSeries: (projectName, metric = 'time_saved', lastNDays = 30, maxPoints = 60) => {
+      console.log('📈 [PRELOAD] Requesting analytics series:', { projectName, metric, lastNDays });
+      return ipcRenderer.invoke('python-command', 'get-analytics-series', {
+        project_name: projectName,
+        metric,
+        last_n_days: lastNDays,
+        max_points: maxPoints,
+      });
+    },
+
+    // Typed-array variant for large historical series: the backend sends
+    // parallel numeric arrays instead of per-point objects, and they cross
+    // the context bridge as two contiguous Float64Array buffers rather than
+    // one cloned object per point - no per-point GC churn renderer-side.
+    getSeriesTyped: async (projectName, metric = 'time_saved', lastNDays = 30, maxPoints = 60) => {
+      console.log('📈 [PRELOAD] Requesting typed analytics series:', { projectName, metric, lastNDays });
+      const response = await ipcRenderer.invoke('python-command', 'get-analytics-series', {
+        project_name: projectName,
+        metric,
+        last_n_days: lastNDays,
+        max_points: maxPoints,
+        packed: true,
+      });
+      const data = response?.data || response;
+      const packed = data?.packed;
+      if (!data?.success || !packed) {
+        return data;
+      }
+
+      const length = packed.bucket_indices.length;
+      const times = new Float64Array(length);   // epoch seconds per point
+      const values = new Float64Array(length);
+      for (let i = 0; i < length; i++) {
+        times[i] = packed.start_epoch + packed.bucket_indices[i] * packed.bucket_seconds;
+        values[i] = packed.values[i];
+      }
+
+      return {
+        success: true,
+        project_name: data.project_name,
+        metric: data.metric,
+        period_days: data.period_days,
+        bucket_seconds: data.bucket_seconds,
+        length,
+        times,
+        values,
+      };
+    },
+  },
+
+  // Startup snapshot cached by the main process - NEW
+  startup: {
+    getSnapshot: () => {
+      console.log('📸 [PRELOAD] Reading startup snapshot (sync)');
+      return ipcRenderer.sendSync('get-startup-snapshot');
+    },
+  },
+
+  // Performance instrumentation - NEW
+  perf: {
+    getStats: () => {
+      console.log('📈 [PRELOAD] Requesting backend performance stats');
+      return ipcRenderer.invoke('python-command', 'perf-stats', {});
+    },
+
+    profileBackendStart: (intervalMs = 10) => {
+      console.log('🔬 [PRELOAD] Starting backend statistical profiler');
+      return ipcRenderer.invoke('python-command', 'profile-start', { interval_ms: intervalMs });
+    },
+
+    profileBackendStop: () => {
+      console.log('🔬 [PRELOAD] Stopping backend profiler, fetching collapsed stacks');
+      return ipcRenderer.invoke('python-command', 'profile-stop', {});
+    },
+
+    getHealthReport: () => {
+      console.log('🩺 [PRELOAD] Requesting merged health report');
+      return ipcRenderer.invoke('health-report');
+    },
+
+    profileMain: (durationMs = 10000) => {
+      console.log('🔬 [PRELOAD] Capturing main-process CPU profile');
+      return ipcRenderer.invoke('main-profile', durationMs);
     },
   },
 
@@ -296,6 +526,35 @@ contextBridge.exposeInMainWorld('electronAPI', {
 ipcRenderer.removeAllListeners('python-output');
 ipcRenderer.removeAllListeners('python-error');
 ipcRenderer.removeAllListeners('backend-update');
+ipcRenderer.removeAllListeners('backend-port');
+
+// Main-process system events share the dispatch path with port traffic
+ipcRenderer.on('backend-update', (_event, message) => dispatchBackendUpdate(message));
+
+// The direct push channel from the backend host utility process. Most
+// frames arrive as raw bytes and are parsed here - the only parse on
+// their whole path; frames the host had to parse itself arrive as
+// already-structured objects.
+const frameDecoder = new TextDecoder();
+
+ipcRenderer.on('backend-port', (event) => {
+  const port = event.ports && event.ports[0];
+  if (!port) return;
+  console.log('🔌 [PRELOAD] Backend push port received - direct delivery active');
+  port.onmessage = (portEvent) => {
+    let message = portEvent.data;
+    if (message instanceof Uint8Array || message instanceof ArrayBuffer) {
+      try {
+        message = JSON.parse(frameDecoder.decode(message));
+      } catch (error) {
+        console.error('❌ [PRELOAD] Failed to parse raw backend frame:', error);
+        return;
+      }
+    }
+    dispatchBackendUpdate(message);
+  };
+  port.start();
+});
 
 console.log('✅ [PRELOAD] Context bridge setup complete - electronAPI exposed to renderer');
 
@@ -7,10 +7,21 @@
 
 const { spawn } = require('child_process');
 const WebSocket = require('ws');
+const net = require('net');
+const crypto = require('crypto');
 const path = require('path');
 const fs = require('fs');
+const zlib = require('zlib');
 const { EventEmitter } = require('events');
 
+// Optional msgpack wire format - negotiated with the backend, JSON fallback
+let msgpack = null;
+try {
+  msgpack = require('@msgpack/msgpack');
+} catch (error) {
+  // Module not installed - JSON-only operation
+}
+
 class ProcessManager extends EventEmitter {
   constructor() {
     super();
@@ -20,19 +31,64 @@ class ProcessManager extends EventEmitter {
     this.wsConnection = null;
     this.isShuttingDown = false;
     this.startupSequenceActive = false;
-    
+    this.wireFormat = 'json'; // 'msgpack' after successful negotiation
+    this.compressionEnabled = false; // deflate for large frames after negotiation
+    this.pendingRequests = new Map(); // messageId -> { command, resolve, reject, timeout }
+    this.immediateReconnectUsed = false; // one fast retry per socket drop
+
+    // Warm standby: a second backend pre-initialized up to (but not
+    // including) socket bind, promoted on primary failure so crash
+    // recovery skips interpreter startup and module imports
+    this.standbyProcess = null;
+    this.standbyReady = false;
+    this.backendLaunch = null; // { pythonExecutable, pythonScriptPath, workingDir } from the last start
+
+    // Main-process event-loop delay histogram, sampled by the deep health
+    // check - a frozen UI with a healthy backend points at this process
+    try {
+      const { monitorEventLoopDelay } = require('perf_hooks');
+      this.loopDelayHistogram = monitorEventLoopDelay({ resolution: 20 });
+      this.loopDelayHistogram.enable();
+    } catch (error) {
+      this.loopDelayHistogram = null;
+    }
+    this.lastResourceSample = null;
+
     // Configuration
     this.config = {
       wsPort: 8765,
       wsHost: 'localhost',
+      // Unix-domain transport skips the TCP stack and can't collide on a
+      // port (our most common startup failure); DEPLOYBOT_TCP_TRANSPORT=1
+      // forces localhost TCP for debugging
+      useUnixSocket: process.env.DEPLOYBOT_TCP_TRANSPORT !== '1',
+      socketPath: path.join(require('os').homedir(), '.deploybot', 'backend.sock'),
+      // Registry of PIDs we spawned - cleanup targets exactly these instead
+      // of discovering port holders by shelling out
+      pidRegistryPath: path.join(require('os').homedir(), '.deploybot', 'owned_pids.json'),
       maxStartupAttempts: 5,
       maxConnectionAttempts: 10,
       startupTimeout: 30000, // 30 seconds
       connectionTimeout: 10000, // 10 seconds
-      healthCheckInterval: 15000, // 15 seconds
+      livenessInterval: 5000, // 5 seconds between protocol-level ping frames
+      livenessTimeout: 1000, // 1 second to answer a ping frame before the backend is considered stalled
+      deepHealthCheckInterval: 60000, // 60 seconds between full command round trips
+      metricsFreshnessWindow: 10000, // Shared-memory heartbeat younger than this proves backend liveness
+      compressionMinBytes: 8192, // Frames above this are deflate-compressed (negotiated)
+      // Push frames travel to renderers as raw bytes and are parsed once at
+      // the destination; DEPLOYBOT_RAW_FRAMES=0 restores parse-then-clone
+      rawFrameForwarding: process.env.DEPLOYBOT_RAW_FRAMES !== '0',
+      // Startup self-benchmark: collect per-stage launch timings on both
+      // sides and emit one machine-readable report after the sequence
+      startupReport: process.env.DEPLOYBOT_STARTUP_REPORT === '1'
+        || process.argv.includes('--startup-report'),
       gracefulShutdownTimeout: 5000, // 5 seconds
+      // Quit path only: hard cap on waiting for the backend to exit after
+      // SIGTERM before SIGKILL - keeps quit-to-exit under half a second
+      shutdownDeadline: 400, // milliseconds
       backendReadyCheckInterval: 1000, // 1 second
-      maxBackendReadyWait: 20000 // 20 seconds
+      maxBackendReadyWait: 20000, // 20 seconds
+      warmStandby: process.env.DEPLOYBOT_WARM_STANDBY === '1' // opt-in warm-standby backend
     };
     
     // State tracking
@@ -46,10 +102,22 @@ class ProcessManager extends EventEmitter {
       connectedAt: null
     };
     
-    // Health monitoring
+    // Health monitoring: cheap protocol-level liveness probes plus a
+    // slower deep check that exercises command handling
+    // Startup stage marks for the self-benchmark (--startup-report);
+    // recorded unconditionally, reported only when the mode is on
+    this.startupMarks = [];
+
     this.healthCheckTimer = null;
+    this.livenessTimer = null;
+    this.pongTimeoutTimer = null;
     this.connectionTimer = null;
     this.startupTimer = null;
+
+    // Low-power profile (pushed by the backend when on battery or toggled):
+    // health-check cadences stretch by this factor while it is active
+    this.lowPowerMode = false;
+    this.lowPowerFactor = 4;
     
     console.log('🔧 [PROCESS_MANAGER] Process manager initialized');
   }
@@ -58,9 +126,141 @@ class ProcessManager extends EventEmitter {
    * Get current WebSocket URL
    */
   getWebSocketUrl() {
+    if (this.config.useUnixSocket) {
+      // ws's unix-socket URL form: socket path, then request path after ':'
+      return `ws+unix://${this.config.socketPath}:/`;
+    }
     return `ws://${this.config.wsHost}:${this.config.wsPort}`;
   }
 
+  /**
+   * Serialize an outgoing message in the negotiated wire format
+   */
+  encodeMessage(message) {
+    if (this.wireFormat === 'msgpack' && msgpack) {
+      return msgpack.encode(message);
+    }
+    return JSON.stringify(message);
+  }
+
+  /**
+   * Deserialize an incoming message (binary frames are msgpack, text is JSON)
+   */
+  decodeMessage(data, isBinary) {
+    if (isBinary) {
+      let buffer = data;
+      // Compression prefix bytes: 0x00 raw, 0x01 deflate. A bare msgpack
+      // map never starts with either, so this is unambiguous even across
+      // the negotiation boundary
+      if (buffer.length > 0 && buffer[0] === 0x01) {
+        const inflated = zlib.inflateSync(buffer.subarray(1));
+        return this.wireFormat === 'msgpack' && msgpack
+          ? msgpack.decode(inflated)
+          : JSON.parse(inflated.toString());
+      }
+      if (buffer.length > 0 && buffer[0] === 0x00) {
+        buffer = buffer.subarray(1);
+      }
+      if (msgpack) {
+        return msgpack.decode(buffer);
+      }
+    }
+    return JSON.parse(data.toString());
+  }
+
+  /**
+   * Record one named startup stage, first occurrence only - a reconnect
+   * after a drop isn't startup. `at` lets callers stamp a moment that
+   * happened before they could reach this manager (renderer paint).
+   */
+  recordStartupMark(stage, at = Date.now()) {
+    if (this.startupMarks.some((mark) => mark.stage === stage)) {
+      return;
+    }
+    this.startupMarks.push({ stage, at });
+  }
+
+  /**
+   * Assemble and emit the startup report: our stage marks merged with the
+   * backend's (interpreter boot, imports, per-module init, socket bind).
+   * Written to ~/.deploybot/diagnostics and logged as one parseable line.
+   */
+  async emitStartupReport() {
+    let backendReport = null;
+    try {
+      const response = await this.sendCommand('startup-report');
+      backendReport = (response.data && response.data.report) || null;
+    } catch (error) {
+      console.error(`❌ [PROCESS_MANAGER] Failed to fetch backend startup report: ${error.message}`);
+    }
+
+    const report = {
+      generated_at: new Date().toISOString(),
+      electron: this.startupMarks,
+      backend: backendReport,
+    };
+
+    try {
+      const dir = path.join(require('os').homedir(), '.deploybot', 'diagnostics');
+      fs.mkdirSync(dir, { recursive: true });
+      const reportPath = path.join(dir, `startup-report-${Date.now()}.json`);
+      fs.writeFileSync(reportPath, JSON.stringify(report, null, 2));
+      console.log(`📊 [PROCESS_MANAGER] Startup report written to ${reportPath}`);
+    } catch (error) {
+      console.error(`❌ [PROCESS_MANAGER] Failed to write startup report: ${error.message}`);
+    }
+
+    // One greppable line for CI and scripted launches
+    console.log(`STARTUP_REPORT ${JSON.stringify(report)}`);
+  }
+
+  /**
+   * Decide from the frame head whether this process must parse the frame
+   * itself: command responses (routed to pending requests), power-profile
+   * flips (adjust our health cadence) and custom notifications (window
+   * creation is a main-process capability). Everything else is push
+   * traffic that can travel to renderers as raw bytes. False positives
+   * just cost one local parse; the frame is still delivered correctly.
+   */
+  frameNeedsLocalParse(head) {
+    return head.includes('"response"')
+      || head.includes('power_profile_changed')
+      || head.includes('show_custom');
+  }
+
+  /**
+   * Ask the backend to switch this connection to the msgpack wire format
+   */
+  async negotiateProtocol() {
+    // Always ask for deflate on large frames; msgpack only when installed
+    const request = {
+      compression: 'deflate',
+      compression_min_bytes: this.config.compressionMinBytes
+    };
+    if (msgpack) {
+      request.format = 'msgpack';
+    } else {
+      console.log('📡 [PROCESS_MANAGER] msgpack not installed - staying on JSON wire format');
+    }
+
+    try {
+      const response = await this.sendCommand('set-protocol', request);
+      const result = response.data || {};
+      if (result.format === 'msgpack') {
+        this.wireFormat = 'msgpack';
+        console.log('🔀 [PROCESS_MANAGER] Switched WebSocket wire format to msgpack');
+      } else if (msgpack) {
+        console.log('📡 [PROCESS_MANAGER] Backend declined msgpack - staying on JSON');
+      }
+      if (result.compression === 'deflate') {
+        this.compressionEnabled = true;
+        console.log(`🗜️ [PROCESS_MANAGER] Large frames (>${this.config.compressionMinBytes}B) compressed with deflate`);
+      }
+    } catch (error) {
+      console.warn(`⚠️ [PROCESS_MANAGER] Protocol negotiation failed, staying on JSON: ${error.message}`);
+    }
+  }
+
   /**
    * Get comprehensive system status
    */
@@ -70,19 +270,132 @@ class ProcessManager extends EventEmitter {
       config: this.config,
       processId: this.pythonProcess?.pid || null,
       isConnected: this.state.connection === 'connected',
-      isHealthy: this.state.backend === 'running' && this.state.connection === 'connected'
+      isHealthy: this.state.backend === 'running' && this.state.connection === 'connected',
+      sharedMetrics: this.readMetricsSegment(),
+      resources: this.lastResourceSample
     };
   }
 
   /**
-   * Comprehensive port cleanup - kills any processes using our WebSocket port
+   * Read the registry of PIDs this app spawned (missing file = empty)
+   */
+  readOwnedPids() {
+    try {
+      const entries = JSON.parse(fs.readFileSync(this.config.pidRegistryPath, 'utf8'));
+      return Array.isArray(entries) ? entries : [];
+    } catch (error) {
+      return [];
+    }
+  }
+
+  writeOwnedPids(entries) {
+    try {
+      fs.mkdirSync(path.dirname(this.config.pidRegistryPath), { recursive: true });
+      fs.writeFileSync(this.config.pidRegistryPath, JSON.stringify(entries, null, 2));
+    } catch (error) {
+      console.warn(`⚠️ [PROCESS_MANAGER] Failed to write PID registry: ${error.message}`);
+    }
+  }
+
+  registerOwnedPid(pid, role, extra = {}) {
+    if (!pid) return;
+    const entries = this.readOwnedPids().filter(entry => entry.pid !== pid);
+    entries.push({ pid, role, started_at: new Date().toISOString(), ...extra });
+    this.writeOwnedPids(entries);
+  }
+
+  unregisterOwnedPid(pid) {
+    if (!pid) return;
+    const entries = this.readOwnedPids();
+    const remaining = entries.filter(entry => entry.pid !== pid);
+    if (remaining.length !== entries.length) {
+      this.writeOwnedPids(remaining);
+    }
+  }
+
+  /**
+   * Kill every process left in the registry (stale entries from a previous
+   * unclean exit) - these are ours by construction, so this is always safe
+   */
+  killRegisteredProcesses() {
+    const entries = this.readOwnedPids();
+    let killed = 0;
+    for (const entry of entries) {
+      try {
+        process.kill(entry.pid, 'SIGKILL');
+        console.log(`🔪 [PROCESS_MANAGER] Killed registered ${entry.role} process ${entry.pid}`);
+        killed++;
+      } catch (error) {
+        // ESRCH - already gone, which is the normal case
+      }
+    }
+    if (entries.length > 0) {
+      this.writeOwnedPids([]);
+    }
+    return killed;
+  }
+
+  /**
+   * Probe the WebSocket port with a direct TCP connect - tells us whether
+   * anything is listening without spawning a child process
+   */
+  probePort(port) {
+    return new Promise((resolve) => {
+      const socket = net.connect({ port, host: '127.0.0.1' });
+      const finish = (inUse) => {
+        socket.removeAllListeners();
+        socket.destroy();
+        resolve(inUse);
+      };
+      socket.setTimeout(500);
+      socket.once('connect', () => finish(true));
+      socket.once('timeout', () => finish(false));
+      socket.once('error', () => finish(false));
+    });
+  }
+
+  /**
+   * Port/socket cleanup before startup: reclaim from our own registered
+   * processes first, shelling out only for the genuinely-stuck case
    */
   async cleanupPort() {
+    // Leftover backends from a previous unclean exit are in the registry;
+    // terminating them directly takes milliseconds
+    this.killRegisteredProcesses();
+
+    if (this.config.useUnixSocket) {
+      // No port to fight over - just remove a stale socket file so the
+      // backend's bind never trips on a previous run
+      try {
+        fs.unlinkSync(this.config.socketPath);
+        console.log(`🧹 [PROCESS_MANAGER] Removed stale socket ${this.config.socketPath}`);
+      } catch (error) {
+        // ENOENT is the normal case
+      }
+      return true;
+    }
+
     console.log(`🧹 [PROCESS_MANAGER] Cleaning up port ${this.config.wsPort}...`);
-    
+
+    // Fast path: nothing listening means nothing to kill
+    if (!(await this.probePort(this.config.wsPort))) {
+      console.log(`✅ [PROCESS_MANAGER] Port ${this.config.wsPort} is clean`);
+      return true;
+    }
+
+    // A registered process may still be mid-exit - give it a moment
+    await new Promise(resolve => setTimeout(resolve, 250));
+    if (!(await this.probePort(this.config.wsPort))) {
+      console.log(`✅ [PROCESS_MANAGER] Port ${this.config.wsPort} reclaimed from registered processes`);
+      return true;
+    }
+
+    // Rare genuinely-stuck case: something we didn't spawn holds the port
+    console.warn(`⚠️ [PROCESS_MANAGER] Unknown process holds port ${this.config.wsPort}, falling back to lsof`);
+
     return new Promise((resolve) => {
       const { exec } = require('child_process');
-      
+
       // Use lsof to find and kill processes on our port
       exec(`lsof -ti:${this.config.wsPort}`, (error, stdout) => {
         if (error || !stdout.trim()) {
@@ -90,10 +403,10 @@ class ProcessManager extends EventEmitter {
           resolve(true);
           return;
         }
-        
+
         const pids = stdout.trim().split('\n').filter(pid => pid);
         console.log(`🔪 [PROCESS_MANAGER] Found ${pids.length} processes on port ${this.config.wsPort}: ${pids.join(', ')}`);
-        
+
         // Kill all processes on the port
         exec(`kill -9 ${pids.join(' ')}`, (killError) => {
           if (killError) {
@@ -239,22 +552,27 @@ class ProcessManager extends EventEmitter {
       if (!fs.existsSync(pythonScriptPath)) {
         throw new Error(`Python script not found: ${pythonScriptPath}`);
       }
-      
-      // Start Python process
+
+      // Remember the launch parameters so a warm standby can be spawned
+      // with the exact same configuration
+      this.backendLaunch = { pythonExecutable, pythonScriptPath, workingDir };
+
+      // Start Python process. The launch token travels in the environment
+      // and into the PID registry, so cleanup can verify a registered PID
+      // still belongs to us before signalling it.
+      const launchToken = crypto.randomBytes(16).toString('hex');
       this.pythonProcess = spawn(pythonExecutable, [pythonScriptPath], {
         cwd: workingDir,
         stdio: ['pipe', 'pipe', 'pipe'],
-        env: {
-          ...process.env,
-          PATH: '/opt/homebrew/bin:/usr/local/bin:/usr/bin:/bin',
-          PYTHONUNBUFFERED: '1', // Ensure immediate output
-          DEPLOYBOT_PROJECTS_ROOT: path.join(process.cwd(), 'projects'), // Point to real projects directory
-          PYTHON_EXECUTABLE: pythonExecutable, // Pass the Python executable to the backend
-          DEPLOYBOT_DEBUG: '1' // Enable debug mode for better logging
-        }
+        env: this.buildBackendEnv(pythonExecutable, { DEPLOYBOT_LAUNCH_TOKEN: launchToken })
       });
-      
+
       console.log(`🐍 [PROCESS_MANAGER] Python process started with PID: ${this.pythonProcess.pid}`);
+      this.recordStartupMark('backend_spawned');
+      this.registerOwnedPid(this.pythonProcess.pid, 'backend', {
+        token: launchToken,
+        command: pythonScriptPath
+      });
       this.state.startedAt = new Date().toISOString();
       
       // Set up process event handlers
@@ -267,6 +585,11 @@ class ProcessManager extends EventEmitter {
         this.state.backend = 'running';
         this.emit('backend-state-changed', this.state.backend);
         console.log('✅ [PROCESS_MANAGER] Backend started successfully');
+
+        // Keep a pre-initialized spare around for instant crash recovery
+        if (this.config.warmStandby) {
+          this.spawnStandby();
+        }
         return true;
       } else {
         throw new Error('Backend did not become ready within timeout');
@@ -288,6 +611,154 @@ class ProcessManager extends EventEmitter {
     }
   }
 
+  /**
+   * Environment for a spawned backend process
+   */
+  buildBackendEnv(pythonExecutable, extra = {}) {
+    return {
+      ...process.env,
+      PATH: '/opt/homebrew/bin:/usr/local/bin:/usr/bin:/bin',
+      PYTHONUNBUFFERED: '1', // Ensure immediate output
+      DEPLOYBOT_PROJECTS_ROOT: path.join(process.cwd(), 'projects'), // Point to real projects directory
+      PYTHON_EXECUTABLE: pythonExecutable, // Pass the Python executable to the backend
+      DEPLOYBOT_DEBUG: '1', // Enable debug mode for better logging
+      // Spawn timestamp (ms) - the backend subtracts this from its own
+      // first line to measure interpreter boot for the startup report
+      DEPLOYBOT_SPAWN_TS: String(Date.now()),
+      ...(this.config.startupReport ? { DEPLOYBOT_STARTUP_REPORT: '1' } : {}),
+      // Backend binds the unix socket when this is set, TCP otherwise
+      ...(this.config.useUnixSocket ? { DEPLOYBOT_UDS_PATH: this.config.socketPath } : {}),
+      ...extra
+    };
+  }
+
+  /**
+   * Spawn a warm-standby backend: fully imported and initialized but held
+   * before socket bind (DEPLOYBOT_STANDBY=1), so promotion only costs the
+   * bind instead of interpreter startup plus module imports
+   */
+  spawnStandby() {
+    if (!this.config.warmStandby || this.standbyProcess || this.isShuttingDown || !this.backendLaunch) {
+      return;
+    }
+
+    const { pythonExecutable, pythonScriptPath, workingDir } = this.backendLaunch;
+    console.log('🟡 [PROCESS_MANAGER] Spawning warm-standby backend...');
+
+    const launchToken = crypto.randomBytes(16).toString('hex');
+    try {
+      this.standbyProcess = spawn(pythonExecutable, [pythonScriptPath], {
+        cwd: workingDir,
+        stdio: ['pipe', 'pipe', 'pipe'],
+        env: this.buildBackendEnv(pythonExecutable, {
+          DEPLOYBOT_STANDBY: '1',
+          DEPLOYBOT_LAUNCH_TOKEN: launchToken
+        })
+      });
+    } catch (error) {
+      console.warn(`⚠️ [PROCESS_MANAGER] Failed to spawn warm standby: ${error.message}`);
+      this.standbyProcess = null;
+      return;
+    }
+
+    this.standbyReady = false;
+    this.registerOwnedPid(this.standbyProcess.pid, 'standby', {
+      token: launchToken,
+      command: pythonScriptPath
+    });
+
+    this.standbyProcess.stdout.on('data', (data) => {
+      if (data.toString().includes('STANDBY_READY')) {
+        console.log(`🟢 [PROCESS_MANAGER] Warm standby ready (PID: ${this.standbyProcess?.pid})`);
+        this.standbyReady = true;
+      }
+    });
+
+    this.standbyProcess.stderr.on('data', () => {
+      // Standby output is only interesting after promotion
+    });
+
+    const standbyPid = this.standbyProcess.pid;
+    this.standbyProcess.on('close', (code) => {
+      console.log(`🟡 [PROCESS_MANAGER] Warm standby exited with code: ${code}`);
+      this.unregisterOwnedPid(standbyPid);
+      this.standbyProcess = null;
+      this.standbyReady = false;
+
+      // Keep a spare available while the primary is healthy
+      if (!this.isShuttingDown && this.state.backend === 'running') {
+        setTimeout(() => this.spawnStandby(), 3000);
+      }
+    });
+
+    this.standbyProcess.on('error', (error) => {
+      console.warn(`⚠️ [PROCESS_MANAGER] Warm standby error: ${error.message}`);
+    });
+  }
+
+  /**
+   * Promote the warm standby to primary after a crash: hand it the (now
+   * free) port via a PROMOTE line on stdin, then reconnect. Deploy monitor
+   * offsets are persisted by the backend, so the promoted process resumes
+   * log monitoring where the crashed one left off.
+   */
+  async promoteStandby() {
+    if (!this.standbyProcess || !this.standbyReady) {
+      return false;
+    }
+
+    const standby = this.standbyProcess;
+    this.standbyProcess = null;
+    this.standbyReady = false;
+
+    // Detach standby-specific handlers before it becomes the primary
+    standby.stdout.removeAllListeners('data');
+    standby.stderr.removeAllListeners('data');
+    standby.removeAllListeners('close');
+    standby.removeAllListeners('error');
+
+    console.log(`🚀 [PROCESS_MANAGER] Promoting warm standby (PID: ${standby.pid}) to primary...`);
+
+    this.pythonProcess = standby;
+    this.state.backend = 'starting';
+    this.state.startedAt = new Date().toISOString();
+    this.emit('backend-state-changed', this.state.backend);
+    this.setupProcessHandlers();
+
+    try {
+      standby.stdin.write('PROMOTE\n');
+    } catch (error) {
+      console.error(`❌ [PROCESS_MANAGER] Failed to signal standby promotion: ${error.message}`);
+      standby.kill('SIGKILL');
+      this.pythonProcess = null;
+      this.state.backend = 'error';
+      this.emit('backend-state-changed', this.state.backend);
+      return false;
+    }
+
+    const isReady = await this.waitForBackendReady();
+    if (!isReady) {
+      console.error('❌ [PROCESS_MANAGER] Promoted standby did not become ready');
+      standby.kill('SIGKILL');
+      this.pythonProcess = null;
+      this.state.backend = 'error';
+      this.emit('backend-state-changed', this.state.backend);
+      return false;
+    }
+
+    this.state.backend = 'running';
+    this.emit('backend-state-changed', this.state.backend);
+    console.log('✅ [PROCESS_MANAGER] Warm standby promoted successfully');
+
+    // Reconnect and spin up the next spare
+    if (this.state.connection !== 'connected' && this.state.connection !== 'connecting') {
+      this.connectWebSocket();
+    }
+    this.spawnStandby();
+
+    return true;
+  }
+
   /**
    * Set up Python process event handlers
    */
@@ -309,9 +780,11 @@ class ProcessManager extends EventEmitter {
     });
     
     // Handle process exit
+    const backendPid = this.pythonProcess.pid;
     this.pythonProcess.on('close', (code, signal) => {
       console.log(`🐍 [PROCESS_MANAGER] Python process exited with code: ${code}, signal: ${signal}`);
-      
+      this.unregisterOwnedPid(backendPid);
+
       const wasRunning = this.state.backend === 'running';
       this.state.backend = 'stopped';
       this.state.startedAt = null;
@@ -321,12 +794,22 @@ class ProcessManager extends EventEmitter {
       
       // Auto-restart if it was running and we're not shutting down
       if (wasRunning && !this.isShuttingDown && code !== 0) {
-        console.log('🔄 [PROCESS_MANAGER] Backend crashed, scheduling restart...');
-        setTimeout(() => {
-          if (!this.isShuttingDown) {
-            this.startBackend();
-          }
-        }, 3000);
+        if (this.config.warmStandby && this.standbyProcess && this.standbyReady) {
+          console.log('🔄 [PROCESS_MANAGER] Backend crashed, promoting warm standby...');
+          this.promoteStandby().then((promoted) => {
+            if (!promoted && !this.isShuttingDown) {
+              console.log('🔄 [PROCESS_MANAGER] Standby promotion failed, falling back to cold restart...');
+              this.startBackend();
+            }
+          });
+        } else {
+          console.log('🔄 [PROCESS_MANAGER] Backend crashed, scheduling restart...');
+          setTimeout(() => {
+            if (!this.isShuttingDown) {
+              this.startBackend();
+            }
+          }, 3000);
+        }
       }
     });
     
@@ -371,23 +854,49 @@ class ProcessManager extends EventEmitter {
       this.wsConnection.on('open', () => {
         clearTimeout(connectionTimeout);
         console.log('✅ [PROCESS_MANAGER] WebSocket connected successfully');
-        
+        this.recordStartupMark('websocket_connected');
+
         this.state.connection = 'connected';
         this.state.connectedAt = new Date().toISOString();
         this.state.connectionAttempt = 0; // Reset attempt counter
+        this.immediateReconnectUsed = false; // Fast retry re-armed for the next drop
         
         this.emit('connection-state-changed', this.state.connection);
         this.startHealthMonitoring();
-        
-        // Send initial ping
+
+        // Send initial ping, then try to upgrade to the binary wire format
         this.sendPing();
+        this.negotiateProtocol();
       });
-      
-      // Handle incoming messages
-      this.wsConnection.on('message', (data) => {
+
+      // Handle incoming messages - responses are routed to their pending
+      // request so multiple commands can be in flight simultaneously
+      this.wsConnection.on('message', (data, isBinary) => {
         try {
-          const message = JSON.parse(data.toString());
+          // Raw passthrough: text push frames skip the local parse and go
+          // out as bytes, to be parsed once at the renderer. Binary frames
+          // (msgpack/deflate) still decode here - renderers don't carry
+          // those decoders
+          if (this.config.rawFrameForwarding && !isBinary) {
+            const head = data.toString('utf8', 0, 256);
+            if (!this.frameNeedsLocalParse(head)) {
+              this.emit('websocket-frame', data);
+              return;
+            }
+          }
+
+          const message = this.decodeMessage(data, isBinary);
           console.log('📥 [PROCESS_MANAGER] WebSocket message:', message.type || 'unknown');
+
+          if (message.type === 'response' && this.resolveResponse(message)) {
+            return;
+          }
+
+          // Backend power-profile flips stretch/restore our health cadence
+          if (message.type === 'system' && message.event === 'power_profile_changed') {
+            this.setLowPowerMode(!!(message.data && message.data.low_power));
+          }
+
           this.emit('websocket-message', message);
         } catch (error) {
           console.error('❌ [PROCESS_MANAGER] Error parsing WebSocket message:', error);
@@ -398,20 +907,36 @@ class ProcessManager extends EventEmitter {
       this.wsConnection.on('close', (code, reason) => {
         clearTimeout(connectionTimeout);
         console.log(`🔌 [PROCESS_MANAGER] WebSocket connection closed: ${code} - ${reason}`);
-        
+
+        // A drop out of an established connection (vs. a failed attempt)
+        // qualifies for the immediate-reconnect fast path
+        const wasEstablished = !!this.state.connectedAt;
+
         this.state.connection = 'disconnected';
         this.state.connectedAt = null;
         this.wsConnection = null;
-        
+        this.wireFormat = 'json'; // re-negotiated on reconnect
+        this.compressionEnabled = false;
+        this.rejectPendingRequests('WebSocket connection closed');
+
         this.emit('connection-state-changed', this.state.connection);
         this.stopHealthMonitoring();
         
         // Auto-reconnect if not shutting down
         if (!this.isShuttingDown && this.state.backend === 'running') {
-          this.scheduleReconnect();
+          this.scheduleReconnect(wasEstablished);
         }
       });
       
+      // Protocol-level pong frames answer our liveness probes without
+      // touching the backend's command handler
+      this.wsConnection.on('pong', () => {
+        if (this.pongTimeoutTimer) {
+          clearTimeout(this.pongTimeoutTimer);
+          this.pongTimeoutTimer = null;
+        }
+      });
+
       // Handle connection errors
       this.wsConnection.on('error', (error) => {
         clearTimeout(connectionTimeout);
@@ -436,7 +961,8 @@ class ProcessManager extends EventEmitter {
     this.state.connection = 'error';
     this.state.lastError = error.message;
     this.wsConnection = null;
-    
+    this.rejectPendingRequests(`WebSocket error: ${error.message}`);
+
     this.emit('connection-state-changed', this.state.connection);
     this.stopHealthMonitoring();
     
@@ -447,11 +973,47 @@ class ProcessManager extends EventEmitter {
   }
 
   /**
-   * Schedule WebSocket reconnection with exponential backoff
+   * True when the backend process itself looks alive - a live child handle
+   * or a fresh shared-memory heartbeat. Distinguishes "the socket dropped"
+   * from "the backend died".
+   */
+  isBackendProcessAlive() {
+    if (this.state.backend !== 'running') {
+      return false;
+    }
+    if (this.pythonProcess && this.pythonProcess.exitCode === null) {
+      return true;
+    }
+    const metrics = this.readMetricsSegment();
+    return !!(metrics &&
+      metrics.heartbeatAgeMs >= 0 &&
+      metrics.heartbeatAgeMs < this.config.metricsFreshnessWindow);
+  }
+
+  /**
+   * Schedule WebSocket reconnection with exponential backoff.
+   *
+   * When an established socket drops while the backend process is still
+   * alive (half-open TCP teardown, sleep/wake, a dropped unix socket), one
+   * immediate attempt runs first - those typically complete in tens of
+   * milliseconds instead of sitting out a backoff interval. If it fails,
+   * the error path re-enters here without the fast flag and the normal
+   * backoff ladder takes over.
    */
-  scheduleReconnect() {
+  scheduleReconnect(immediateEligible = false) {
+    if (immediateEligible && !this.immediateReconnectUsed && this.isBackendProcessAlive()) {
+      this.immediateReconnectUsed = true;
+      console.log('⚡ [PROCESS_MANAGER] Backend alive after socket drop - reconnecting immediately');
+      this.connectionTimer = setTimeout(() => {
+        if (!this.isShuttingDown) {
+          this.connectWebSocket();
+        }
+      }, 0);
+      return;
+    }
+
     const backoffDelay = Math.min(1000 * Math.pow(2, this.state.connectionAttempt - 1), 30000); // Max 30 seconds
-    
+
     console.log(`🔄 [PROCESS_MANAGER] Scheduling WebSocket reconnect in ${backoffDelay}ms...`);
     
     this.connectionTimer = setTimeout(() => {
@@ -467,7 +1029,7 @@ class ProcessManager extends EventEmitter {
   sendPing() {
     if (this.state.connection === 'connected' && this.wsConnection) {
       try {
-        this.wsConnection.send(JSON.stringify({
+        this.wsConnection.send(this.encodeMessage({
           command: 'ping',
           data: { timestamp: new Date().toISOString() }
         }));
@@ -479,7 +1041,49 @@ class ProcessManager extends EventEmitter {
   }
 
   /**
-   * Send command to backend via WebSocket with proper response handling
+   * Route a response message to its pending request, if any
+   */
+  resolveResponse(response) {
+    let messageId = response.messageId;
+
+    // Fallback for responses without an echoed messageId: match the oldest
+    // pending request for the same command
+    if (!messageId || !this.pendingRequests.has(messageId)) {
+      messageId = null;
+      for (const [id, pending] of this.pendingRequests) {
+        if (pending.command === response.command) {
+          messageId = id;
+          break;
+        }
+      }
+      if (!messageId) {
+        return false;
+      }
+    }
+
+    const pending = this.pendingRequests.get(messageId);
+    this.pendingRequests.delete(messageId);
+    clearTimeout(pending.timeout);
+    console.log(`📥 [PROCESS_MANAGER] Response received for ${pending.command} (messageId: ${messageId})`);
+    pending.resolve(response);
+    return true;
+  }
+
+  /**
+   * Reject all in-flight requests (connection lost or shutting down)
+   */
+  rejectPendingRequests(reason) {
+    for (const [, pending] of this.pendingRequests) {
+      clearTimeout(pending.timeout);
+      pending.reject(new Error(reason));
+    }
+    this.pendingRequests.clear();
+  }
+
+  /**
+   * Send command to backend via WebSocket with proper response handling.
+   * Requests are tracked in a pending map keyed by messageId, so multiple
+   * commands can be in flight on the single WebSocket at the same time.
    */
   async sendCommand(command, data = {}) {
     return new Promise((resolve, reject) => {
@@ -487,87 +1091,305 @@ class ProcessManager extends EventEmitter {
         reject(new Error('WebSocket not connected'));
         return;
       }
-      
+
+      const messageId = `${command}_${Date.now()}_${Math.random().toString(36).substr(2, 9)}`;
+      const message = {
+        command,
+        data,
+        messageId,
+        timestamp: new Date().toISOString()
+      };
+
+      const timeout = setTimeout(() => {
+        this.pendingRequests.delete(messageId);
+        reject(new Error(`Command ${command} timed out after 10 seconds`));
+      }, 10000);
+
+      this.pendingRequests.set(messageId, { command, resolve, reject, timeout });
+
       try {
-        const messageId = `${command}_${Date.now()}_${Math.random().toString(36).substr(2, 9)}`;
-        const message = {
-          command,
-          data,
-          messageId,
-          timestamp: new Date().toISOString()
-        };
-        
-        // Set up response listener with timeout
-        const timeout = setTimeout(() => {
-          this.wsConnection.removeListener('message', responseListener);
-          reject(new Error(`Command ${command} timed out after 10 seconds`));
-        }, 10000);
-        
-        const responseListener = (data) => {
-          try {
-            const response = JSON.parse(data.toString());
-            // Check if this is the response to our command
-            if (response.messageId === messageId || (response.command === command && response.type === 'response')) {
-              clearTimeout(timeout);
-              this.wsConnection.removeListener('message', responseListener);
-              console.log(`📥 [PROCESS_MANAGER] Response received for ${command}:`, JSON.stringify(response, null, 2));
-              resolve(response);
-            }
-          } catch (error) {
-            console.error('❌ [PROCESS_MANAGER] Error parsing response:', error);
-          }
-        };
-        
-        this.wsConnection.on('message', responseListener);
-        
-        this.wsConnection.send(JSON.stringify(message));
+        this.wsConnection.send(this.encodeMessage(message));
         console.log(`📤 [PROCESS_MANAGER] Command sent: ${command} (messageId: ${messageId})`);
-        
       } catch (error) {
         console.error(`❌ [PROCESS_MANAGER] Failed to send command ${command}:`, error);
+        clearTimeout(timeout);
+        this.pendingRequests.delete(messageId);
         reject(error);
       }
     });
   }
 
+  /**
+   * Send several commands in a single round trip via the backend's batch
+   * envelope - e.g. the startup sequence (status + project list + analytics)
+   */
+  async sendBatch(commands) {
+    const response = await this.sendCommand('batch', { commands });
+    return (response.data && response.data.results) || [];
+  }
+
   /**
    * Start health monitoring for active connections
+   *
+   * Two cadences: a cheap WebSocket protocol-level ping every few seconds
+   * (answered by the socket layer, so a stalled event loop is detected in
+   * about a second without competing with real commands) and a deep check
+   * on a much slower cadence that exercises actual command handling.
    */
   startHealthMonitoring() {
-    if (this.healthCheckTimer) {
+    if (this.healthCheckTimer || this.livenessTimer) {
       console.log('⚠️ [PROCESS_MANAGER] Health monitoring already active');
       return;
     }
-    
+
     console.log('❤️ [PROCESS_MANAGER] Starting health monitoring...');
-    
-    // MEMORY LEAK FIX: Increased interval from 15 seconds to 30 seconds to reduce load
+
+    this.livenessTimer = setInterval(() => {
+      this.performLivenessProbe();
+    }, this.config.livenessInterval);
+
     this.healthCheckTimer = setInterval(() => {
       this.performHealthCheck();
-    }, 30000); // Check every 30 seconds instead of 15
+    }, this.config.deepHealthCheckInterval);
+  }
+
+  /**
+   * Stretch or restore health-check cadences when the backend's low-power
+   * profile flips. Liveness stays protocol-level pings - just rarer - so
+   * crash detection still works on battery, only slower.
+   */
+  setLowPowerMode(enabled) {
+    enabled = !!enabled;
+    if (this.lowPowerMode === enabled) {
+      return;
+    }
+    this.lowPowerMode = enabled;
+
+    if (this.baseLivenessInterval === undefined) {
+      this.baseLivenessInterval = this.config.livenessInterval;
+      this.baseDeepHealthCheckInterval = this.config.deepHealthCheckInterval;
+    }
+
+    const factor = enabled ? this.lowPowerFactor : 1;
+    this.config.livenessInterval = this.baseLivenessInterval * factor;
+    this.config.deepHealthCheckInterval = this.baseDeepHealthCheckInterval * factor;
+
+    console.log(`🔋 [PROCESS_MANAGER] Low-power mode ${enabled ? 'enabled' : 'disabled'} - liveness every ${this.config.livenessInterval}ms`);
+
+    // Re-arm the timers at the new cadence if monitoring is active
+    if (this.healthCheckTimer || this.livenessTimer) {
+      this.stopHealthMonitoring();
+      this.startHealthMonitoring();
+    }
   }
 
   /**
    * Stop health monitoring
    */
   stopHealthMonitoring() {
-    if (this.healthCheckTimer) {
+    if (this.healthCheckTimer || this.livenessTimer) {
       console.log('🧹 [PROCESS_MANAGER] Stopping health monitoring...');
+    }
+    if (this.healthCheckTimer) {
       clearInterval(this.healthCheckTimer);
       this.healthCheckTimer = null;
     }
+    if (this.livenessTimer) {
+      clearInterval(this.livenessTimer);
+      this.livenessTimer = null;
+    }
+    if (this.pongTimeoutTimer) {
+      clearTimeout(this.pongTimeoutTimer);
+      this.pongTimeoutTimer = null;
+    }
+  }
+
+  /**
+   * Send a protocol-level ping frame and require a pong within the
+   * liveness timeout - no backend command handling involved
+   */
+  performLivenessProbe() {
+    if (!this.wsConnection || this.wsConnection.readyState !== WebSocket.OPEN) {
+      console.log('💔 [PROCESS_MANAGER] Liveness probe failed - no active connection');
+      this.handleConnectionError(new Error('Connection lost during liveness probe'));
+      return;
+    }
+
+    // Previous probe still unanswered - don't stack timeouts
+    if (this.pongTimeoutTimer) {
+      return;
+    }
+
+    try {
+      this.pongTimeoutTimer = setTimeout(() => {
+        this.pongTimeoutTimer = null;
+        console.error(`💔 [PROCESS_MANAGER] Backend stalled - no pong within ${this.config.livenessTimeout}ms`);
+        try {
+          this.wsConnection?.terminate();
+        } catch (terminateError) {
+          // Socket already gone
+        }
+        this.handleConnectionError(new Error(`No pong within ${this.config.livenessTimeout}ms`));
+      }, this.config.livenessTimeout);
+
+      this.wsConnection.ping();
+    } catch (error) {
+      if (this.pongTimeoutTimer) {
+        clearTimeout(this.pongTimeoutTimer);
+        this.pongTimeoutTimer = null;
+      }
+      console.error('❌ [PROCESS_MANAGER] Liveness probe failed:', error.message);
+      this.handleConnectionError(error);
+    }
   }
 
   /**
    * Perform health check on active connections
    */
+  /**
+   * Read the backend's shared-memory metrics segment
+   * (~/.deploybot/metrics.mmap, written by backend/metrics.py).
+   *
+   * Layout is little-endian: magic u32, generation u32, heartbeat f64,
+   * active timer count u32, writer pid u32, last event sequence u64, and a
+   * generation copy that must match for the read to be considered clean.
+   * Returns null when the segment is missing, unwritten, or torn - callers
+   * fall back to the WebSocket paths.
+   */
+  readMetricsSegment() {
+    try {
+      const segmentPath = path.join(require('os').homedir(), '.deploybot', 'metrics.mmap');
+      const buffer = Buffer.alloc(64);
+      const fd = fs.openSync(segmentPath, 'r');
+      try {
+        fs.readSync(fd, buffer, 0, 64, 0);
+      } finally {
+        fs.closeSync(fd);
+      }
+
+      if (buffer.readUInt32LE(0) !== 0x44424d31) {
+        return null; // Wrong magic - not our segment
+      }
+      const generation = buffer.readUInt32LE(4);
+      if (generation === 0 || generation !== buffer.readUInt32LE(32)) {
+        return null; // Unwritten or caught mid-write
+      }
+
+      return {
+        heartbeatAgeMs: Date.now() - buffer.readDoubleLE(8) * 1000,
+        activeTimers: buffer.readUInt32LE(16),
+        writerPid: buffer.readUInt32LE(20),
+        lastEventSeq: Number(buffer.readBigUInt64LE(24))
+      };
+    } catch (error) {
+      return null; // Segment not available - WebSocket paths still work
+    }
+  }
+
+  /**
+   * Sample CPU, heap, and event-loop delay for the main process plus
+   * per-process CPU/memory for every Electron process (renderers, GPU)
+   */
+  sampleResourceMetrics() {
+    const memory = process.memoryUsage();
+    const main = {
+      pid: process.pid,
+      heapUsedMb: Math.round(memory.heapUsed / 1048576 * 10) / 10,
+      rssMb: Math.round(memory.rss / 1048576 * 10) / 10
+    };
+
+    // Electron-only APIs, guarded so the module still loads under plain node
+    if (typeof process.getCPUUsage === 'function') {
+      main.cpuPercent = Math.round(process.getCPUUsage().percentCPUUsage * 10) / 10;
+    }
+    if (this.loopDelayHistogram) {
+      main.eventLoopDelayMs = {
+        mean: Math.round(this.loopDelayHistogram.mean / 1e6 * 100) / 100,
+        max: Math.round(this.loopDelayHistogram.max / 1e6 * 100) / 100
+      };
+      this.loopDelayHistogram.reset();
+    }
+
+    let processes = null;
+    try {
+      const { app } = require('electron');
+      processes = app.getAppMetrics().map(metric => ({
+        type: metric.type,
+        pid: metric.pid,
+        cpuPercent: Math.round(metric.cpu.percentCPUUsage * 10) / 10,
+        workingSetMb: metric.memory ? Math.round(metric.memory.workingSetSize / 1024) : null
+      }));
+    } catch (error) {
+      // Not running under Electron - main-process numbers above still apply
+    }
+
+    return { main, processes };
+  }
+
+  /**
+   * One merged health report: per-process resource usage, the shared
+   * metrics segment, and the backend's own perf-stats - so a frozen UI
+   * can be attributed to the renderer, main, or Python side
+   */
+  async getHealthReport() {
+    const report = {
+      timestamp: new Date().toISOString(),
+      state: { ...this.state },
+      isHealthy: this.state.backend === 'running' && this.state.connection === 'connected',
+      resources: this.sampleResourceMetrics(),
+      sharedMetrics: this.readMetricsSegment(),
+      backendPerf: null
+    };
+
+    if (this.state.connection === 'connected') {
+      try {
+        const response = await this.sendCommand('perf-stats', {});
+        report.backendPerf = response?.data || response || null;
+      } catch (error) {
+        report.backendPerf = { error: error.message };
+      }
+    }
+
+    return report;
+  }
+
   async performHealthCheck() {
+    // Resource snapshot on every deep check - catches a busy main process
+    // or renderer even when the backend heartbeat looks fine
+    const resources = this.sampleResourceMetrics();
+    this.lastResourceSample = resources;
+    const loopDelay = resources.main.eventLoopDelayMs;
+    if (loopDelay && loopDelay.max > 200) {
+      console.warn(`⚠️ [PROCESS_MANAGER] Main-process event loop delayed up to ${loopDelay.max}ms since last check`);
+    }
+
     if (!this.wsConnection || this.wsConnection.readyState !== WebSocket.OPEN) {
       console.log('💔 [PROCESS_MANAGER] Health check failed - no active connection');
       this.handleConnectionError(new Error('Connection lost during health check'));
       return;
     }
 
+    // Shared-memory fast path: a fresh monitor heartbeat from our backend
+    // process proves the event loop is alive, so the deep check can skip
+    // the WebSocket round trip and leave the socket free for real commands
+    const metrics = this.readMetricsSegment();
+    if (metrics &&
+        metrics.writerPid === this.pythonProcess?.pid &&
+        metrics.heartbeatAgeMs >= 0 &&
+        metrics.heartbeatAgeMs < this.config.metricsFreshnessWindow) {
+      console.log(`💗 [PROCESS_MANAGER] Health confirmed via metrics segment (heartbeat ${Math.round(metrics.heartbeatAgeMs)}ms old, timers: ${metrics.activeTimers})`);
+      return;
+    }
+
+    // Priority lanes, send side: the health ping is telemetry. If command
+    // frames are still in flight (or draining into the socket), their
+    // responses will prove liveness - skip the probe rather than queueing
+    // bytes ahead of the next interactive command.
+    if (this.pendingRequests.size > 0 || this.wsConnection.bufferedAmount > 0) {
+      console.log('💗 [PROCESS_MANAGER] Commands in flight - deferring health ping to their responses');
+      return;
+    }
+
     try {
       // CRITICAL FIX: Use same format as sendPing() - backend expects 'command' not 'type'
       const healthCheck = {
@@ -579,7 +1401,7 @@ class ProcessManager extends EventEmitter {
       };
       
       console.log('💗 [PROCESS_MANAGER] Sending health check ping...');
-      this.wsConnection.send(JSON.stringify(healthCheck));
+      this.wsConnection.send(this.encodeMessage(healthCheck));
       
       // Note: Pong response is handled in the message handler
     } catch (error) {
@@ -616,7 +1438,15 @@ class ProcessManager extends EventEmitter {
       }
       
       console.log('✅ [PROCESS_MANAGER] Complete startup sequence successful');
+      this.recordStartupMark('startup_sequence_complete');
       this.emit('startup-complete', this.getStatus());
+
+      if (this.config.startupReport) {
+        // Fire and forget - the report must never delay startup completion
+        this.emitStartupReport().catch((error) => {
+          console.error(`❌ [PROCESS_MANAGER] Startup report failed: ${error.message}`);
+        });
+      }
       return true;
       
     } catch (error) {
@@ -666,36 +1496,58 @@ class ProcessManager extends EventEmitter {
       this.wsConnection = null;
     }
     
-    // Shutdown Python process
-    if (this.pythonProcess) {
-      console.log(`🐍 [PROCESS_MANAGER] Shutting down Python process (PID: ${this.pythonProcess.pid})...`);
-      
+    // Shutdown warm standby (never bound the port, so SIGTERM is enough)
+    if (this.standbyProcess) {
+      console.log(`🟡 [PROCESS_MANAGER] Shutting down warm standby (PID: ${this.standbyProcess.pid})...`);
       try {
-        // First try graceful shutdown
-        this.pythonProcess.kill('SIGTERM');
-        
-        // Wait for graceful shutdown or force kill
+        this.standbyProcess.kill('SIGTERM');
+      } catch (error) {
+        console.warn('⚠️ [PROCESS_MANAGER] Warning shutting down warm standby:', error.message);
+      }
+      this.standbyProcess = null;
+      this.standbyReady = false;
+    }
+
+    // Shutdown Python process under a bounded wait. SIGTERM triggers the
+    // backend's own deadline-bounded cleanup; a backend that hasn't exited
+    // by our deadline gets SIGKILLed - its state is journaled as it runs,
+    // so the hard kill loses nothing
+    if (this.pythonProcess) {
+      const proc = this.pythonProcess;
+      this.pythonProcess = null;
+      console.log(`🐍 [PROCESS_MANAGER] Shutting down Python process (PID: ${proc.pid})...`);
+
+      await new Promise((resolve) => {
         const forceKillTimer = setTimeout(() => {
-          if (this.pythonProcess && !this.pythonProcess.killed) {
-            console.log('🔪 [PROCESS_MANAGER] Force killing Python process...');
-            this.pythonProcess.kill('SIGKILL');
+          if (proc.exitCode === null && !proc.killed) {
+            console.log('🔪 [PROCESS_MANAGER] Shutdown deadline passed, force killing Python process...');
+            try {
+              proc.kill('SIGKILL');
+            } catch (error) {
+              // Process raced us to exit - nothing to do
+            }
           }
-        }, this.config.gracefulShutdownTimeout);
-        
-        // Clear timer if process exits gracefully
-        this.pythonProcess.on('close', () => {
+          resolve();
+        }, this.config.shutdownDeadline);
+
+        proc.once('close', () => {
           clearTimeout(forceKillTimer);
+          resolve();
         });
-        
-      } catch (error) {
-        console.error('❌ [PROCESS_MANAGER] Error shutting down Python process:', error);
-      }
-      
-      this.pythonProcess = null;
+
+        try {
+          proc.kill('SIGTERM');
+        } catch (error) {
+          console.error('❌ [PROCESS_MANAGER] Error shutting down Python process:', error);
+          clearTimeout(forceKillTimer);
+          resolve();
+        }
+      });
     }
-    
-    // Final port cleanup
-    await this.cleanupPort();
+
+    // Quit-path port cleanup: the PID registry covers every process we
+    // spawned, so skip the probe/sleep/lsof walk the startup path needs
+    this.killRegisteredProcesses();
     
     // Reset state
     this.state.backend = 'stopped';
@@ -722,7 +1574,18 @@ class ProcessManager extends EventEmitter {
       }
       this.pythonProcess = null;
     }
-    
+
+    // Force kill warm standby
+    if (this.standbyProcess) {
+      try {
+        this.standbyProcess.kill('SIGKILL');
+      } catch (error) {
+        console.warn('⚠️ [PROCESS_MANAGER] Warning during emergency standby cleanup:', error.message);
+      }
+      this.standbyProcess = null;
+      this.standbyReady = false;
+    }
+
     // Force close WebSocket
     if (this.wsConnection) {
       try {
@@ -738,6 +1601,8 @@ class ProcessManager extends EventEmitter {
     
     // Clear all timers
     if (this.healthCheckTimer) clearInterval(this.healthCheckTimer);
+    if (this.livenessTimer) clearInterval(this.livenessTimer);
+    if (this.pongTimeoutTimer) clearTimeout(this.pongTimeoutTimer);
     if (this.connectionTimer) clearTimeout(this.connectionTimer);
     if (this.startupTimer) clearTimeout(this.startupTimer);
     
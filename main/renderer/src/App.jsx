@@ -1,4 +1,4 @@
-import React, { useState, useEffect, useCallback } from 'react'
+import React, { useState, useEffect, useCallback, lazy, Suspense, Profiler } from 'react'
 
 // Import all functional components
 import ProjectSelector from './components/ProjectSelector'
@@ -6,8 +6,22 @@ import TaskList from './components/TaskList'
 import DeployStatus from './components/DeployStatus'
 import TimerDisplay from './components/TimerDisplay'
 import ActivityLog from './components/ActivityLog'
-import TestPythonConnection from './components/TestPythonConnection'
-import Analytics from './components/Analytics'
+import PerfStats from './components/PerfStats'
+import PerfOverlay from './components/PerfOverlay'
+import { startInteraction, recordCommit } from './perf'
+import { connectStore, setSlice } from './store'
+
+// 📊 Code-split: the Analytics chart code stays out of the initial bundle
+// and only loads when the panel is first opened (or prefetched on idle)
+const loadAnalytics = () => import('./components/Analytics')
+const Analytics = lazy(loadAnalytics)
+
+// 🧪 Dev-only debug surface: the condition is statically replaced at build
+// time, so production bundles drop both the component chunk and its mount -
+// the backend connection tester never ships or runs outside development
+const TestPythonConnection = import.meta.env.DEV
+  ? lazy(() => import('./components/TestPythonConnection'))
+  : null
 
 function App() {
   console.log('🚀 [APP] DeployBot App component starting...')
@@ -34,26 +48,89 @@ function App() {
     )
   }
 
-  // Main application state
+  // Startup snapshot cached by the main process from the previous run -
+  // lets the UI paint populated immediately and reconcile against live
+  // data once the backend is up
+  const [startupSnapshot] = useState(() => {
+    try {
+      const snapshot = window.electronAPI?.startup?.getSnapshot() || null
+      console.log('📸 [APP] Startup snapshot:', snapshot ? `${snapshot.projects?.length || 0} projects` : 'none')
+      return snapshot
+    } catch (error) {
+      console.warn('⚠️ [APP] Failed to read startup snapshot:', error)
+      return null
+    }
+  })
+
+  // Main application state. Timer and deploy-status data live in the
+  // store now (per-slice subscriptions), so a countdown sync re-renders
+  // DeployStatus alone instead of this whole tree.
   const [selectedProject, setSelectedProject] = useState(null)
-  const [deployStatus, setDeployStatus] = useState('idle')
-  const [timerData, setTimerData] = useState(null)
   const [isBackendConnected, setIsBackendConnected] = useState(false)
   const [backendStatus, setBackendStatus] = useState('disconnected')
   const [appError, setAppError] = useState(null)
-  const [isLoading, setIsLoading] = useState(true)
+  // Skip the loading screen entirely when a snapshot is available
+  const [isLoading, setIsLoading] = useState(!startupSnapshot)
   
   // 📊 PHASE 2: Analytics dashboard navigation state
   const [activeView, setActiveView] = useState('tasks') // 'tasks' or 'analytics'
 
-  console.log('🔄 [APP] Current state:', { 
-    selectedProject: selectedProject?.name, 
-    deployStatus, 
-    isBackendConnected, 
+  // 📐 Opt-in performance overlay (Ctrl/Cmd+Shift+P), persisted across runs
+  const [showPerfOverlay, setShowPerfOverlay] = useState(
+    () => localStorage.getItem('deploybot-perf-overlay') === '1'
+  )
+
+  console.log('🔄 [APP] Current state:', {
+    selectedProject: selectedProject?.name,
+    isBackendConnected,
     backendStatus,
     activeView  // 📊 PHASE 2: Include analytics view state
   })
 
+  // Wire backend push topics into the store slices once on mount
+  useEffect(() => {
+    connectStore()
+  }, [])
+
+  // 📐 Toggle the performance overlay with Ctrl/Cmd+Shift+P
+  useEffect(() => {
+    const handleKeyDown = (event) => {
+      if ((event.ctrlKey || event.metaKey) && event.shiftKey && event.key.toLowerCase() === 'p') {
+        event.preventDefault()
+        setShowPerfOverlay((current) => {
+          const next = !current
+          localStorage.setItem('deploybot-perf-overlay', next ? '1' : '0')
+          console.log('📐 [APP] Performance overlay', next ? 'enabled' : 'disabled')
+          return next
+        })
+      }
+    }
+    window.addEventListener('keydown', handleKeyDown)
+    return () => window.removeEventListener('keydown', handleKeyDown)
+  }, [])
+
+  // 📐 React commit durations feed the overlay and resolve pending
+  // interaction latency measurements
+  const handleProfilerRender = useCallback((id, phase, actualDuration) => {
+    recordCommit(actualDuration)
+  }, [])
+
+  // 📊 Prefetch the Analytics chunk once the window goes idle, so the first
+  // click on the tab doesn't pay for the dynamic import
+  useEffect(() => {
+    const idleId = window.requestIdleCallback
+      ? window.requestIdleCallback(() => loadAnalytics(), { timeout: 10000 })
+      : setTimeout(loadAnalytics, 5000)
+
+    return () => {
+      if (window.requestIdleCallback) {
+        window.cancelIdleCallback(idleId)
+      } else {
+        clearTimeout(idleId)
+      }
+    }
+  }, [])
+
   // Connection monitoring - MEMORY LEAK FIX: Reduced frequency and better cleanup
   useEffect(() => {
     console.log('🔗 [APP] Setting up connection monitoring...')
@@ -83,6 +160,13 @@ function App() {
           return isConnectedNow
         })
 
+        // Mirror into the connection slice for components that aren't
+        // in this prop chain
+        setSlice('connection', {
+          isConnected: isConnectedNow,
+          status: isConnectedNow ? 'connected' : 'disconnected'
+        })
+
         // Set loading to false after first successful check (regardless of result)
         setIsLoading(false)
 
@@ -92,6 +176,7 @@ function App() {
         console.error('❌ [APP] Connection check failed:', error)
         setIsBackendConnected(false)
         setBackendStatus('error')
+        setSlice('connection', { isConnected: false, status: 'error' })
         setIsLoading(false)  // Always set loading to false even on error
         setAppError(`Connection failed: ${error.message}`)
       }
@@ -100,8 +185,15 @@ function App() {
     // Initial connection check
     checkConnection()
 
-    // Set up periodic connection monitoring with MUCH longer interval
-    connectionCheckInterval = setInterval(checkConnection, 10000) // Check every 10 seconds
+    // Set up periodic connection monitoring with MUCH longer interval,
+    // idle while the window is hidden - the resync pass on show runs a
+    // fresh check immediately instead
+    connectionCheckInterval = setInterval(() => {
+      if (!window.electronAPI?.visibility?.isHidden()) {
+        checkConnection()
+      }
+    }, 10000) // Check every 10 seconds
+    const removeResync = window.electronAPI?.visibility?.onResync(checkConnection)
 
     return () => {
       console.log('🧹 [APP] Cleaning up connection monitoring...')
@@ -109,81 +201,20 @@ function App() {
       if (connectionCheckInterval) {
         clearInterval(connectionCheckInterval)
       }
-    }
-  }, [])  // Empty dependency array - run once on mount only
-
-  // Deploy status monitoring - MEMORY LEAK FIX: Reduced frequency and better cleanup
-  useEffect(() => {
-    console.log('📦 [APP] Setting up deploy status monitoring...')
-    
-    if (!isBackendConnected || !selectedProject) {
-      console.log('📦 [APP] Skipping deploy monitoring - no backend or project')
-      return
-    }
-
-    let deployCheckInterval = null
-
-    const checkDeployStatus = async () => {
-      try {
-        console.log('📦 [APP] Checking deploy status for project:', selectedProject.name)
-        
-        const response = await window.electronAPI?.deploy.status(selectedProject.path)
-        console.log('📦 [APP] Deploy status response:', JSON.stringify(response, null, 2))
-        
-        // Handle WebSocket response structure
-        const data = response?.data || response
-        
-        if (data && data.success) {
-          // Check if monitoring is active and if our project is being monitored
-          const isMonitoring = data.monitoring_active || false
-          const monitoredProjects = data.monitored_projects || []
-          const isProjectMonitored = monitoredProjects.some(p => 
-            p.name === selectedProject.name || p.path === selectedProject.path
-          )
-          
-          // Set status based on monitoring state
-          const newStatus = isMonitoring && isProjectMonitored ? 'monitoring' : 'idle'
-          setDeployStatus(newStatus)
-        }
-      } catch (error) {
-        console.error('❌ [APP] Failed to check deploy status:', error)
-        // Don't update status on error to avoid flickering
-      }
-    }
-
-    // Initial check
-    checkDeployStatus()
-    
-    // MEMORY LEAK FIX: Reduced from 3 seconds to 5 seconds to reduce load
-    deployCheckInterval = setInterval(checkDeployStatus, 5000)
-
-    return () => {
-      console.log('🧹 [APP] Cleaning up deploy status monitoring...')
-      if (deployCheckInterval) {
-        clearInterval(deployCheckInterval)
-        deployCheckInterval = null
+      if (removeResync) {
+        removeResync()
       }
     }
-  }, [isBackendConnected, selectedProject?.path]) // Removed deployStatus from dependencies
+  }, [])  // Empty dependency array - run once on mount only
 
-  // Handle project selection
+  // Handle project selection. Deploy status seeding/derivation moved into
+  // DeployStatus, which subscribes to the 'status' slice itself.
   const handleProjectSelect = (project) => {
     console.log('📁 [APP] Project selected:', project?.name || 'none')
+    startInteraction('project-switch') // 📐 click-to-update latency
     setSelectedProject(project)
-    
-    // Reset deploy status when changing projects
-    if (project) {
-      setDeployStatus('idle')
-      console.log('📁 [APP] Reset deploy status to idle for new project')
-    }
   }
 
-  // Handle timer updates from TimerDisplay - memoized to prevent infinite re-renders
-  const handleTimerUpdate = useCallback((newTimerData) => {
-    console.log('⏰ [APP] Timer update received:', newTimerData?.isActive ? 'active' : 'inactive')
-    setTimerData(newTimerData)
-  }, []) // Empty dependency array since setTimerData is stable
-
   // 📊 PHASE 2: Handle view navigation
   const handleViewChange = (view) => {
     console.log('📊 [APP] Switching to view:', view)
@@ -243,6 +274,7 @@ function App() {
   }
 
   return (
+    <Profiler id="app" onRender={handleProfilerRender}>
     <div className="min-h-screen bg-gradient-to-br from-blue-50 to-indigo-100 dark:from-gray-900 dark:to-gray-800">
       {/* Header */}
       <header className="bg-white dark:bg-gray-800 border-b border-gray-200 dark:border-gray-700 shadow-sm">
@@ -275,10 +307,23 @@ function App() {
                 >
                   📊 Analytics
                 </button>
+                <button
+                  onClick={() => handleViewChange('perf')}
+                  className={`px-3 py-1 text-sm font-medium rounded-md transition-colors ${
+                    activeView === 'perf'
+                      ? 'bg-white dark:bg-gray-600 text-gray-900 dark:text-white shadow-sm'
+                      : 'text-gray-600 dark:text-gray-300 hover:text-gray-900 dark:hover:text-white'
+                  }`}
+                >
+                  📈 Perf
+                </button>
               </div>
               
-              {/* Deploy Status */}
-              <DeployStatus status={deployStatus} timerData={timerData} />
+              {/* Deploy Status - reads timer/status slices from the store */}
+              <DeployStatus
+                selectedProject={selectedProject}
+                isBackendConnected={isBackendConnected}
+              />
             </div>
             
             <div className="flex items-center space-x-4">
@@ -320,23 +365,25 @@ function App() {
           {/* Left Sidebar - Project Selection & Timer */}
           <div className="lg:col-span-3 space-y-6">
             {/* Project Selector */}
-            <ProjectSelector 
+            <ProjectSelector
               selectedProject={selectedProject}
               onProjectSelect={handleProjectSelect}
               isBackendConnected={isBackendConnected}
               backendStatus={backendStatus}
+              initialProjects={startupSnapshot?.projects}
             />
             
-            {/* Timer Display */}
-            <TimerDisplay 
-              selectedProject={selectedProject}
-              onTimerUpdate={handleTimerUpdate}
-            />
+            {/* Timer Display - publishes syncs to the 'timer' slice */}
+            <TimerDisplay selectedProject={selectedProject} />
             
-            {/* Backend Connection Test */}
-            <div style={{ display: 'none' }}>
-              <TestPythonConnection />
-            </div>
+            {/* Backend Connection Test (development builds only) */}
+            {TestPythonConnection && (
+              <div style={{ display: 'none' }}>
+                <Suspense fallback={null}>
+                  <TestPythonConnection />
+                </Suspense>
+              </div>
+            )}
           </div>
 
           {/* Center - Dynamic Content Based on Active View */}
@@ -347,7 +394,13 @@ function App() {
             )}
             
             {activeView === 'analytics' && (
-              <Analytics selectedProject={selectedProject} />
+              <Suspense fallback={<div className="card p-6 text-gray-500">Loading analytics...</div>}>
+                <Analytics selectedProject={selectedProject} />
+              </Suspense>
+            )}
+
+            {activeView === 'perf' && (
+              <PerfStats />
             )}
           </div>
 
@@ -377,7 +430,11 @@ function App() {
           </div>
         </div>
       </footer>
+
+      {/* 📐 Opt-in performance readout */}
+      {showPerfOverlay && <PerfOverlay />}
     </div>
+    </Profiler>
   )
 }
 
@@ -17,6 +17,13 @@ const NotificationApp = () => {
       console.log('🔔 [NOTIFICATION_APP] Received notification data:', notificationData);
       setNotification(notificationData);
       setIsReady(true);
+
+      // Display ack for latency tracing - fire and forget
+      window.electronAPI?.notificationAction(notificationData.id, 'displayed', {
+        displayed_at: Date.now()
+      })?.catch?.((error) => {
+        console.warn('🔔 [NOTIFICATION_APP] Display ack failed:', error);
+      });
     };
 
     // Register IPC listener
@@ -35,14 +42,21 @@ const NotificationApp = () => {
   const handleNotificationAction = async (action, data = {}) => {
     console.log('🔔 [NOTIFICATION_APP] Handling action:', action, data);
 
+    // 📐 Measure click-to-acknowledge latency - the piece of task-accept
+    // time that backend pipeline traces can't see
+    const actionStarted = performance.now();
+
     try {
       // Send action to main process
       const response = await window.electronAPI?.notificationAction(
-        notification.id, 
-        action, 
+        notification.id,
+        action,
         data
       );
-      
+
+      const latencyMs = Math.round(performance.now() - actionStarted);
+      console.log(`📐 [NOTIFICATION_APP] Action '${action}' acknowledged in ${latencyMs}ms`);
+
       console.log('🔔 [NOTIFICATION_APP] Action response:', response);
       
       // Close window after action (main process will handle this)
@@ -5,6 +5,16 @@ let globalActivityManager = null
 let globalActivities = []
 let globalListeners = []
 
+// Keep a longer history now that the list is virtualized - rendering cost
+// no longer scales with history length
+const MAX_ACTIVITIES = 500
+
+// Virtualization: estimated collapsed row height and rows rendered beyond
+// the viewport on each side
+const ROW_HEIGHT = 92
+const OVERSCAN = 5
+const VIEWPORT_HEIGHT = 384 // matches max-h-96
+
 // Generate UUID for unique activity IDs
 function generateUUID() {
   return 'xxxx-xxxx-4xxx-yxxx-xxxx'.replace(/[xy]/g, function(c) {
@@ -14,41 +24,158 @@ function generateUUID() {
   })
 }
 
+// Get activity icon based on type and event
+function getActivityIcon(activity) {
+  switch (activity.type) {
+    case 'deploy':
+      switch (activity.event) {
+        case 'detected': return '🚀'
+        case 'started': return '⏳'
+        case 'completed': return '✅'
+        case 'failed': return '❌'
+        default: return '📦'
+      }
+    case 'timer':
+      switch (activity.event) {
+        case 'started': return '⏰'
+        case 'stopped': return '⏹️'
+        case 'completed': return '⏰'
+        default: return '⏱️'
+      }
+    case 'task':
+      switch (activity.event) {
+        case 'selected': return '🎯'
+        case 'suggested': return '💡'
+        case 'opened': return '📱'
+        default: return '📝'
+      }
+    case 'project':
+      switch (activity.event) {
+        case 'created': return '📁'
+        case 'loaded': return '📂'
+        case 'deleted': return '🗑️'
+        default: return '📁'
+      }
+    case 'monitoring':
+      switch (activity.event) {
+        case 'started': return '👁️'
+        case 'stopped': return '💤'
+        default: return '📊'
+      }
+    case 'system':
+      return '⚙️'
+    case 'error':
+      return '❌'
+    case 'warning':
+      return '⚠️'
+    default:
+      return '📋'
+  }
+}
+
+// Format timestamp for display
+function formatTimestamp(timestamp) {
+  const date = new Date(timestamp)
+  const now = new Date()
+  const diffMs = now - date
+  const diffMins = Math.floor(diffMs / 60000)
+  const diffHours = Math.floor(diffMins / 60)
+
+  if (diffMins < 1) return 'Just now'
+  if (diffMins < 60) return `${diffMins}m ago`
+  if (diffHours < 24) return `${diffHours}h ago`
+  return date.toLocaleDateString()
+}
+
+// Memoized row - activities are immutable once added, so appending new
+// entries doesn't re-render the existing ones
+const ActivityRow = React.memo(function ActivityRow({ activity }) {
+  return (
+    <div className="p-4 hover:bg-gray-50 transition-colors">
+      <div className="flex items-start justify-between">
+        <div className="flex-1">
+          <div className="flex items-center space-x-2">
+            <span className="text-lg">
+              {getActivityIcon(activity)}
+            </span>
+
+            <span className={`inline-flex items-center px-2 py-1 rounded-full text-xs font-medium ${
+              activity.type === 'deploy' ? 'bg-blue-100 text-blue-800' :
+              activity.type === 'timer' ? 'bg-yellow-100 text-yellow-800' :
+              activity.type === 'task' ? 'bg-green-100 text-green-800' :
+              activity.type === 'system' ? 'bg-gray-100 text-gray-800' :
+              'bg-purple-100 text-purple-800'
+            }`}>
+              {activity.type}
+            </span>
+
+            {activity.project && activity.project !== 'Global' && (
+              <span className="text-xs text-gray-500 bg-gray-100 px-2 py-1 rounded">
+                {activity.project}
+              </span>
+            )}
+          </div>
+
+          <p className="mt-1 text-sm text-gray-900">{activity.message}</p>
+
+          {activity.data && Object.keys(activity.data).length > 0 && (
+            <details className="mt-2">
+              <summary className="text-xs text-gray-500 cursor-pointer hover:text-gray-700">
+                View details
+              </summary>
+              <pre className="mt-1 text-xs text-gray-600 bg-gray-50 p-2 rounded overflow-x-auto">
+                {JSON.stringify(activity.data, null, 2)}
+              </pre>
+            </details>
+          )}
+        </div>
+
+        <div className="text-xs text-gray-500 ml-4 flex-shrink-0">
+          {formatTimestamp(activity.timestamp)}
+        </div>
+      </div>
+    </div>
+  )
+})
+
 function ActivityLog({ project }) {
   const [activities, setActivities] = useState([])
   const [isConnected, setIsConnected] = useState(false)
   const [filter, setFilter] = useState('all')
+  const [scrollTop, setScrollTop] = useState(0)
 
   console.log('📋 [ACTIVITY_LOG] Component rendering for project:', project?.name || 'all')
 
   // Global activity manager setup - FIXED: Add proper cleanup
   useEffect(() => {
     console.log('📋 [ACTIVITY_LOG] Setting up global activity manager...')
-    
+
     // Create global activity manager if it doesn't exist
     if (!globalActivityManager) {
       console.log('📋 [ACTIVITY_LOG] Creating new global activity manager')
-      
+
       globalActivityManager = {
         addActivity: (activity) => {
           console.log('📋 [ACTIVITY_LOG] Adding global activity:', activity.message)
-          globalActivities = [activity, ...globalActivities.slice(0, 49)] // Keep max 50
+          // Append to the front; existing activity objects are reused so
+          // memoized rows don't re-render
+          globalActivities = [activity, ...globalActivities.slice(0, MAX_ACTIVITIES - 1)]
           // Notify all listeners
           globalListeners.forEach(listener => {
             try {
-              listener([...globalActivities])
+              listener(globalActivities)
             } catch (error) {
               console.error('📋 [ACTIVITY_LOG] Error notifying listener:', error)
             }
           })
         },
-        
+
         registerListener: (listener) => {
           console.log('📋 [ACTIVITY_LOG] Registering new listener')
           globalListeners.push(listener)
           // Send current activities to new listener
-          listener([...globalActivities])
-          
+          listener(globalActivities)
+
           return () => {
             console.log('📋 [ACTIVITY_LOG] Unregistering listener')
             const index = globalListeners.indexOf(listener)
@@ -57,13 +184,13 @@ function ActivityLog({ project }) {
             }
           }
         },
-        
+
         handleBackendUpdate: (data) => {
           console.log('📋 [ACTIVITY_LOG] Backend update received:', data)
-          
+
           // Convert backend update to activity format
           let activity = null
-          
+
           if (data.type === 'deploy_detected') {
             activity = {
               id: `deploy-${generateUUID()}`,
@@ -96,13 +223,13 @@ function ActivityLog({ project }) {
               event: data.event
             }
           }
-          
+
           if (activity) {
             globalActivityManager.addActivity(activity)
           }
         }
       }
-      
+
       // Set up WebSocket listener (only once globally)
       if (window.electronAPI?.events?.onBackendUpdate) {
         console.log('📋 [ACTIVITY_LOG] Setting up global WebSocket listener')
@@ -110,7 +237,7 @@ function ActivityLog({ project }) {
       } else {
         console.error('❌ [ACTIVITY_LOG] electronAPI.events.onBackendUpdate not available')
       }
-      
+
       // Add initial activity
       globalActivityManager.addActivity({
         id: `startup-${generateUUID()}`,
@@ -121,10 +248,10 @@ function ActivityLog({ project }) {
         project: 'System'
       })
     }
-    
+
     // Register this component as a listener
     const unregister = globalActivityManager.registerListener(setActivities)
-    
+
     // MEMORY LEAK FIX: Proper cleanup function
     return () => {
       console.log('🧹 [ACTIVITY_LOG] Component unmounting - cleaning up listeners')
@@ -133,89 +260,38 @@ function ActivityLog({ project }) {
       }
     }
   }, []) // Empty dependency array - run only once
-  
+
   // Connection status monitoring - REMOVED: Let App.jsx handle connection monitoring
   // to prevent redundant checks that cause project list refreshing
   useEffect(() => {
     console.log('📋 [ACTIVITY_LOG] Skipping redundant connection monitoring - App.jsx handles this')
-    
+
     // Just set initial connected state without polling
     setIsConnected(true) // Assume connected until we know otherwise
   }, [])
 
-  // Get activity icon based on type and event
-  const getActivityIcon = (activity) => {
-    switch (activity.type) {
-      case 'deploy':
-        switch (activity.event) {
-          case 'detected': return '🚀'
-          case 'started': return '⏳'
-          case 'completed': return '✅'
-          case 'failed': return '❌'
-          default: return '📦'
-        }
-      case 'timer':
-        switch (activity.event) {
-          case 'started': return '⏰'
-          case 'stopped': return '⏹️'
-          case 'completed': return '⏰'
-          default: return '⏱️'
-        }
-      case 'task':
-        switch (activity.event) {
-          case 'selected': return '🎯'
-          case 'suggested': return '💡'
-          case 'opened': return '📱'
-          default: return '📝'
-        }
-      case 'project':
-        switch (activity.event) {
-          case 'created': return '📁'
-          case 'loaded': return '📂'
-          case 'deleted': return '🗑️'
-          default: return '📁'
-        }
-      case 'monitoring':
-        switch (activity.event) {
-          case 'started': return '👁️'
-          case 'stopped': return '💤'
-          default: return '📊'
-        }
-      case 'system':
-        return '⚙️'
-      case 'error':
-        return '❌'
-      case 'warning':
-        return '⚠️'
-      default:
-        return '📋'
-    }
-  }
-
   // Filter activities based on selected filter
   const filteredActivities = activities.filter(activity => {
     if (filter === 'all') return true
     return activity.type === filter
   })
 
-  // Format timestamp for display
-  const formatTimestamp = (timestamp) => {
-    const date = new Date(timestamp)
-    const now = new Date()
-    const diffMs = now - date
-    const diffMins = Math.floor(diffMs / 60000)
-    const diffHours = Math.floor(diffMins / 60)
-    
-    if (diffMins < 1) return 'Just now'
-    if (diffMins < 60) return `${diffMins}m ago`
-    if (diffHours < 24) return `${diffHours}h ago`
-    return date.toLocaleDateString()
-  }
-
   // Get unique activity types for filter options
   const availableTypes = [...new Set(activities.map(a => a.type))]
 
-  console.log('📋 [ACTIVITY_LOG] Rendering with', activities.length, 'activities')
+  // Windowed rendering: only mount the rows near the viewport plus spacers
+  // sized for the rest, so long histories don't grow the DOM
+  const startIndex = Math.max(0, Math.floor(scrollTop / ROW_HEIGHT) - OVERSCAN)
+  const endIndex = Math.min(
+    filteredActivities.length,
+    Math.ceil((scrollTop + VIEWPORT_HEIGHT) / ROW_HEIGHT) + OVERSCAN
+  )
+  const visibleActivities = filteredActivities.slice(startIndex, endIndex)
+  const topSpacer = startIndex * ROW_HEIGHT
+  const bottomSpacer = (filteredActivities.length - endIndex) * ROW_HEIGHT
+
+  console.log('📋 [ACTIVITY_LOG] Rendering with', activities.length, 'activities,',
+    visibleActivities.length, 'in window')
 
   return (
     <div className="bg-white rounded-lg shadow-sm border border-gray-200">
@@ -225,7 +301,7 @@ function ActivityLog({ project }) {
           <span className="text-sm text-gray-500">
             {filteredActivities.length} activities
           </span>
-          
+
           {/* Filter dropdown */}
           {availableTypes.length > 1 && (
             <select
@@ -241,7 +317,7 @@ function ActivityLog({ project }) {
               ))}
             </select>
           )}
-          
+
           <div className="flex items-center space-x-2">
             <div className={`w-2 h-2 rounded-full ${isConnected ? 'bg-green-500' : 'bg-red-500'}`}></div>
             <span className="text-sm text-gray-500">
@@ -250,60 +326,22 @@ function ActivityLog({ project }) {
           </div>
         </div>
       </div>
-      
-      <div className="max-h-96 overflow-y-auto">
+
+      <div
+        className="max-h-96 overflow-y-auto"
+        onScroll={(e) => setScrollTop(e.currentTarget.scrollTop)}
+      >
         {filteredActivities.length === 0 ? (
           <div className="p-6 text-center text-gray-500">
             <p>No activities yet. Deploy something to see activity!</p>
           </div>
         ) : (
           <div className="divide-y divide-gray-100">
-            {filteredActivities.map((activity) => (
-              <div key={activity.id} className="p-4 hover:bg-gray-50 transition-colors">
-                <div className="flex items-start justify-between">
-                  <div className="flex-1">
-                    <div className="flex items-center space-x-2">
-                      <span className="text-lg">
-                        {getActivityIcon(activity)}
-                      </span>
-                      
-                      <span className={`inline-flex items-center px-2 py-1 rounded-full text-xs font-medium ${
-                        activity.type === 'deploy' ? 'bg-blue-100 text-blue-800' :
-                        activity.type === 'timer' ? 'bg-yellow-100 text-yellow-800' :
-                        activity.type === 'task' ? 'bg-green-100 text-green-800' :
-                        activity.type === 'system' ? 'bg-gray-100 text-gray-800' :
-                        'bg-purple-100 text-purple-800'
-                      }`}>
-                        {activity.type}
-                      </span>
-                      
-                      {activity.project && activity.project !== 'Global' && (
-                        <span className="text-xs text-gray-500 bg-gray-100 px-2 py-1 rounded">
-                          {activity.project}
-                        </span>
-                      )}
-                    </div>
-                    
-                    <p className="mt-1 text-sm text-gray-900">{activity.message}</p>
-                    
-                    {activity.data && Object.keys(activity.data).length > 0 && (
-                      <details className="mt-2">
-                        <summary className="text-xs text-gray-500 cursor-pointer hover:text-gray-700">
-                          View details
-                        </summary>
-                        <pre className="mt-1 text-xs text-gray-600 bg-gray-50 p-2 rounded overflow-x-auto">
-                          {JSON.stringify(activity.data, null, 2)}
-                        </pre>
-                      </details>
-                    )}
-                  </div>
-                  
-                  <div className="text-xs text-gray-500 ml-4 flex-shrink-0">
-                    {formatTimestamp(activity.timestamp)}
-                  </div>
-                </div>
-              </div>
+            {topSpacer > 0 && <div style={{ height: topSpacer }} />}
+            {visibleActivities.map((activity) => (
+              <ActivityRow key={activity.id} activity={activity} />
             ))}
+            {bottomSpacer > 0 && <div style={{ height: bottomSpacer }} />}
           </div>
         )}
       </div>
@@ -311,4 +349,4 @@ function ActivityLog({ project }) {
   )
 }
 
-export default ActivityLog 
\ No newline at end of file
+export default ActivityLog
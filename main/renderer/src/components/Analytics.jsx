@@ -1,4 +1,4 @@
-import React, { useState, useEffect } from 'react'
+import React, { useState, useEffect, useRef } from 'react'
 
 /**
  * Analytics Dashboard Component
@@ -26,6 +26,39 @@ const Analytics = ({ selectedProject }) => {
   const [taskAnalytics, setTaskAnalytics] = useState(null)
   const [currentSession, setCurrentSession] = useState(null)
   const [refreshTrigger, setRefreshTrigger] = useState(0)
+  const [derivedSeries, setDerivedSeries] = useState(null)
+
+  // Web Worker that turns raw session pages into chart series off the main
+  // thread, so a year of data never blocks interaction
+  const workerRef = useRef(null)
+  const workerRequestsRef = useRef({ nextId: 1, pending: new Map() })
+
+  useEffect(() => {
+    try {
+      workerRef.current = new Worker(
+        new URL('../workers/analyticsWorker.js', import.meta.url),
+        { type: 'module' }
+      )
+      workerRef.current.onmessage = (event) => {
+        const { requestId, ...series } = event.data || {}
+        const resolve = workerRequestsRef.current.pending.get(requestId)
+        if (resolve) {
+          workerRequestsRef.current.pending.delete(requestId)
+          resolve(series)
+        }
+      }
+    } catch (workerError) {
+      console.warn('⚠️ [ANALYTICS] Analytics worker unavailable:', workerError)
+      workerRef.current = null
+    }
+
+    return () => {
+      if (workerRef.current) {
+        workerRef.current.terminate()
+        workerRef.current = null
+      }
+    }
+  }, [])
 
   console.log('📊 [ANALYTICS] Current state:', { 
     activeTab, 
@@ -50,12 +83,22 @@ const Analytics = ({ selectedProject }) => {
   useEffect(() => {
     if (selectedProject) {
       loadCurrentSession()
-      
-      // Set up periodic refresh for current session
-      const sessionInterval = setInterval(loadCurrentSession, 10000) // Every 10 seconds
-      
+
+      // Set up periodic refresh for current session - suspended entirely
+      // while the window is hidden, with one full reload on show so the
+      // charts catch up in a single pass
+      const sessionInterval = setInterval(() => {
+        if (!window.electronAPI?.visibility?.isHidden()) {
+          loadCurrentSession()
+        }
+      }, 10000) // Every 10 seconds
+      const removeResync = window.electronAPI?.visibility?.onResync(loadAllAnalytics)
+
       return () => {
         clearInterval(sessionInterval)
+        if (removeResync) {
+          removeResync()
+        }
       }
     }
   }, [selectedProject])
@@ -74,7 +117,8 @@ const Analytics = ({ selectedProject }) => {
         loadProductivityOverview(),
         loadDeployAnalytics(),
         loadTaskAnalytics(),
-        loadCurrentSession()
+        loadCurrentSession(),
+        loadDerivedSeries()
       ])
       
       console.log('✅ [ANALYTICS] All analytics data loaded successfully')
@@ -194,6 +238,56 @@ const Analytics = ({ selectedProject }) => {
     }
   }
 
+  /**
+   * Load derived chart series via the analytics worker
+   *
+   * Pages raw session records through the paginated analytics API, streams
+   * each page into the worker, and awaits the computed series - the main
+   * thread never touches the per-session math.
+   */
+  const loadDerivedSeries = async () => {
+    const worker = workerRef.current
+    if (!worker) {
+      console.log('📊 [ANALYTICS] No worker available, skipping derived series')
+      return
+    }
+
+    try {
+      console.log('📊 [ANALYTICS] Computing derived series in worker...')
+      worker.postMessage({ type: 'reset' })
+
+      // Stream pages into the worker; cap pages so a pathological history
+      // still terminates quickly
+      let cursor = null
+      for (let pageNum = 0; pageNum < 20; pageNum++) {
+        const response = await window.electronAPI?.analytics.getPage(
+          selectedProject.name, 'sessions', cursor, 200
+        )
+        const data = response?.data || response
+        if (!data?.success || !Array.isArray(data.records) || data.records.length === 0) {
+          break
+        }
+
+        worker.postMessage({ type: 'addSessions', sessions: data.records })
+
+        cursor = data.next_cursor
+        if (!cursor) break
+      }
+
+      const requestId = workerRequestsRef.current.nextId++
+      const series = await new Promise((resolve) => {
+        workerRequestsRef.current.pending.set(requestId, resolve)
+        worker.postMessage({ type: 'finalize', requestId, lastNDays: dateRange })
+      })
+
+      setDerivedSeries(series)
+      console.log('✅ [ANALYTICS] Derived series computed:', series.totals)
+    } catch (error) {
+      console.warn('⚠️ [ANALYTICS] Failed to compute derived series:', error)
+      // Don't throw - charts degrade gracefully without the worker output
+    }
+  }
+
   /**
    * Clear all analytics data
    */
@@ -202,6 +296,7 @@ const Analytics = ({ selectedProject }) => {
     setDeployAnalytics(null)
     setTaskAnalytics(null)
     setCurrentSession(null)
+    setDerivedSeries(null)
   }
 
   /**
@@ -395,15 +490,17 @@ const Analytics = ({ selectedProject }) => {
             )}
             
             {activeTab === 'tasks' && (
-              <TaskAnalytics 
+              <TaskAnalytics
                 taskAnalytics={taskAnalytics}
+                derivedSeries={derivedSeries}
                 dateRange={dateRange}
               />
             )}
-            
+
             {activeTab === 'patterns' && (
-              <DeployPatterns 
+              <DeployPatterns
                 deployAnalytics={deployAnalytics}
+                derivedSeries={derivedSeries}
                 dateRange={dateRange}
                 formatDuration={formatDuration}
                 formatPercentage={formatPercentage}
@@ -700,11 +797,39 @@ const DeployAnalytics = ({ deployAnalytics, currentSession, dateRange, formatDur
 /**
  * Task Analytics Tab Component  
  */
-const TaskAnalytics = ({ taskAnalytics, dateRange }) => {
-  console.log('🎯 [TASK_ANALYTICS] Rendering with data:', !!taskAnalytics)
+const TaskAnalytics = ({ taskAnalytics, derivedSeries, dateRange }) => {
+  console.log('🎯 [TASK_ANALYTICS] Rendering with data:', !!taskAnalytics, 'series:', !!derivedSeries)
 
   return (
     <div className="space-y-6">
+      {/* Worker-computed acceptance summary */}
+      {derivedSeries?.totals && derivedSeries.totals.tasksSuggested > 0 && (
+        <div className="bg-white dark:bg-gray-800 p-6 rounded-lg border border-gray-200 dark:border-gray-700">
+          <h3 className="text-lg font-semibold text-gray-900 dark:text-white mb-4">
+            🎯 Suggestion Acceptance ({dateRange} days)
+          </h3>
+
+          <div className="grid grid-cols-1 md:grid-cols-3 gap-4">
+            <div className="text-center">
+              <p className="text-2xl font-bold text-blue-600">{derivedSeries.totals.tasksSuggested}</p>
+              <p className="text-sm text-gray-600 dark:text-gray-400">Tasks Suggested</p>
+            </div>
+
+            <div className="text-center">
+              <p className="text-2xl font-bold text-green-600">{derivedSeries.totals.tasksAccepted}</p>
+              <p className="text-sm text-gray-600 dark:text-gray-400">Tasks Accepted</p>
+            </div>
+
+            <div className="text-center">
+              <p className="text-2xl font-bold text-purple-600">
+                {Math.round(derivedSeries.totals.acceptanceRate * 100)}%
+              </p>
+              <p className="text-sm text-gray-600 dark:text-gray-400">Acceptance Rate</p>
+            </div>
+          </div>
+        </div>
+      )}
+
       {/* Coming Soon Placeholder */}
       <div className="bg-white dark:bg-gray-800 p-6 rounded-lg border border-gray-200 dark:border-gray-700">
         <h3 className="text-lg font-semibold text-gray-900 dark:text-white mb-4">
@@ -728,8 +853,25 @@ const TaskAnalytics = ({ taskAnalytics, dateRange }) => {
 /**
  * Deploy Patterns Tab Component
  */
-const DeployPatterns = ({ deployAnalytics, dateRange, formatDuration, formatPercentage }) => {
-  console.log('📊 [DEPLOY_PATTERNS] Rendering with data:', !!deployAnalytics)
+const DeployPatterns = ({ deployAnalytics, derivedSeries, dateRange, formatDuration, formatPercentage }) => {
+  console.log('📊 [DEPLOY_PATTERNS] Rendering with data:', !!deployAnalytics, 'series:', !!derivedSeries)
+
+  // Daily bars from the worker-computed typed arrays
+  const dailyBars = []
+  if (derivedSeries?.timeSavedMinutesByDay) {
+    const series = derivedSeries.timeSavedMinutesByDay
+    let maxValue = 0
+    for (let i = 0; i < series.length; i++) {
+      if (series[i] > maxValue) maxValue = series[i]
+    }
+    for (let i = 0; i < series.length; i++) {
+      dailyBars.push({
+        epoch: derivedSeries.dayStartEpochs[i],
+        minutes: series[i],
+        heightPct: maxValue > 0 ? (series[i] / maxValue) * 100 : 0
+      })
+    }
+  }
 
   if (!deployAnalytics) {
     return (
@@ -798,6 +940,30 @@ const DeployPatterns = ({ deployAnalytics, dateRange, formatDuration, formatPerc
         </div>
       </div>
 
+      {/* Daily Time Saved (worker-computed) */}
+      {dailyBars.length > 0 && derivedSeries?.totals?.sessions > 0 && (
+        <div className="bg-white dark:bg-gray-800 p-6 rounded-lg border border-gray-200 dark:border-gray-700">
+          <h3 className="text-lg font-semibold text-gray-900 dark:text-white mb-4">
+            📆 Daily Time Saved ({dateRange} days)
+          </h3>
+
+          <div className="flex items-end space-x-1 h-24">
+            {dailyBars.map((bar) => (
+              <div
+                key={bar.epoch}
+                className="flex-1 bg-green-500 rounded-t"
+                style={{ height: `${Math.max(2, bar.heightPct)}%` }}
+                title={`${new Date(bar.epoch).toLocaleDateString()}: ${Math.round(bar.minutes)} min`}
+              />
+            ))}
+          </div>
+
+          <p className="text-xs text-gray-500 dark:text-gray-400 mt-2">
+            {formatDuration(derivedSeries.totals.timeSavedMinutes)} saved across {derivedSeries.totals.sessions} sessions
+          </p>
+        </div>
+      )}
+
       {/* Weekly Pattern Analysis */}
       <div className="bg-white dark:bg-gray-800 p-6 rounded-lg border border-gray-200 dark:border-gray-700">
         <h3 className="text-lg font-semibold text-gray-900 dark:text-white mb-4">
@@ -278,24 +278,34 @@ const CustomNotification = ({ notification, onAction }) => {
   };
 
   return (
-    <div 
+    // Entrance/exit and hover animate only transform and opacity - both
+    // composite on the GPU, so the notification stays smooth even when the
+    // main process is busy. Layout (padding, borders, shadows) is fixed up
+    // front and never animates.
+    <div
       className={`
-        fixed ${notification.data?.type === 'unified_suggestion' ? 'inset-x-0 top-0' : 'inset-0'} pointer-events-auto transition-all duration-300 ease-out
+        fixed ${notification.data?.type === 'unified_suggestion' ? 'inset-x-0 top-0' : 'inset-0'} pointer-events-auto transition-[transform,opacity] duration-300 ease-out will-change-[transform,opacity]
         ${isVisible ? 'opacity-100 translate-x-0' : 'opacity-0 translate-x-full'}
       `}
     >
-      <div 
+      <div
         className={`
           w-full ${notification.data?.type === 'unified_suggestion' ? '' : 'h-full'} ${notification.data?.type === 'unified_suggestion' ? 'p-3' : 'p-4'} rounded-xl border-2 shadow-2xl backdrop-blur-md
           ${getNotificationColor()}
-          ${isHovered ? 'scale-105 shadow-3xl' : 'scale-100'}
-          transition-all duration-200 ease-out cursor-pointer
+          ${isHovered ? 'scale-105' : 'scale-100'}
+          transition-transform duration-200 ease-out will-change-transform cursor-pointer
           relative ${notification.data?.type === 'unified_suggestion' ? 'overflow-visible' : 'overflow-hidden'}
         `}
         onClick={handleClick}
         onMouseEnter={() => setIsHovered(true)}
         onMouseLeave={() => setIsHovered(false)}
       >
+        {/* Hover emphasis: a pre-rendered larger shadow faded in with
+            opacity, instead of animating box-shadow (a paint property) */}
+        <div
+          className={`absolute inset-0 rounded-xl shadow-2xl transition-opacity duration-200 ease-out pointer-events-none ${isHovered ? 'opacity-100' : 'opacity-0'}`}
+        ></div>
+
         {/* Background blur effect */}
         <div className="absolute inset-0 bg-white bg-opacity-80 backdrop-blur-sm rounded-xl"></div>
         
@@ -1,7 +1,56 @@
-import React, { useState, useEffect } from 'react'
+import React, { useEffect } from 'react'
+import { useSlice, setSlice } from '../store'
 
-const DeployStatus = ({ status, timerData }) => {
-  // Remove mock timer simulation - we'll use real timer data from props
+/**
+ * Derive the display status from the raw backend status payload - is
+ * monitoring active, and is the selected project among those monitored
+ */
+const deriveStatus = (statusData, selectedProject) => {
+  if (!statusData || !selectedProject) return 'idle'
+
+  const isMonitoring = statusData.monitoring_active || false
+  const monitoredProjects = statusData.monitor_status?.monitored_projects || statusData.monitored_projects || []
+  const isProjectMonitored = monitoredProjects.some(p =>
+    p === selectedProject.name ||
+    p?.name === selectedProject.name || p?.path === selectedProject.path
+  )
+
+  return isMonitoring && isProjectMonitored ? 'monitoring' : 'idle'
+}
+
+const DeployStatus = ({ selectedProject, isBackendConnected }) => {
+  // Per-slice subscriptions: timer syncs and status pushes land here
+  // without re-rendering App or anything else in the tree
+  const statusData = useSlice('status')
+  const timerData = useSlice('timer')
+
+  // One-time seed per project; after that the backend pushes
+  // status_changed deltas onto the 'status' topic -> slice
+  useEffect(() => {
+    if (!isBackendConnected || !selectedProject) return
+
+    let cancelled = false
+    const seedDeployStatus = async () => {
+      try {
+        console.log('📦 [DEPLOY_STATUS] Seeding deploy status for project:', selectedProject.name)
+        const response = await window.electronAPI?.deploy.status(selectedProject.path)
+        const data = response?.data || response
+        if (!cancelled && data && data.success) {
+          setSlice('status', data)
+        }
+      } catch (error) {
+        console.error('❌ [DEPLOY_STATUS] Failed to seed deploy status:', error)
+        // Don't update the slice on error to avoid flickering
+      }
+    }
+    seedDeployStatus()
+
+    return () => {
+      cancelled = true
+    }
+  }, [isBackendConnected, selectedProject?.path])
+
+  const status = deriveStatus(statusData, selectedProject)
   console.log('🚀 [DEPLOY_STATUS] Rendering with status:', status, 'timerData:', timerData)
 
   /**
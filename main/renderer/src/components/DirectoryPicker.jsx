@@ -1,4 +1,19 @@
-import React, { useState, useEffect } from 'react'
+import React, { useState, useEffect, useRef } from 'react'
+
+// Filenames that mark a directory as an existing project (matches the
+// main-process heuristics in get-directory-info)
+const PROJECT_FILE_HINTS = ['package.json', 'requirements.txt', 'readme', '.git', 'todo']
+
+// Listing entries kept for the preview pane - counting continues past this
+const PREVIEW_LIMIT = 100
+
+const matchProjectFiles = (entries) =>
+  entries
+    .map((entry) => entry.name)
+    .filter((name) => {
+      const lower = name.toLowerCase()
+      return PROJECT_FILE_HINTS.some((hint) => lower.includes(hint))
+    })
 
 /**
  * DirectoryPicker Component
@@ -30,6 +45,10 @@ const DirectoryPicker = ({
   const [error, setError] = useState(null)
   const [validateTimeout, setValidateTimeout] = useState(null)
 
+  // Active streaming scan: token invalidates superseded scans, scanId is
+  // the main-process cursor to cancel when the path changes
+  const activeScanRef = useRef({ token: 0, scanId: null })
+
   // MEMORY LEAK FIX: Cleanup timeout on unmount
   useEffect(() => {
     return () => {
@@ -40,6 +59,87 @@ const DirectoryPicker = ({
     }
   }, [validateTimeout])
 
+  // Cancel any in-flight scan when the picker unmounts
+  useEffect(() => {
+    return () => cancelActiveScan()
+  }, [])
+
+  const cancelActiveScan = () => {
+    const active = activeScanRef.current
+    active.token += 1
+    if (active.scanId) {
+      window.electronAPI?.fileSystem?.scanDirectoryCancel?.(active.scanId)
+      active.scanId = null
+    }
+  }
+
+  /**
+   * Start a streaming listing of the directory. The first page paints
+   * immediately; the rest is appended page by page in the background so a
+   * huge network-mounted folder never blocks the dialog.
+   */
+  const startDirectoryScan = async (directoryPath) => {
+    cancelActiveScan()
+    const token = activeScanRef.current.token
+
+    const first = await window.electronAPI?.fileSystem?.scanDirectoryStart?.(directoryPath, 100)
+    if (activeScanRef.current.token !== token) return null // superseded
+
+    if (!first || !first.success) {
+      setDirectoryInfo(null)
+      return first
+    }
+
+    const projectFiles = matchProjectFiles(first.entries)
+    const info = {
+      itemCount: first.entries.length,
+      writable: first.writable,
+      projectFiles,
+      hasProjectFiles: projectFiles.length > 0,
+      previewEntries: first.entries.slice(0, PREVIEW_LIMIT),
+      scanning: !first.done
+    }
+    setDirectoryInfo(info)
+
+    if (!first.done && first.scanId) {
+      activeScanRef.current.scanId = first.scanId
+      continueDirectoryScan(token, first.scanId, info)
+    }
+    return first
+  }
+
+  const continueDirectoryScan = async (token, scanId, info) => {
+    let current = info
+    let done = false
+
+    while (!done && activeScanRef.current.token === token) {
+      const page = await window.electronAPI?.fileSystem?.scanDirectoryNext?.(scanId, 500)
+      if (activeScanRef.current.token !== token) return
+      if (!page || !page.success) break
+
+      const projectFiles = [...new Set([...current.projectFiles, ...matchProjectFiles(page.entries)])]
+      current = {
+        ...current,
+        itemCount: current.itemCount + page.entries.length,
+        projectFiles,
+        hasProjectFiles: projectFiles.length > 0,
+        previewEntries: current.previewEntries.length < PREVIEW_LIMIT
+          ? [...current.previewEntries, ...page.entries].slice(0, PREVIEW_LIMIT)
+          : current.previewEntries,
+        scanning: !page.done
+      }
+      setDirectoryInfo(current)
+      done = page.done
+    }
+
+    if (!done && activeScanRef.current.token === token) {
+      setDirectoryInfo({ ...current, scanning: false })
+    }
+    if (activeScanRef.current.scanId === scanId) {
+      activeScanRef.current.scanId = null
+    }
+  }
+
   // Update internal state when value prop changes
   useEffect(() => {
     console.log('📂 [DIRECTORY_PICKER] Value prop changed:', value)
@@ -69,20 +169,19 @@ const DirectoryPicker = ({
     setError(null)
 
     try {
-      // Get directory info first
-      const infoResponse = await window.electronAPI?.fileSystem.getDirectoryInfo(directoryPath)
-      console.log('📂 [DIRECTORY_PICKER] Directory info response:', infoResponse)
+      // Kick off the streaming listing - the first page is back (and
+      // rendered) in milliseconds, remaining pages append in the background
+      const scanStart = await startDirectoryScan(directoryPath)
+      if (scanStart === null) return // superseded by a newer path
 
-      if (infoResponse && infoResponse.success) {
-        setDirectoryInfo(infoResponse)
-        
-        // Now validate with backend
+      if (scanStart && scanStart.success) {
+        // Validate with backend while the listing keeps streaming in
         const validationResponse = await window.electronAPI?.project.validateCustomDirectory(directoryPath)
         console.log('📂 [DIRECTORY_PICKER] Validation response:', validationResponse)
-        
+
         // Handle WebSocket response structure
         const data = validationResponse?.data || validationResponse
-        
+
         if (data && data.success) {
           setValidationResult(data.validation_result)
           console.log('✅ [DIRECTORY_PICKER] Validation completed:', data.validation_result)
@@ -94,7 +193,7 @@ const DirectoryPicker = ({
         setValidationResult({
           is_valid: false,
           is_suitable: false,
-          errors: [infoResponse?.error || 'Directory not accessible'],
+          errors: [scanStart?.error || 'Directory not accessible'],
           warnings: [],
           suggestions: ['Please select an existing, accessible directory']
         })
@@ -308,11 +407,13 @@ const DirectoryPicker = ({
             </span>
           </div>
 
-          {/* Directory Info */}
+          {/* Directory Info - listing streams in progressively */}
           {directoryInfo && (
             <div className="text-xs text-gray-600 dark:text-gray-400 bg-gray-50 dark:bg-gray-800 rounded p-2">
               <div className="grid grid-cols-2 gap-2">
-                <div>📊 {directoryInfo.itemCount} items</div>
+                <div>
+                  📊 {directoryInfo.itemCount} items{directoryInfo.scanning ? '… (scanning)' : ''}
+                </div>
                 <div>{directoryInfo.writable ? '✅ Writable' : '❌ Read-only'}</div>
                 {directoryInfo.hasProjectFiles && (
                   <div className="col-span-2">
@@ -320,6 +421,21 @@ const DirectoryPicker = ({
                   </div>
                 )}
               </div>
+
+              {directoryInfo.previewEntries?.length > 0 && (
+                <div className="mt-2 max-h-32 overflow-y-auto space-y-0.5 border-t border-gray-200 dark:border-gray-700 pt-1">
+                  {directoryInfo.previewEntries.map((entry) => (
+                    <div key={entry.name} className="truncate">
+                      {entry.isDirectory ? '📁' : '📄'} {entry.name}
+                    </div>
+                  ))}
+                  {directoryInfo.itemCount > directoryInfo.previewEntries.length && (
+                    <div className="text-gray-400 dark:text-gray-500">
+                      … and {directoryInfo.itemCount - directoryInfo.previewEntries.length} more
+                    </div>
+                  )}
+                </div>
+              )}
             </div>
           )}
 
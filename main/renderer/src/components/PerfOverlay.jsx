@@ -0,0 +1,83 @@
+import React, { useState, useEffect, useRef } from 'react'
+import { getPerfSnapshot } from '../perf'
+
+/**
+ * Performance Overlay Component
+ *
+ * 📐 Opt-in floating readout (Ctrl/Cmd+Shift+P) showing what the user
+ * actually experiences:
+ * - frame rate and long frames from a requestAnimationFrame loop
+ * - React commit durations from the app-level <Profiler>
+ * - click-to-update latency for tracked interactions (project switch, etc.)
+ */
+const PerfOverlay = () => {
+  const [snapshot, setSnapshot] = useState({ commits: null, interactions: {} })
+  const [frameStats, setFrameStats] = useState({ fps: 0, longFrames: 0, worstMs: 0 })
+  const frameData = useRef({ deltas: [], last: 0, longFrames: 0 })
+
+  // Frame timing loop - deltas over ~2 seconds, long frame = >50ms
+  useEffect(() => {
+    let rafId
+    const tick = (now) => {
+      const data = frameData.current
+      if (data.last) {
+        const delta = now - data.last
+        data.deltas.push(delta)
+        if (data.deltas.length > 120) data.deltas.shift()
+        if (delta > 50) data.longFrames += 1
+      }
+      data.last = now
+      rafId = requestAnimationFrame(tick)
+    }
+    rafId = requestAnimationFrame(tick)
+
+    const refreshInterval = setInterval(() => {
+      // Hidden window: rAF is already parked by the compositor, so there
+      // are no fresh frame deltas - skip the state churn too
+      if (window.electronAPI?.visibility?.isHidden()) return
+      const { deltas, longFrames } = frameData.current
+      if (deltas.length) {
+        const avg = deltas.reduce((a, b) => a + b, 0) / deltas.length
+        setFrameStats({
+          fps: Math.round(1000 / avg),
+          longFrames,
+          worstMs: Math.round(Math.max(...deltas)),
+        })
+      }
+      setSnapshot(getPerfSnapshot())
+    }, 500)
+
+    return () => {
+      cancelAnimationFrame(rafId)
+      clearInterval(refreshInterval)
+    }
+  }, [])
+
+  const formatMs = (value) => `${value.toFixed(1)}ms`
+
+  return (
+    <div
+      className="fixed bottom-2 right-2 z-50 rounded bg-black bg-opacity-80 text-green-400 font-mono text-xs p-3 pointer-events-none"
+      style={{ minWidth: '220px' }}
+    >
+      <div className="text-white mb-1">📐 Perf (Ctrl/Cmd+Shift+P)</div>
+      <div>
+        fps {frameStats.fps} · worst {frameStats.worstMs}ms · long frames {frameStats.longFrames}
+      </div>
+      {snapshot.commits && (
+        <div>
+          commit p50 {formatMs(snapshot.commits.p50)} · max {formatMs(snapshot.commits.max)}
+        </div>
+      )}
+      {Object.entries(snapshot.interactions).map(([name, stats]) => (
+        stats && (
+          <div key={name}>
+            {name}: last {formatMs(stats.last)} · p50 {formatMs(stats.p50)} ({stats.count})
+          </div>
+        )
+      ))}
+    </div>
+  )
+}
+
+export default PerfOverlay
@@ -0,0 +1,161 @@
+import React, { useState, useEffect } from 'react'
+
+/**
+ * Performance Stats Panel Component
+ *
+ * 📈 Backend instrumentation viewer for the 'perf-stats' command
+ * Features:
+ * - Per-command latency percentiles (p50/p95/p99) and call counts
+ * - Monitor log-check and timer tick latency summaries
+ * - Auto-refresh while the panel is visible
+ */
+const PerfStats = () => {
+  console.log('📈 [PERF_STATS] Component rendering')
+
+  const [stats, setStats] = useState(null)
+  const [error, setError] = useState(null)
+  const [lastUpdated, setLastUpdated] = useState(null)
+
+  // Load stats on mount and refresh periodically while visible - a hidden
+  // window skips the refresh entirely and resyncs once on show
+  useEffect(() => {
+    loadStats()
+    const refreshInterval = setInterval(() => {
+      if (!window.electronAPI?.visibility?.isHidden()) {
+        loadStats()
+      }
+    }, 5000) // Every 5 seconds
+    const removeResync = window.electronAPI?.visibility?.onResync(loadStats)
+
+    return () => {
+      clearInterval(refreshInterval)
+      if (removeResync) {
+        removeResync()
+      }
+    }
+  }, [])
+
+  /**
+   * Load performance stats from the backend
+   */
+  const loadStats = async () => {
+    try {
+      const response = await window.electronAPI?.perf?.getStats()
+
+      if (response?.data?.success) {
+        setStats(response.data)
+        setLastUpdated(new Date())
+        setError(null)
+      } else {
+        console.warn('⚠️ [PERF_STATS] Backend returned unsuccessful response:', response)
+        setError('Failed to load performance stats from backend')
+      }
+    } catch (error) {
+      console.error('❌ [PERF_STATS] Failed to load performance stats:', error)
+      setError(error.message)
+    }
+  }
+
+  /**
+   * Render one latency summary row (command or loop)
+   */
+  const renderSummaryRow = (name, summary) => (
+    <tr key={name} className="border-b border-gray-100 dark:border-gray-700">
+      <td className="py-2 pr-4 font-mono text-xs text-gray-900 dark:text-white">{name}</td>
+      <td className="py-2 pr-4 text-right">{summary.count ?? summary.samples ?? 0}</td>
+      <td className="py-2 pr-4 text-right">{summary.avg_ms ?? '—'}</td>
+      <td className="py-2 pr-4 text-right">{summary.p50_ms ?? '—'}</td>
+      <td className="py-2 pr-4 text-right">{summary.p95_ms ?? '—'}</td>
+      <td className="py-2 pr-4 text-right">{summary.p99_ms ?? '—'}</td>
+      <td className="py-2 text-right">{summary.max_ms ?? '—'}</td>
+    </tr>
+  )
+
+  const commandEntries = Object.entries(stats?.commands || {})
+    .sort((a, b) => (b[1].count || 0) - (a[1].count || 0))
+
+  return (
+    <div className="bg-white dark:bg-gray-800 rounded-lg shadow-sm border border-gray-200 dark:border-gray-700 p-6">
+      {/* Header */}
+      <div className="flex items-center justify-between mb-4">
+        <h2 className="text-lg font-semibold text-gray-900 dark:text-white">
+          📈 Backend Performance
+        </h2>
+        <div className="flex items-center space-x-3">
+          {lastUpdated && (
+            <span className="text-xs text-gray-500 dark:text-gray-400">
+              Updated {lastUpdated.toLocaleTimeString()}
+            </span>
+          )}
+          <button
+            onClick={loadStats}
+            className="px-3 py-1 text-sm font-medium rounded-md bg-gray-100 dark:bg-gray-700 text-gray-700 dark:text-gray-300 hover:bg-gray-200 dark:hover:bg-gray-600 transition-colors"
+          >
+            🔄 Refresh
+          </button>
+        </div>
+      </div>
+
+      {/* Error Display */}
+      {error && (
+        <div className="bg-red-50 dark:bg-red-900/20 border-l-4 border-red-500 p-3 mb-4 rounded text-sm text-red-700 dark:text-red-300">
+          ❌ {error}
+        </div>
+      )}
+
+      {/* Command latency table */}
+      {commandEntries.length > 0 ? (
+        <div className="overflow-x-auto">
+          <table className="w-full text-sm text-gray-700 dark:text-gray-300">
+            <thead>
+              <tr className="text-left text-xs uppercase text-gray-500 dark:text-gray-400 border-b border-gray-200 dark:border-gray-600">
+                <th className="py-2 pr-4">Command</th>
+                <th className="py-2 pr-4 text-right">Count</th>
+                <th className="py-2 pr-4 text-right">Avg ms</th>
+                <th className="py-2 pr-4 text-right">p50</th>
+                <th className="py-2 pr-4 text-right">p95</th>
+                <th className="py-2 pr-4 text-right">p99</th>
+                <th className="py-2 text-right">Max ms</th>
+              </tr>
+            </thead>
+            <tbody>
+              {commandEntries.map(([command, summary]) => renderSummaryRow(command, summary))}
+            </tbody>
+          </table>
+        </div>
+      ) : (
+        <div className="text-center py-8 text-gray-500 dark:text-gray-400 text-sm">
+          No command timings recorded yet
+        </div>
+      )}
+
+      {/* Background loop latencies */}
+      {stats && (
+        <div className="mt-6">
+          <h3 className="text-sm font-medium text-gray-900 dark:text-white mb-2">
+            ⚙️ Background Loops
+          </h3>
+          <table className="w-full text-sm text-gray-700 dark:text-gray-300">
+            <thead>
+              <tr className="text-left text-xs uppercase text-gray-500 dark:text-gray-400 border-b border-gray-200 dark:border-gray-600">
+                <th className="py-2 pr-4">Loop</th>
+                <th className="py-2 pr-4 text-right">Samples</th>
+                <th className="py-2 pr-4 text-right">Avg ms</th>
+                <th className="py-2 pr-4 text-right">p50</th>
+                <th className="py-2 pr-4 text-right">p95</th>
+                <th className="py-2 pr-4 text-right">p99</th>
+                <th className="py-2 text-right">Max ms</th>
+              </tr>
+            </thead>
+            <tbody>
+              {renderSummaryRow('monitor log checks', stats.monitor?.log_checks || {})}
+              {renderSummaryRow('timer update ticks', stats.timer?.update_ticks || {})}
+            </tbody>
+          </table>
+        </div>
+      )}
+    </div>
+  )
+}
+
+export default PerfStats
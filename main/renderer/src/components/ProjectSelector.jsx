@@ -2,8 +2,10 @@ import React, { useState, useEffect } from 'react'
 import DirectoryPicker from './DirectoryPicker'
 import CustomDirectoryManager from './CustomDirectoryManager'
 
-const ProjectSelector = ({ selectedProject, onProjectSelect, isBackendConnected, backendStatus }) => {
-  const [projects, setProjects] = useState([])
+const ProjectSelector = ({ selectedProject, onProjectSelect, isBackendConnected, backendStatus, initialProjects }) => {
+  // Seed from the startup snapshot so the list paints immediately; the
+  // live fetch after connection replaces it
+  const [projects, setProjects] = useState(() => initialProjects || [])
   const [isCreating, setIsCreating] = useState(false)
   const [newProjectName, setNewProjectName] = useState('')
   const [customDirectory, setCustomDirectory] = useState('')
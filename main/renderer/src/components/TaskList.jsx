@@ -1,17 +1,119 @@
-import React, { useState, useEffect } from 'react'
+import React, { useState, useEffect, useCallback } from 'react'
+import { useSlice } from '../store'
+
+// Virtualization: estimated row height (including list gap) and rows
+// rendered beyond the viewport on each side
+const ROW_HEIGHT = 104
+const OVERSCAN = 6
+const VIEWPORT_HEIGHT = 512 // matches max-h-[32rem]
+
+/**
+ * Get tag styling based on tag type
+ */
+const getTagClass = (tag) => {
+  const tagType = tag.replace('#', '')
+  switch (tagType) {
+    case 'short': return 'tag tag-short'
+    case 'long': return 'tag tag-long'
+    case 'code': case 'backend': return 'tag tag-code'
+    case 'writing': case 'creative': return 'tag tag-writing'
+    case 'research': return 'tag tag-research'
+    case 'solo': return 'tag bg-blue-100 text-blue-800 dark:bg-blue-800 dark:text-blue-100'
+    case 'collab': return 'tag bg-purple-100 text-purple-800 dark:bg-purple-800 dark:text-purple-100'
+    default: return 'tag bg-gray-100 text-gray-800 dark:bg-gray-700 dark:text-gray-300'
+  }
+}
+
+// Memoized row - only re-renders when its own task object changes, so
+// toggling one task doesn't re-render the other 999
+const TaskRow = React.memo(function TaskRow({ task, onToggle, onOpenApp }) {
+  return (
+    <div
+      className={`group p-4 border rounded-lg transition-all duration-200 hover:shadow-sm ${
+        task.completed
+          ? 'bg-gray-50 dark:bg-gray-700/50 border-gray-200 dark:border-gray-600'
+          : 'bg-white dark:bg-gray-800 border-gray-200 dark:border-gray-600 hover:border-deploybot-primary'
+      }`}
+    >
+      <div className="flex items-start space-x-3">
+        {/* Checkbox */}
+        <button
+          onClick={() => onToggle(task.id)}
+          className={`mt-1 w-5 h-5 rounded border-2 transition-colors duration-200 ${
+            task.completed
+              ? 'bg-deploybot-secondary border-deploybot-secondary text-white'
+              : 'border-gray-300 dark:border-gray-600 hover:border-deploybot-primary'
+          }`}
+        >
+          {task.completed && <span className="text-xs">✓</span>}
+        </button>
+
+        {/* Task Content */}
+        <div className="flex-1 min-w-0">
+          <div className="flex items-start justify-between">
+            <div className="flex-1">
+              <p className={`font-medium ${
+                task.completed
+                  ? 'text-gray-500 dark:text-gray-400 line-through'
+                  : 'text-gray-900 dark:text-white'
+              }`}>
+                {task.text}
+              </p>
+
+              {/* Task metadata */}
+              {(task.priority || task.estimated_duration) && (
+                <div className="mt-1 text-xs text-gray-500 dark:text-gray-400">
+                  {task.priority && <span>Priority: {task.priority}/10</span>}
+                  {task.priority && task.estimated_duration && <span> • </span>}
+                  {task.estimated_duration && <span>~{task.estimated_duration}min</span>}
+                </div>
+              )}
+            </div>
+
+            {/* Open App Button */}
+            {!task.completed && task.app && (
+              <button
+                onClick={() => onOpenApp(task)}
+                className="btn-outline text-xs ml-2 opacity-0 group-hover:opacity-100 transition-opacity"
+                title={`Open in ${task.app}`}
+              >
+                📱 {task.app}
+              </button>
+            )}
+          </div>
+
+          {/* Tags */}
+          {task.tags && task.tags.length > 0 && (
+            <div className="mt-2 flex flex-wrap gap-1">
+              {task.tags.map((tag, index) => (
+                <span
+                  key={index}
+                  className={getTagClass(tag)}
+                >
+                  {tag}
+                </span>
+              ))}
+            </div>
+          )}
+        </div>
+      </div>
+    </div>
+  )
+})
 
 const TaskList = ({ project }) => {
   const [tasks, setTasks] = useState([])
   const [isLoading, setIsLoading] = useState(false)
   const [error, setError] = useState(null)
   const [taskStats, setTaskStats] = useState(null)
+  const [scrollTop, setScrollTop] = useState(0)
 
   console.log('📝 [TASK_LIST] Component mounted with project:', project?.name || 'none')
 
   // Load tasks when project changes
   useEffect(() => {
     console.log('📝 [TASK_LIST] useEffect triggered - project:', project?.name || 'none')
-    
+
     if (project) {
       console.log('📝 [TASK_LIST] Loading tasks for project:', project.name)
       loadTasks()
@@ -22,6 +124,21 @@ const TaskList = ({ project }) => {
     }
   }, [project])
 
+  // Push-based refresh: the backend watches TODO.md and publishes fresh
+  // statistics on the "tasks" topic, which the store routes into the
+  // 'tasks' slice - so an edit shows up immediately and an idle panel
+  // costs nothing
+  const tasksPush = useSlice('tasks')
+  useEffect(() => {
+    if (!project || !tasksPush) return
+
+    const data = tasksPush.data || {}
+    if (data.project_path === project.path || data.project === project.name) {
+      console.log('📝 [TASK_LIST] TODO.md changed - reloading tasks')
+      loadTasks()
+    }
+  }, [tasksPush])
+
   /**
    * Load tasks from the project's TODO.md file using real backend
    */
@@ -29,7 +146,7 @@ const TaskList = ({ project }) => {
     setIsLoading(true)
     setError(null)
     console.log('📝 [TASK_LIST] Loading tasks from backend for project:', project.path)
-    
+
     try {
       // Get task suggestions from the sophisticated backend parser
       const response = await window.electronAPI?.tasks.getSuggestions(project.path, {
@@ -37,24 +154,24 @@ const TaskList = ({ project }) => {
         load_all_tasks: true,
         include_completed: true
       })
-      
+
       console.log('📝 [TASK_LIST] Backend response:', JSON.stringify(response, null, 2))
-      
+
       // Handle WebSocket response structure - data is nested under response.data
       const data = response?.data || response;
-      
+
       if (data && data.success && data.task) {
         // If we got a single task, it means the TODO.md doesn't exist or is empty
         // Let's try to get the full project data which includes parsed tasks
         const projectResponse = await window.electronAPI?.project.open({ path: project.path })
-        
+
         // Handle WebSocket response structure for project data
         const projectData = projectResponse?.data || projectResponse;
-        
+
         if (projectData && projectData.success && projectData.project) {
           const fullProjectData = projectData.project
           console.log('📝 [TASK_LIST] Full project data:', JSON.stringify(fullProjectData, null, 2))
-          
+
           if (fullProjectData.tasks && Array.isArray(fullProjectData.tasks)) {
             setTasks(fullProjectData.tasks)
             setTaskStats({
@@ -77,14 +194,14 @@ const TaskList = ({ project }) => {
         setTasks([])
         setTaskStats({ total: 0, pending: 0, completed: 0 })
       }
-      
+
       console.log('✅ [TASK_LIST] Tasks loaded successfully')
     } catch (error) {
       console.error('❌ [TASK_LIST] Failed to load tasks:', error)
       console.error('❌ [TASK_LIST] Error details:', JSON.stringify(error, null, 2))
       setError(error.message)
       window.electronAPI?.utils.log('error', 'Failed to load tasks', error)
-      
+
       // Set empty state on error
       setTasks([])
       setTaskStats({ total: 0, pending: 0, completed: 0 })
@@ -95,40 +212,38 @@ const TaskList = ({ project }) => {
 
   /**
    * Toggle task completion status
+   *
+   * Stable callback (no closed-over task state) so memoized rows keep their
+   * identity; only the toggled row's task object changes.
    */
-  const toggleTask = async (taskId) => {
+  const toggleTask = useCallback((taskId) => {
     console.log('📝 [TASK_LIST] Toggling task:', taskId)
-    
-    setTasks(prevTasks => 
-      prevTasks.map(task => 
-        task.id === taskId 
+
+    setTasks(prevTasks => {
+      const updatedTasks = prevTasks.map(task =>
+        task.id === taskId
           ? { ...task, completed: !task.completed }
           : task
       )
-    )
-    
-    // Update stats
-    const updatedTasks = tasks.map(task => 
-      task.id === taskId 
-        ? { ...task, completed: !task.completed }
-        : task
-    )
-    
-    setTaskStats({
-      total: updatedTasks.length,
-      pending: updatedTasks.filter(t => !t.completed).length,
-      completed: updatedTasks.filter(t => t.completed).length
+
+      setTaskStats({
+        total: updatedTasks.length,
+        pending: updatedTasks.filter(t => !t.completed).length,
+        completed: updatedTasks.filter(t => t.completed).length
+      })
+
+      return updatedTasks
     })
-    
+
     window.electronAPI?.utils.log('info', 'Task toggled', { taskId })
-  }
+  }, [])
 
   /**
    * Open the associated app for a task using real redirection system
    */
-  const openTaskApp = async (task) => {
+  const openTaskApp = useCallback(async (task) => {
     console.log('📝 [TASK_LIST] Opening app for task:', task.text, 'App:', task.app)
-    
+
     try {
       // Use the sophisticated redirection system
       const context = {
@@ -136,19 +251,19 @@ const TaskList = ({ project }) => {
         project_path: project.path,
         redirect_reason: 'manual_task_selection'
       }
-      
+
       const response = await window.electronAPI?.tasks.redirectToTask(task, context)
       console.log('📝 [TASK_LIST] Redirection response:', JSON.stringify(response, null, 2))
-      
+
       // Handle WebSocket response structure - data is nested under response.data
       const data = response?.data || response;
-      
+
       if (data && data.success) {
         console.log('✅ [TASK_LIST] Task redirection successful:', data)
-        window.electronAPI?.utils.log('info', 'Task app opened successfully', { 
-          task: task.text, 
+        window.electronAPI?.utils.log('info', 'Task app opened successfully', {
+          task: task.text,
           app: task.app,
-          redirect_result: data.redirect_result 
+          redirect_result: data.redirect_result
         })
       } else {
         throw new Error(data?.message || data?.error || 'Redirection failed')
@@ -157,7 +272,7 @@ const TaskList = ({ project }) => {
       console.error('❌ [TASK_LIST] Failed to open app:', error)
       console.error('❌ [TASK_LIST] Error details:', JSON.stringify(error, null, 2))
       window.electronAPI?.utils.log('error', 'Failed to open task app', error)
-      
+
       // Fallback to simple app opening
       try {
         await window.electronAPI?.python.sendCommand('open-app', {
@@ -170,7 +285,7 @@ const TaskList = ({ project }) => {
         console.error('❌ [TASK_LIST] Fallback app opening also failed:', fallbackError)
       }
     }
-  }
+  }, [project])
 
   /**
    * Get a smart task suggestion using the AI backend
@@ -178,7 +293,7 @@ const TaskList = ({ project }) => {
   const getTaskSuggestion = async () => {
     console.log('🎯 [TASK_LIST] Getting AI task suggestion...')
     setIsLoading(true)
-    
+
     try {
       const context = {
         project_name: project.name,
@@ -186,19 +301,19 @@ const TaskList = ({ project }) => {
         timer_duration: 1800,
         use_llm: true
       }
-      
+
       const response = await window.electronAPI?.tasks.getSuggestions(project.path, context)
       console.log('🎯 [TASK_LIST] Task suggestion response:', JSON.stringify(response, null, 2))
-      
+
       // Handle WebSocket response structure - data is nested under response.data
       const data = response?.data || response;
-      
+
       if (data && data.success && data.task) {
         console.log('🎯 [TASK_LIST] AI suggested task:', data.task)
-        
+
         // Highlight the suggested task in the UI
         const suggestedTask = data.task
-        
+
         // Automatically open the suggested task
         if (confirm(`AI suggests: "${suggestedTask.text}"\nOpen in ${suggestedTask.app}?`)) {
           await openTaskApp(suggestedTask)
@@ -221,14 +336,14 @@ const TaskList = ({ project }) => {
    */
   const testTaskSelection = async () => {
     console.log('🧪 [TASK_LIST] Testing task selection system...')
-    
+
     try {
       const response = await window.electronAPI?.tasks.testSelection(project.name)
       console.log('🧪 [TASK_LIST] Task selection test result:', response)
-      
+
       // Handle WebSocket response structure
       const data = response?.data || response;
-      
+
       if (data && data.success) {
         alert(`Task selection test successful!\nSelected: ${data.selected_task?.text || 'No task'}\nApp: ${data.selected_task?.app || 'N/A'}`)
       } else {
@@ -240,23 +355,6 @@ const TaskList = ({ project }) => {
     }
   }
 
-  /**
-   * Get tag styling based on tag type
-   */
-  const getTagClass = (tag) => {
-    const tagType = tag.replace('#', '')
-    switch (tagType) {
-      case 'short': return 'tag tag-short'
-      case 'long': return 'tag tag-long'
-      case 'code': case 'backend': return 'tag tag-code'
-      case 'writing': case 'creative': return 'tag tag-writing'
-      case 'research': return 'tag tag-research'
-      case 'solo': return 'tag bg-blue-100 text-blue-800 dark:bg-blue-800 dark:text-blue-100'
-      case 'collab': return 'tag bg-purple-100 text-purple-800 dark:bg-purple-800 dark:text-purple-100'
-      default: return 'tag bg-gray-100 text-gray-800 dark:bg-gray-700 dark:text-gray-300'
-    }
-  }
-
   if (!project) {
     console.log('📝 [TASK_LIST] No project provided, rendering placeholder')
     return (
@@ -267,7 +365,19 @@ const TaskList = ({ project }) => {
     )
   }
 
-  console.log('📝 [TASK_LIST] Rendering TaskList for project:', project.name)
+  // Windowed rendering: only mount the rows near the viewport, with spacer
+  // divs sized for the rest, so 1,000+ task TODO files scroll smoothly
+  const startIndex = Math.max(0, Math.floor(scrollTop / ROW_HEIGHT) - OVERSCAN)
+  const endIndex = Math.min(
+    tasks.length,
+    Math.ceil((scrollTop + VIEWPORT_HEIGHT) / ROW_HEIGHT) + OVERSCAN
+  )
+  const visibleTasks = tasks.slice(startIndex, endIndex)
+  const topSpacer = startIndex * ROW_HEIGHT
+  const bottomSpacer = (tasks.length - endIndex) * ROW_HEIGHT
+
+  console.log('📝 [TASK_LIST] Rendering TaskList for project:', project.name,
+    'with', visibleTasks.length, 'of', tasks.length, 'rows in window')
 
   return (
     <>
@@ -335,84 +445,26 @@ const TaskList = ({ project }) => {
             </button>
           </div>
         ) : (
-          <div className="space-y-3">
-            {tasks.map((task) => (
-              <div
-                key={task.id}
-                className={`group p-4 border rounded-lg transition-all duration-200 hover:shadow-sm ${
-                  task.completed
-                    ? 'bg-gray-50 dark:bg-gray-700/50 border-gray-200 dark:border-gray-600'
-                    : 'bg-white dark:bg-gray-800 border-gray-200 dark:border-gray-600 hover:border-deploybot-primary'
-                }`}
-              >
-                <div className="flex items-start space-x-3">
-                  {/* Checkbox */}
-                  <button
-                    onClick={() => toggleTask(task.id)}
-                    className={`mt-1 w-5 h-5 rounded border-2 transition-colors duration-200 ${
-                      task.completed
-                        ? 'bg-deploybot-secondary border-deploybot-secondary text-white'
-                        : 'border-gray-300 dark:border-gray-600 hover:border-deploybot-primary'
-                    }`}
-                  >
-                    {task.completed && <span className="text-xs">✓</span>}
-                  </button>
-
-                  {/* Task Content */}
-                  <div className="flex-1 min-w-0">
-                    <div className="flex items-start justify-between">
-                      <div className="flex-1">
-                        <p className={`font-medium ${
-                          task.completed
-                            ? 'text-gray-500 dark:text-gray-400 line-through'
-                            : 'text-gray-900 dark:text-white'
-                        }`}>
-                          {task.text}
-                        </p>
-                        
-                        {/* Task metadata */}
-                        {(task.priority || task.estimated_duration) && (
-                          <div className="mt-1 text-xs text-gray-500 dark:text-gray-400">
-                            {task.priority && <span>Priority: {task.priority}/10</span>}
-                            {task.priority && task.estimated_duration && <span> • </span>}
-                            {task.estimated_duration && <span>~{task.estimated_duration}min</span>}
-                          </div>
-                        )}
-                      </div>
-                      
-                      {/* Open App Button */}
-                      {!task.completed && task.app && (
-                        <button
-                          onClick={() => openTaskApp(task)}
-                          className="btn-outline text-xs ml-2 opacity-0 group-hover:opacity-100 transition-opacity"
-                          title={`Open in ${task.app}`}
-                        >
-                          📱 {task.app}
-                        </button>
-                      )}
-                    </div>
-
-                    {/* Tags */}
-                    {task.tags && task.tags.length > 0 && (
-                      <div className="mt-2 flex flex-wrap gap-1">
-                        {task.tags.map((tag, index) => (
-                          <span
-                            key={index}
-                            className={getTagClass(tag)}
-                          >
-                            {tag}
-                          </span>
-                        ))}
-                      </div>
-                    )}
-                  </div>
-                </div>
-              </div>
-            ))}
+          <div
+            className="max-h-[32rem] overflow-y-auto"
+            onScroll={(e) => setScrollTop(e.currentTarget.scrollTop)}
+          >
+            <div className="space-y-3">
+              {topSpacer > 0 && <div style={{ height: topSpacer }} />}
+              {visibleTasks.map((task) => (
+                <TaskRow
+                  key={task.stable_id || task.id}
+                  task={task}
+                  onToggle={toggleTask}
+                  onOpenApp={openTaskApp}
+                />
+              ))}
+              {bottomSpacer > 0 && <div style={{ height: bottomSpacer }} />}
+            </div>
           </div>
         )}
     </>
   )
 }
 
-export default TaskList 
\ No newline at end of file
+export default TaskList
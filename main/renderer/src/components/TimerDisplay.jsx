@@ -1,15 +1,20 @@
-import React, { useState, useEffect } from 'react'
+import React, { useState, useEffect, useRef } from 'react'
+import { setSlice } from '../store'
 
 /**
  * TimerDisplay Component
- * 
- * Displays real deployment timer information from the backend
- * Connects to WebSocket updates for live timer data
+ *
+ * Displays real deployment timer information from the backend.
+ * The countdown is interpolated locally from the backend's authoritative
+ * (end_time_epoch, server_time_epoch) pair, with sparse drift-correction
+ * syncs instead of a per-second update stream.
  */
-const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
+const TimerDisplay = ({ selectedProject }) => {
   const [timerData, setTimerData] = useState(null)
   const [isActive, setIsActive] = useState(false)
   const [error, setError] = useState(null)
+  const [displaySeconds, setDisplaySeconds] = useState(0)
+  const clockOffsetRef = useRef(0) // client clock minus server clock, from last sync
 
   // Timer status monitoring with auto-refresh - MEMORY LEAK FIX: Reduced frequency and better cleanup
   useEffect(() => {
@@ -22,35 +27,46 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
       return
     }
 
-    let pollInterval = null
+    let pollTimeout = null
+    let cancelled = false
+
+    const scheduleNextCheck = (timerRunning) => {
+      if (cancelled) return
+      // While a timer runs the countdown is interpolated locally, so polls
+      // are just low-frequency drift-correction syncs. Poll faster when idle
+      // so a newly started timer appears promptly.
+      const delay = timerRunning ? 30000 : 3000
+      pollTimeout = setTimeout(checkTimerStatus, delay)
+    }
 
     const checkTimerStatus = async () => {
+      let timerRunning = false
       try {
-        console.log('⏰ [TIMER_DISPLAY] Checking timer status for project:', selectedProject.name)
-        
+        console.log('⏰ [TIMER_DISPLAY] Syncing timer status for project:', selectedProject.name)
+
         const response = await window.electronAPI?.timer.status(selectedProject.name)
         console.log('⏰ [TIMER_DISPLAY] Timer status response:', JSON.stringify(response, null, 2))
-        
+
         // Handle WebSocket response structure
         const data = response?.data || response
-        
+
         if (data && data.success) {
           const timerInfo = data.timer_info
           const wasActive = isActive
-          
+
           if (timerInfo && timerInfo.status === 'running' && timerInfo.remaining_seconds > 0) {
-            // Timer is active
+            // Timer is active - record the client/server clock offset so the
+            // local countdown stays anchored to the authoritative end time
+            if (timerInfo.server_time_epoch) {
+              clockOffsetRef.current = Date.now() / 1000 - timerInfo.server_time_epoch
+            }
+            timerRunning = true
             setTimerData(timerInfo)
             setIsActive(true)
             setError(null)
-            
-            // Notify parent about timer state change
-            if (typeof onTimerUpdate === 'function') {
-              onTimerUpdate({ 
-                isActive: true, 
-                ...timerInfo 
-              })
-            }
+
+            // Publish to the timer slice - DeployStatus subscribes there
+            setSlice('timer', { isActive: true, ...timerInfo })
             
             if (!wasActive) {
               console.log('⏰ [TIMER_DISPLAY] Timer became active')
@@ -61,10 +77,8 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
             setIsActive(false)
             setError(null)
             
-            // Notify parent about timer state change
-            if (typeof onTimerUpdate === 'function') {
-              onTimerUpdate({ isActive: false })
-            }
+            // Publish to the timer slice - DeployStatus subscribes there
+            setSlice('timer', { isActive: false })
             
             if (wasActive) {
               console.log('⏰ [TIMER_DISPLAY] Timer became inactive')
@@ -75,9 +89,7 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
           setTimerData(null)
           setIsActive(false)
           
-          if (typeof onTimerUpdate === 'function') {
-            onTimerUpdate({ isActive: false })
-          }
+          setSlice('timer', { isActive: false })
         }
       } catch (error) {
         console.error('❌ [TIMER_DISPLAY] Failed to get timer status:', error)
@@ -86,29 +98,67 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
         // Don't clear timer data on error, might be temporary connection issue
         if (!timerData) {
           setIsActive(false)
-          if (typeof onTimerUpdate === 'function') {
-            onTimerUpdate({ isActive: false })
-          }
+          setSlice('timer', { isActive: false })
         }
       }
+
+      scheduleNextCheck(timerRunning)
     }
 
-    // Initial check
+    // Initial sync, then self-scheduling drift-correction polls
     checkTimerStatus()
-    
-    // MEMORY LEAK FIX: Reduced from 2 seconds to 3 seconds to reduce load
-    if (selectedProject) {
-      pollInterval = setInterval(checkTimerStatus, 3000)
-    }
 
     return () => {
       console.log('🧹 [TIMER_DISPLAY] Cleaning up timer monitoring...')
-      if (pollInterval) {
-        clearInterval(pollInterval)
-        pollInterval = null
+      cancelled = true
+      if (pollTimeout) {
+        clearTimeout(pollTimeout)
+        pollTimeout = null
       }
     }
-  }, [selectedProject?.name, onTimerUpdate]) // Include onTimerUpdate in dependencies
+  }, [selectedProject?.name])
+
+  // Local countdown interpolation - renders every second without any
+  // backend round trip, anchored to the last authoritative sync
+  useEffect(() => {
+    if (!isActive || !timerData) {
+      setDisplaySeconds(0)
+      return
+    }
+
+    if (timerData.paused) {
+      setDisplaySeconds(timerData.remaining_seconds || 0)
+      return
+    }
+
+    const computeRemaining = () => {
+      if (!timerData.end_time_epoch) {
+        return Math.max(0, timerData.remaining_seconds || 0)
+      }
+      const serverNow = Date.now() / 1000 - clockOffsetRef.current
+      return Math.max(0, timerData.end_time_epoch - serverNow)
+    }
+
+    setDisplaySeconds(computeRemaining())
+
+    const tick = setInterval(() => {
+      // No countdown repaints while hidden - remaining time derives from
+      // end_time_epoch, so the first visible tick lands on the right value
+      if (window.electronAPI?.visibility?.isHidden()) return
+      const remaining = computeRemaining()
+      setDisplaySeconds(remaining)
+
+      // Local expiry - clear immediately, the next sync confirms
+      if (remaining <= 0) {
+        console.log('⏰ [TIMER_DISPLAY] Local countdown reached zero')
+        setIsActive(false)
+        setTimerData(null)
+        setSlice('timer', { isActive: false })
+      }
+    }, 1000)
+
+    return () => clearInterval(tick)
+  }, [isActive, timerData])
 
   // Handle timer actions
   const handleStopTimer = async () => {
@@ -161,10 +211,10 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
   // Get status color based on timer state
   const getStatusColor = () => {
     if (!timerData || !isActive) return 'text-gray-500'
-    
+
     switch (timerData.status) {
       case 'running':
-        return timerData.remainingSeconds > 300 ? 'text-green-600' : 'text-yellow-600' // Yellow if < 5 minutes
+        return displaySeconds > 300 ? 'text-green-600' : 'text-yellow-600' // Yellow if < 5 minutes
       case 'paused':
         return 'text-blue-600'
       case 'expired':
@@ -177,10 +227,10 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
   // Get status icon
   const getStatusIcon = () => {
     if (!timerData || !isActive) return '⏰'
-    
+
     switch (timerData.status) {
       case 'running':
-        return timerData.remainingSeconds > 300 ? '⏰' : '⚠️'
+        return displaySeconds > 300 ? '⏰' : '⚠️'
       case 'paused':
         return '⏸️'
       case 'expired':
@@ -190,6 +240,13 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
     }
   }
 
+  // Progress computed locally from the interpolated countdown
+  const getProgressPercentage = () => {
+    const duration = timerData?.duration_seconds || 0
+    if (duration <= 0) return 0
+    return Math.max(0, Math.min(100, ((duration - displaySeconds) / duration) * 100))
+  }
+
   // Don't render if no selected project
   if (!selectedProject) {
     return null
@@ -217,7 +274,7 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
           {/* Main Timer Display */}
           <div className="text-center">
             <div className={`text-3xl font-bold ${getStatusColor()}`}>
-              {getStatusIcon()} {timerData.timeRemaining || formatTimeRemaining(timerData.remainingSeconds)}
+              {getStatusIcon()} {formatTimeRemaining(displaySeconds)}
             </div>
             <div className="text-sm text-gray-500 dark:text-gray-400">
               {timerData.status === 'running' ? 'Remaining' : 
@@ -229,9 +286,9 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
           <div className="w-full bg-gray-200 dark:bg-gray-600 rounded-full h-2">
             <div 
               className={`h-2 rounded-full transition-all duration-500 ${
-                timerData.remainingSeconds > 300 ? 'bg-green-500' : 'bg-yellow-500'
+                displaySeconds > 300 ? 'bg-green-500' : 'bg-yellow-500'
               }`}
-              style={{ width: `${Math.max(0, Math.min(100, timerData.progressPercentage || 0))}%` }}
+              style={{ width: `${getProgressPercentage()}%` }}
             />
           </div>
 
@@ -239,17 +296,17 @@ const TimerDisplay = ({ selectedProject, onTimerUpdate }) => {
           <div className="text-xs text-gray-600 dark:text-gray-400 space-y-1">
             <div className="flex justify-between">
               <span>Project:</span>
-              <span className="font-medium">{timerData.projectName}</span>
+              <span className="font-medium">{timerData.project_name}</span>
             </div>
             <div className="flex justify-between">
               <span>Total Duration:</span>
-              <span>{formatTimeRemaining(timerData.totalDuration)}</span>
+              <span>{formatTimeRemaining(timerData.duration_seconds)}</span>
             </div>
-            {timerData.deployCommand && (
+            {timerData.deploy_command && (
               <div className="flex justify-between">
                 <span>Deploy Command:</span>
-                <span className="font-mono text-xs truncate max-w-24" title={timerData.deployCommand}>
-                  {timerData.deployCommand}
+                <span className="font-mono text-xs truncate max-w-24" title={timerData.deploy_command}>
+                  {timerData.deploy_command}
                 </span>
               </div>
             )}
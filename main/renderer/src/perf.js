@@ -0,0 +1,77 @@
+/**
+ * Renderer-side performance tracking shared by the React Profiler hook in
+ * App.jsx and the opt-in PerfOverlay.
+ *
+ * 📐 Tracks three things the backend metrics can't see:
+ * - React commit durations (from <Profiler> onRender)
+ * - click-to-update latency for named interactions (startInteraction at the
+ *   event handler, finished after the next commit has painted)
+ * - arbitrary one-off samples (e.g. notification action round trips)
+ */
+
+const MAX_SAMPLES = 60
+
+const commitDurations = [] // ms, most recent last
+const interactionSamples = {} // name -> [ms]
+let pendingInteraction = null // { name, start }
+
+const pushSample = (list, value) => {
+  list.push(value)
+  if (list.length > MAX_SAMPLES) {
+    list.shift()
+  }
+}
+
+/**
+ * Mark the start of a user interaction (call from the event handler)
+ */
+export const startInteraction = (name) => {
+  pendingInteraction = { name, start: performance.now() }
+}
+
+/**
+ * Record a React commit; resolves any pending interaction after the commit
+ * has actually painted (double rAF puts us past the next frame)
+ */
+export const recordCommit = (actualDuration) => {
+  pushSample(commitDurations, actualDuration)
+
+  if (pendingInteraction) {
+    const { name, start } = pendingInteraction
+    pendingInteraction = null
+    requestAnimationFrame(() => {
+      requestAnimationFrame(() => {
+        const elapsed = performance.now() - start
+        pushSample((interactionSamples[name] = interactionSamples[name] || []), elapsed)
+      })
+    })
+  }
+}
+
+/**
+ * Record a pre-measured latency sample under a name
+ */
+export const recordSample = (name, ms) => {
+  pushSample((interactionSamples[name] = interactionSamples[name] || []), ms)
+}
+
+const summarize = (list) => {
+  if (!list.length) return null
+  const sorted = [...list].sort((a, b) => a - b)
+  return {
+    count: list.length,
+    last: list[list.length - 1],
+    p50: sorted[Math.floor(sorted.length * 0.5)],
+    max: sorted[sorted.length - 1],
+  }
+}
+
+/**
+ * Snapshot for the overlay: commit and per-interaction latency summaries
+ */
+export const getPerfSnapshot = () => ({
+  commits: summarize(commitDurations),
+  interactions: Object.fromEntries(
+    Object.entries(interactionSamples).map(([name, list]) => [name, summarize(list)])
+  ),
+})
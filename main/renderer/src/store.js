@@ -0,0 +1,84 @@
+/**
+ * Central renderer store with per-slice subscriptions
+ *
+ * App.jsx used to hold timer and deploy-status state and pass it down
+ * through props, so every timer sync re-rendered the whole tree. Each
+ * slice here has its own listener set and components subscribe via
+ * useSlice(), so a timer update re-renders DeployStatus and nothing else.
+ *
+ * Slices are fed two ways: backend push topics are routed in by
+ * connectStore() (status, tasks, logs), and components that own a piece
+ * of state publish it with setSlice() (TimerDisplay's authoritative
+ * timer syncs, App's connection checks).
+ */
+import { useSyncExternalStore } from 'react'
+
+const MAX_LOG_ENTRIES = 200
+
+const slices = {
+  timer: null, // { isActive, ...timer_info } from TimerDisplay's last sync
+  status: null, // raw backend status payload (seed + status-topic pushes)
+  tasks: null, // last tasks-topic push - signals a TODO.md change
+  logs: [], // bounded buffer of logs-topic push frames, newest last
+  connection: { isConnected: false, status: 'disconnected' },
+}
+
+const listeners = Object.fromEntries(
+  Object.keys(slices).map((name) => [name, new Set()])
+)
+
+export function getSlice(name) {
+  return slices[name]
+}
+
+export function setSlice(name, value) {
+  if (Object.is(slices[name], value)) return
+  slices[name] = value
+  for (const listener of listeners[name]) {
+    try {
+      listener()
+    } catch (error) {
+      console.error(`❌ [STORE] Listener for slice '${name}' failed:`, error)
+    }
+  }
+}
+
+function subscribeSlice(name, listener) {
+  listeners[name].add(listener)
+  return () => listeners[name].delete(listener)
+}
+
+/**
+ * Subscribe a component to one slice - re-renders only when that slice
+ * changes, regardless of what the rest of the store is doing
+ */
+export function useSlice(name) {
+  return useSyncExternalStore(
+    (listener) => subscribeSlice(name, listener),
+    () => getSlice(name)
+  )
+}
+
+// Route backend push topics into their slices. Called once from App;
+// the preload's ref-counted topic subscriptions make repeats harmless,
+// but the guard keeps listener registration single.
+let storeConnected = false
+
+export function connectStore() {
+  if (storeConnected || !window.electronAPI?.events?.on) return
+  storeConnected = true
+  console.log('🗄️ [STORE] Connecting backend push topics to store slices')
+
+  window.electronAPI.events.on(['status'], (message) => {
+    setSlice('status', message.data)
+  })
+
+  window.electronAPI.events.on(['tasks'], (message) => {
+    setSlice('tasks', message)
+  })
+
+  window.electronAPI.events.on(['logs'], (message) => {
+    const current = getSlice('logs')
+    setSlice('logs', [...current.slice(-(MAX_LOG_ENTRIES - 1)), message])
+  })
+}
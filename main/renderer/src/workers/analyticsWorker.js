@@ -0,0 +1,140 @@
+/**
+ * Analytics Worker
+ *
+ * Computes derived chart series (daily time saved, acceptance rates,
+ * time-of-day buckets) from raw deploy session records off the main
+ * renderer thread, so a year of analytics data never freezes the UI.
+ *
+ * Protocol (posted from Analytics.jsx):
+ *   { type: 'reset' }                               - clear accumulated sessions
+ *   { type: 'addSessions', sessions: [...] }        - accumulate a page of records
+ *   { type: 'finalize', requestId, lastNDays }      - compute and reply
+ *
+ * The reply transfers its typed-array buffers back to the main thread:
+ *   { requestId, dayStartEpochs: Float64Array, timeSavedMinutesByDay: Float64Array,
+ *     acceptanceRateByDay: Float64Array, suggestedByDay: Uint32Array,
+ *     acceptedByDay: Uint32Array, timeOfDayCounts: Uint32Array, totals: {...} }
+ */
+
+const MS_PER_DAY = 24 * 60 * 60 * 1000
+
+// Accumulated raw session records between reset and finalize
+let sessions = []
+
+function timeOfDayBucket(hour) {
+  // Matches the backend's morning/afternoon/evening/night convention
+  if (hour >= 5 && hour < 12) return 0 // morning
+  if (hour >= 12 && hour < 17) return 1 // afternoon
+  if (hour >= 17 && hour < 22) return 2 // evening
+  return 3 // night
+}
+
+function computeSeries(lastNDays) {
+  const dayCount = Math.max(1, lastNDays)
+  const now = Date.now()
+  const windowStart = now - dayCount * MS_PER_DAY
+
+  const dayStartEpochs = new Float64Array(dayCount)
+  const timeSavedMinutesByDay = new Float64Array(dayCount)
+  const suggestedByDay = new Uint32Array(dayCount)
+  const acceptedByDay = new Uint32Array(dayCount)
+  const acceptanceRateByDay = new Float64Array(dayCount)
+  const timeOfDayCounts = new Uint32Array(4) // morning/afternoon/evening/night
+
+  const firstDayStart = new Date(windowStart)
+  firstDayStart.setHours(0, 0, 0, 0)
+  for (let i = 0; i < dayCount; i++) {
+    dayStartEpochs[i] = firstDayStart.getTime() + i * MS_PER_DAY
+  }
+
+  let totalSessions = 0
+  let totalSuggested = 0
+  let totalAccepted = 0
+  let totalTimeSavedMinutes = 0
+  let switchSessions = 0
+
+  for (const session of sessions) {
+    const started = Date.parse(session.session_start)
+    if (Number.isNaN(started) || started < dayStartEpochs[0]) continue
+
+    const dayIndex = Math.min(
+      dayCount - 1,
+      Math.floor((started - dayStartEpochs[0]) / MS_PER_DAY)
+    )
+
+    const timeSaved = (session.estimated_time_saved_seconds || 0) / 60
+    const suggested = session.tasks_suggested || 0
+    const accepted = session.tasks_accepted || 0
+
+    timeSavedMinutesByDay[dayIndex] += timeSaved
+    suggestedByDay[dayIndex] += suggested
+    acceptedByDay[dayIndex] += accepted
+    timeOfDayCounts[timeOfDayBucket(new Date(started).getHours())] += 1
+
+    totalSessions += 1
+    totalSuggested += suggested
+    totalAccepted += accepted
+    totalTimeSavedMinutes += timeSaved
+    if (session.switch_button_pressed) switchSessions += 1
+  }
+
+  for (let i = 0; i < dayCount; i++) {
+    acceptanceRateByDay[i] = suggestedByDay[i] > 0
+      ? acceptedByDay[i] / suggestedByDay[i]
+      : 0
+  }
+
+  return {
+    dayStartEpochs,
+    timeSavedMinutesByDay,
+    suggestedByDay,
+    acceptedByDay,
+    acceptanceRateByDay,
+    timeOfDayCounts,
+    totals: {
+      sessions: totalSessions,
+      tasksSuggested: totalSuggested,
+      tasksAccepted: totalAccepted,
+      acceptanceRate: totalSuggested > 0 ? totalAccepted / totalSuggested : 0,
+      switchRate: totalSessions > 0 ? switchSessions / totalSessions : 0,
+      timeSavedMinutes: totalTimeSavedMinutes
+    }
+  }
+}
+
+self.onmessage = (event) => {
+  const message = event.data || {}
+
+  switch (message.type) {
+    case 'reset':
+      sessions = []
+      break
+
+    case 'addSessions':
+      if (Array.isArray(message.sessions)) {
+        sessions = sessions.concat(message.sessions)
+      }
+      break
+
+    case 'finalize': {
+      const series = computeSeries(message.lastNDays || 30)
+      sessions = []
+      // Transfer the buffers instead of copying them
+      self.postMessage(
+        { requestId: message.requestId, ...series },
+        [
+          series.dayStartEpochs.buffer,
+          series.timeSavedMinutesByDay.buffer,
+          series.suggestedByDay.buffer,
+          series.acceptedByDay.buffer,
+          series.acceptanceRateByDay.buffer,
+          series.timeOfDayCounts.buffer
+        ]
+      )
+      break
+    }
+
+    default:
+      break
+  }
+}
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""
+Command-level microbenchmark for the DeployBot backend.
+
+Drives the command dispatch path over a loopback WebSocket client with a
+realistic weighted mix (status polls dominate, plus project listings and
+analytics reads, mirroring what an idle-but-open UI sends) and reports
+per-command latency percentiles. Results can be saved as a baseline and
+later runs compared against it, so a regression in any handler shows up
+as a number instead of a user complaint.
+
+Usage:
+  python3 scripts/benchmark_commands.py --iterations 2000
+  python3 scripts/benchmark_commands.py --save baseline.json
+  python3 scripts/benchmark_commands.py --compare baseline.json
+"""
+
+import argparse
+import asyncio
+import json
+import random
+import sys
+import time
+from pathlib import Path
+
+import websockets
+
+DEFAULT_SOCKET = Path.home() / ".deploybot" / "backend.sock"
+
+# Weighted command mix recorded from a typical open-UI session: status
+# polling dominates, with occasional project and analytics reads
+DEFAULT_MIX = {
+    "ping": 10,
+    "status": 50,
+    "project-list": 15,
+    "timer-status": 10,
+    "wrapper-status": 5,
+    "get-analytics-summary": 10,
+}
+
+
+def percentile(samples, pct):
+    """Nearest-rank percentile over a sorted copy of samples"""
+    if not samples:
+        return 0.0
+    ordered = sorted(samples)
+    index = min(len(ordered) - 1, int(round(pct / 100.0 * (len(ordered) - 1))))
+    return ordered[index]
+
+
+def parse_mix(spec):
+    """Parse 'command:weight,command:weight' into a weight dict"""
+    mix = {}
+    for part in spec.split(","):
+        command, _, weight = part.partition(":")
+        mix[command.strip()] = int(weight) if weight else 1
+    return mix
+
+
+async def connect(args):
+    """Connect over the unix socket when present, TCP otherwise"""
+    socket_path = Path(args.socket)
+    if socket_path.exists():
+        print(f"🔌 [BENCH] Connecting via unix socket {socket_path}")
+        return await websockets.unix_connect(str(socket_path), uri="ws://localhost/")
+    print(f"🔌 [BENCH] Connecting to {args.url}")
+    return await websockets.connect(args.url)
+
+
+async def run_benchmark(args, mix):
+    websocket = await connect(args)
+    print("✅ [BENCH] Connected")
+
+    commands = list(mix.keys())
+    weights = [mix[c] for c in commands]
+    samples = {command: [] for command in commands}
+
+    # Warmup so caches (status snapshot, analytics files) are in steady state
+    for command in commands:
+        await roundtrip(websocket, 0, command)
+
+    started = time.monotonic()
+    for i in range(args.iterations):
+        command = random.choices(commands, weights=weights)[0]
+        elapsed = await roundtrip(websocket, i + 1, command)
+        samples[command].append(elapsed)
+    wall_seconds = time.monotonic() - started
+
+    await websocket.close()
+    return samples, wall_seconds
+
+
+async def roundtrip(websocket, message_id, command):
+    """One command round trip, returns elapsed seconds"""
+    started = time.monotonic()
+    await websocket.send(json.dumps({
+        "command": command,
+        "data": {},
+        "messageId": message_id,
+    }))
+    # Responses echo the messageId; skip broadcasts interleaved on the socket
+    while True:
+        message = json.loads(await websocket.recv())
+        if message.get("type") == "response" and message.get("messageId") == message_id:
+            return time.monotonic() - started
+
+
+def summarize(samples, wall_seconds, iterations):
+    """Build the report structure from raw samples"""
+    report = {
+        "iterations": iterations,
+        "wall_seconds": round(wall_seconds, 3),
+        "throughput_per_sec": round(iterations / wall_seconds, 1) if wall_seconds else 0,
+        "commands": {},
+    }
+    for command, values in sorted(samples.items()):
+        if not values:
+            continue
+        report["commands"][command] = {
+            "count": len(values),
+            "p50_ms": round(percentile(values, 50) * 1000, 3),
+            "p90_ms": round(percentile(values, 90) * 1000, 3),
+            "p99_ms": round(percentile(values, 99) * 1000, 3),
+            "max_ms": round(max(values) * 1000, 3),
+        }
+    return report
+
+
+def print_report(report):
+    print("")
+    print("📊 [BENCH] Command latency report")
+    print("=" * 68)
+    print(f"  {report['iterations']} requests in {report['wall_seconds']}s "
+          f"({report['throughput_per_sec']} req/s)")
+    print(f"  {'command':<24} {'count':>6} {'p50':>8} {'p90':>8} {'p99':>8} {'max':>8}")
+    for command, stats in report["commands"].items():
+        print(f"  {command:<24} {stats['count']:>6} "
+              f"{stats['p50_ms']:>7.2f}ms {stats['p90_ms']:>7.2f}ms "
+              f"{stats['p99_ms']:>7.2f}ms {stats['max_ms']:>7.2f}ms")
+
+
+def compare_to_baseline(report, baseline_path):
+    """Print per-command p50/p99 deltas against a saved baseline"""
+    try:
+        baseline = json.loads(Path(baseline_path).read_text())
+    except (OSError, ValueError) as error:
+        print(f"❌ [BENCH] Could not read baseline {baseline_path}: {error}")
+        sys.exit(1)
+
+    print("")
+    print(f"📐 [BENCH] Comparison vs {baseline_path}")
+    print("=" * 68)
+    regressions = 0
+    for command, stats in report["commands"].items():
+        base = baseline.get("commands", {}).get(command)
+        if not base:
+            print(f"  {command:<24} (no baseline)")
+            continue
+        deltas = []
+        for key in ("p50_ms", "p99_ms"):
+            before, after = base[key], stats[key]
+            change = 100.0 * (after - before) / before if before else 0.0
+            deltas.append(f"{key} {before:.2f} -> {after:.2f} ({change:+.1f}%)")
+            if change > 20.0:
+                regressions += 1
+        print(f"  {command:<24} " + "  ".join(deltas))
+
+    if regressions:
+        print(f"\n⚠️ [BENCH] {regressions} metric(s) regressed more than 20%")
+        sys.exit(2)
+    print("\n✅ [BENCH] No regressions beyond 20%")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Command-level microbenchmark for a live DeployBot backend")
+    parser.add_argument("--iterations", type=int, default=1000, help="total requests to send (default 1000)")
+    parser.add_argument("--mix", default=None, help="command:weight,... (default: recorded UI mix)")
+    parser.add_argument("--socket", default=str(DEFAULT_SOCKET), help="backend unix socket path")
+    parser.add_argument("--url", default="ws://localhost:8765", help="TCP fallback WebSocket URL")
+    parser.add_argument("--save", default=None, help="write the report JSON to this path as a baseline")
+    parser.add_argument("--compare", default=None, help="compare against a saved baseline report")
+    parser.add_argument("--seed", type=int, default=42, help="mix shuffle seed for repeatable runs")
+    args = parser.parse_args()
+
+    random.seed(args.seed)
+    mix = parse_mix(args.mix) if args.mix else DEFAULT_MIX
+
+    print("🧪 [BENCH] DeployBot command microbenchmark")
+    print(f"🎛️ [BENCH] Mix: {mix}")
+
+    try:
+        samples, wall_seconds = asyncio.run(run_benchmark(args, mix))
+    except (ConnectionRefusedError, OSError) as error:
+        print(f"❌ [BENCH] Could not connect to backend: {error}")
+        sys.exit(1)
+
+    report = summarize(samples, wall_seconds, args.iterations)
+    print_report(report)
+
+    if args.save:
+        Path(args.save).write_text(json.dumps(report, indent=2))
+        print(f"\n💾 [BENCH] Baseline saved to {args.save}")
+
+    if args.compare:
+        compare_to_baseline(report, args.compare)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+"""
+Synthetic deploy-load benchmark against a live DeployBot backend.
+
+Generates configurable deploy-log traffic (projects x rate x burst) in the
+DBEV1 wrapper format, then measures what the pipeline actually delivers:
+
+  - detection latency distribution (log write -> deploy_detected broadcast)
+  - sustained events/sec (detected vs injected)
+  - backend responsiveness under load (ping round-trip, an event-loop
+    lag proxy sampled throughout the run)
+
+Usage:
+  python3 scripts/benchmark_deploy_load.py --projects 3 --rate 2 --burst 5 --duration 30
+"""
+
+import argparse
+import asyncio
+import hashlib
+import json
+import shutil
+import sys
+import time
+import urllib.parse
+from pathlib import Path
+
+import websockets
+
+BENCH_ROOT = Path.home() / ".deploybot" / "benchmark"
+DEFAULT_SOCKET = Path.home() / ".deploybot" / "backend.sock"
+
+
+def format_event(timestamp, project_name, command_string, cwd):
+    """Build a DBEV1 start line exactly like the deploy wrapper does"""
+    command_hash = hashlib.sha1(command_string.encode("utf-8")).hexdigest()[:12]
+    quoted_command = urllib.parse.quote(command_string, safe="")
+    quoted_cwd = urllib.parse.quote(cwd, safe="")
+    return (f"DBEV1 {timestamp} {project_name} {command_hash} "
+            f"start - {quoted_command} {quoted_cwd}\n")
+
+
+def percentile(samples, pct):
+    """Nearest-rank percentile over a sorted copy of samples"""
+    if not samples:
+        return 0.0
+    ordered = sorted(samples)
+    index = min(len(ordered) - 1, int(round(pct / 100.0 * (len(ordered) - 1))))
+    return ordered[index]
+
+
+class DeployLoadBenchmark:
+    def __init__(self, args):
+        self.args = args
+        self.websocket = None
+        self.message_id = 0
+        self.pending = {}  # messageId -> Future for command responses
+        self.injected = {}  # command string -> injection monotonic time
+        self.latencies = []  # seconds, injection -> deploy_detected
+        self.ping_rtts = []  # seconds
+        self.detected_count = 0
+        self.first_detect_at = None
+        self.last_detect_at = None
+
+    # ---------------------------------------------------------------- setup
+
+    async def connect(self):
+        """Connect over the unix socket when present, TCP otherwise"""
+        socket_path = Path(self.args.socket)
+        if socket_path.exists():
+            print(f"🔌 [BENCH] Connecting via unix socket {socket_path}")
+            self.websocket = await websockets.unix_connect(str(socket_path), uri="ws://localhost/")
+        else:
+            print(f"🔌 [BENCH] Connecting to {self.args.url}")
+            self.websocket = await websockets.connect(self.args.url)
+        print("✅ [BENCH] Connected")
+
+    async def send_command(self, command, data=None, timeout=10.0):
+        """Send a command envelope and await its correlated response"""
+        self.message_id += 1
+        message_id = self.message_id
+        future = asyncio.get_event_loop().create_future()
+        self.pending[message_id] = future
+        await self.websocket.send(json.dumps({
+            "command": command,
+            "data": data or {},
+            "messageId": message_id,
+        }))
+        try:
+            return await asyncio.wait_for(future, timeout)
+        finally:
+            self.pending.pop(message_id, None)
+
+    async def setup_projects(self):
+        """Create synthetic projects and register them for monitoring"""
+        projects = []
+        for i in range(self.args.projects):
+            name = f"bench-project-{i}"
+            path = BENCH_ROOT / name
+            (path / "logs").mkdir(parents=True, exist_ok=True)
+            (path / "config.json").write_text(json.dumps({"project_name": name}))
+            todo = path / "TODO.md"
+            if not todo.exists():
+                todo.write_text("# TODO\n\n- [ ] Benchmark placeholder task\n")
+            projects.append({"name": name, "path": path, "log": path / "logs" / "deploy_log.txt", "seq": 0})
+
+        for project in projects:
+            response = await self.send_command("direct-add-to-monitoring", {
+                "project_name": project["name"],
+                "project_path": str(project["path"]),
+            })
+            if not response.get("success"):
+                print(f"❌ [BENCH] Failed to register {project['name']}: {response}")
+                sys.exit(1)
+
+        await self.send_command("start-monitoring", {})
+        print(f"📁 [BENCH] Registered {len(projects)} synthetic projects under {BENCH_ROOT}")
+        return projects
+
+    # ------------------------------------------------------------- workload
+
+    async def inject_events(self, project):
+        """Write bursts of DBEV1 start lines at the configured rate"""
+        interval = 1.0 / self.args.rate
+        deadline = time.monotonic() + self.args.duration
+        while time.monotonic() < deadline:
+            lines = []
+            now = time.monotonic()
+            for _ in range(self.args.burst):
+                project["seq"] += 1
+                command = f"bench-deploy {project['name']} #{project['seq']}"
+                self.injected[command] = now
+                lines.append(format_event(time.time(), project["name"], command, str(project["path"])))
+            with open(project["log"], "a") as f:
+                f.writelines(lines)
+            await asyncio.sleep(interval)
+
+    async def sample_ping(self):
+        """Ping round-trips while the load runs - a loop-lag proxy that also
+        shows command latency an interactive client would experience"""
+        while True:
+            started = time.monotonic()
+            try:
+                await self.send_command("ping", {}, timeout=10.0)
+                self.ping_rtts.append(time.monotonic() - started)
+            except asyncio.TimeoutError:
+                self.ping_rtts.append(10.0)
+                print("⚠️ [BENCH] Ping timed out under load")
+            await asyncio.sleep(0.5)
+
+    async def read_messages(self):
+        """Dispatch responses to waiters and record deploy detections"""
+        async for raw in self.websocket:
+            try:
+                message = json.loads(raw)
+            except (ValueError, TypeError):
+                continue
+
+            if message.get("type") == "response":
+                future = self.pending.get(message.get("messageId"))
+                if future and not future.done():
+                    future.set_result(message.get("data", {}))
+                continue
+
+            if message.get("type") == "deploy" and message.get("event") == "deploy_detected":
+                command = message.get("data", {}).get("command", "")
+                injected_at = self.injected.pop(command, None)
+                now = time.monotonic()
+                if injected_at is not None:
+                    self.latencies.append(now - injected_at)
+                    self.detected_count += 1
+                    if self.first_detect_at is None:
+                        self.first_detect_at = now
+                    self.last_detect_at = now
+
+    # --------------------------------------------------------------- report
+
+    def report(self, injected_total, wall_seconds):
+        print("")
+        print("📊 [BENCH] Results")
+        print("=" * 60)
+        print(f"  projects x rate x burst : {self.args.projects} x {self.args.rate}/s x {self.args.burst}")
+        print(f"  run duration            : {wall_seconds:.1f}s")
+        print(f"  events injected         : {injected_total}")
+        print(f"  events detected         : {self.detected_count} "
+              f"({100.0 * self.detected_count / max(1, injected_total):.1f}%)")
+
+        if self.first_detect_at and self.last_detect_at and self.last_detect_at > self.first_detect_at:
+            sustained = self.detected_count / (self.last_detect_at - self.first_detect_at)
+            print(f"  sustained detection     : {sustained:.1f} events/sec")
+
+        if self.latencies:
+            print("  detection latency       : "
+                  f"p50={percentile(self.latencies, 50) * 1000:.0f}ms "
+                  f"p90={percentile(self.latencies, 90) * 1000:.0f}ms "
+                  f"p99={percentile(self.latencies, 99) * 1000:.0f}ms "
+                  f"max={max(self.latencies) * 1000:.0f}ms")
+
+        if self.ping_rtts:
+            print("  ping RTT under load     : "
+                  f"p50={percentile(self.ping_rtts, 50) * 1000:.1f}ms "
+                  f"p99={percentile(self.ping_rtts, 99) * 1000:.1f}ms "
+                  f"max={max(self.ping_rtts) * 1000:.1f}ms")
+
+        undetected = len(self.injected)
+        if undetected:
+            print(f"  ⚠️ never detected        : {undetected} events (breaking point?)")
+
+    async def fetch_backend_stats(self):
+        """Pull the backend's own tracing/perf numbers for the same window"""
+        for command in ("trace-stats", "perf-stats"):
+            try:
+                response = await self.send_command(command, {}, timeout=5.0)
+                if response.get("success"):
+                    print(f"\n📈 [BENCH] Backend {command}:")
+                    print(json.dumps(response, indent=2, default=str)[:2000])
+            except (asyncio.TimeoutError, Exception):
+                pass
+
+    # ------------------------------------------------------------------ run
+
+    async def run(self):
+        await self.connect()
+        reader = asyncio.ensure_future(self.read_messages())
+        try:
+            projects = await self.setup_projects()
+
+            pinger = asyncio.ensure_future(self.sample_ping())
+            started = time.monotonic()
+            print(f"🚀 [BENCH] Injecting for {self.args.duration}s...")
+            await asyncio.gather(*[self.inject_events(p) for p in projects])
+
+            # Grace window so in-flight events can still be detected
+            await asyncio.sleep(self.args.grace)
+            pinger.cancel()
+            wall_seconds = time.monotonic() - started
+
+            injected_total = sum(p["seq"] for p in projects)
+            self.report(injected_total, wall_seconds)
+            await self.fetch_backend_stats()
+        finally:
+            reader.cancel()
+            if not self.args.keep:
+                try:
+                    await self.send_command("stop-monitoring", {}, timeout=5.0)
+                except Exception:
+                    pass
+                shutil.rmtree(BENCH_ROOT, ignore_errors=True)
+            await self.websocket.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Synthetic deploy-load benchmark for a live DeployBot backend")
+    parser.add_argument("--projects", type=int, default=3, help="number of synthetic projects (default 3)")
+    parser.add_argument("--rate", type=float, default=2.0, help="bursts per second per project (default 2)")
+    parser.add_argument("--burst", type=int, default=1, help="events per burst (default 1)")
+    parser.add_argument("--duration", type=float, default=30.0, help="injection window in seconds (default 30)")
+    parser.add_argument("--grace", type=float, default=10.0, help="post-injection wait for stragglers (default 10)")
+    parser.add_argument("--socket", default=str(DEFAULT_SOCKET), help="backend unix socket path")
+    parser.add_argument("--url", default="ws://localhost:8765", help="TCP fallback WebSocket URL")
+    parser.add_argument("--keep", action="store_true", help="keep synthetic projects and monitoring after the run")
+    args = parser.parse_args()
+
+    print("🧪 [BENCH] DeployBot synthetic deploy-load benchmark")
+    print("⚠️ [BENCH] Note: this stops monitoring on exit unless --keep is given")
+    try:
+        asyncio.run(DeployLoadBenchmark(args).run())
+    except KeyboardInterrupt:
+        print("\n🛑 [BENCH] Interrupted")
+    except (ConnectionRefusedError, OSError) as error:
+        print(f"❌ [BENCH] Could not connect to backend: {error}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,338 @@
+#!/usr/bin/env python3
+"""
+Scenario-based end-to-end benchmark for a live DeployBot backend.
+
+Clones projects/DemoProject N times and drives each clone through the real
+user workflow - deploy burst, grace period, unified suggestion, accept,
+timer run-down - measuring what a user would actually feel at every step:
+
+  - detection latency (log write -> deploy_detected broadcast)
+  - suggestion latency (deploy_detected -> unified_suggested broadcast)
+  - accept round-trip (notification-response command RTT)
+  - timer drift (requested run-down vs observed expiry broadcast)
+  - backend resource usage across the run (memory-stats / perf-stats delta)
+
+This is the acceptance harness for performance work: a change that helps a
+microbenchmark but hurts any of these numbers is a regression.
+
+Usage:
+  python3 scripts/benchmark_scenarios.py --scenarios 5
+  python3 scripts/benchmark_scenarios.py --scenarios 20 --stagger 0.5 --timer 5
+"""
+
+import argparse
+import asyncio
+import hashlib
+import json
+import shutil
+import sys
+import time
+import urllib.parse
+from pathlib import Path
+
+import websockets
+
+REPO_ROOT = Path(__file__).resolve().parent.parent
+DEMO_PROJECT = REPO_ROOT / "projects" / "DemoProject"
+SCENARIO_ROOT = Path.home() / ".deploybot" / "benchmark_scenarios"
+DEFAULT_SOCKET = Path.home() / ".deploybot" / "backend.sock"
+
+
+def percentile(samples, pct):
+    """Nearest-rank percentile over a sorted copy of samples"""
+    if not samples:
+        return 0.0
+    ordered = sorted(samples)
+    index = min(len(ordered) - 1, int(round(pct / 100.0 * (len(ordered) - 1))))
+    return ordered[index]
+
+
+def format_event(timestamp, project_name, command_string, cwd):
+    """Build a DBEV1 start line exactly like the deploy wrapper does"""
+    command_hash = hashlib.sha1(command_string.encode("utf-8")).hexdigest()[:12]
+    quoted_command = urllib.parse.quote(command_string, safe="")
+    quoted_cwd = urllib.parse.quote(cwd, safe="")
+    return (f"DBEV1 {timestamp} {project_name} {command_hash} "
+            f"start - {quoted_command} {quoted_cwd}\n")
+
+
+def fmt_ms(samples):
+    """p50/p99/max line for a list of second-valued samples"""
+    return (f"p50={percentile(samples, 50) * 1000:.0f}ms "
+            f"p99={percentile(samples, 99) * 1000:.0f}ms "
+            f"max={max(samples) * 1000:.0f}ms")
+
+
+class ScenarioBenchmark:
+    def __init__(self, args):
+        self.args = args
+        self.websocket = None
+        self.message_id = 0
+        self.pending = {}  # messageId -> Future for command responses
+        # Per-phase latency samples across all scenarios (seconds)
+        self.detect_latencies = []
+        self.suggest_latencies = []
+        self.accept_rtts = []
+        self.timer_drifts = []
+        self.failures = []  # (scenario, phase, reason)
+        # project name -> per-scenario wait futures, armed before injection
+        self.detect_waiters = {}
+        self.suggest_waiters = {}
+        self.expiry_waiters = {}
+
+    # ---------------------------------------------------------------- setup
+
+    async def connect(self):
+        """Connect over the unix socket when present, TCP otherwise"""
+        socket_path = Path(self.args.socket)
+        if socket_path.exists():
+            print(f"🔌 [SCENARIO] Connecting via unix socket {socket_path}")
+            self.websocket = await websockets.unix_connect(str(socket_path), uri="ws://localhost/")
+        else:
+            print(f"🔌 [SCENARIO] Connecting to {self.args.url}")
+            self.websocket = await websockets.connect(self.args.url)
+        print("✅ [SCENARIO] Connected")
+
+    async def send_command(self, command, data=None, timeout=10.0):
+        """Send a command envelope and await its correlated response"""
+        self.message_id += 1
+        message_id = self.message_id
+        future = asyncio.get_event_loop().create_future()
+        self.pending[message_id] = future
+        await self.websocket.send(json.dumps({
+            "command": command,
+            "data": data or {},
+            "messageId": message_id,
+        }))
+        try:
+            return await asyncio.wait_for(future, timeout)
+        finally:
+            self.pending.pop(message_id, None)
+
+    def clone_demo_project(self, index):
+        """Copy DemoProject into a uniquely named scenario clone"""
+        name = f"demo-scn-{index}"
+        path = SCENARIO_ROOT / name
+        if path.exists():
+            shutil.rmtree(path)
+        shutil.copytree(DEMO_PROJECT, path)
+        (path / "logs").mkdir(exist_ok=True)
+
+        # Rewrite the identity so the backend treats each clone as its own
+        # project; everything else (tasks, mappings, settings) stays DemoProject
+        config_file = path / "config.json"
+        config = json.loads(config_file.read_text())
+        config["projectName"] = name
+        config_file.write_text(json.dumps(config, indent=2))
+        return {"name": name, "path": path, "log": path / "logs" / "deploy_log.txt"}
+
+    async def setup(self):
+        """Clone and register all scenario projects, then start monitoring"""
+        projects = [self.clone_demo_project(i) for i in range(self.args.scenarios)]
+        for project in projects:
+            response = await self.send_command("direct-add-to-monitoring", {
+                "project_name": project["name"],
+                "project_path": str(project["path"]),
+            })
+            if not response.get("success"):
+                print(f"❌ [SCENARIO] Failed to register {project['name']}: {response}")
+                sys.exit(1)
+        await self.send_command("start-monitoring", {})
+        print(f"📁 [SCENARIO] Registered {len(projects)} DemoProject clones under {SCENARIO_ROOT}")
+        return projects
+
+    # ------------------------------------------------------------- messages
+
+    def _resolve(self, waiters, key, value):
+        future = waiters.pop(key, None)
+        if future and not future.done():
+            future.set_result(value)
+
+    async def read_messages(self):
+        """Dispatch responses to waiters and scenario events to their phases"""
+        async for raw in self.websocket:
+            try:
+                message = json.loads(raw)
+            except (ValueError, TypeError):
+                continue
+            mtype = message.get("type")
+            data = message.get("data", {})
+
+            if mtype == "response":
+                future = self.pending.get(message.get("messageId"))
+                if future and not future.done():
+                    future.set_result(data)
+            elif mtype == "deploy" and message.get("event") == "deploy_detected":
+                self._resolve(self.detect_waiters, data.get("project", ""), time.monotonic())
+            elif mtype == "task" and message.get("event") == "unified_suggested":
+                self._resolve(self.suggest_waiters, data.get("project", ""),
+                              (time.monotonic(), data.get("notification_id")))
+            elif mtype == "timer_update" and data.get("status") == "expired":
+                self._resolve(self.expiry_waiters, data.get("project_name", ""), time.monotonic())
+
+    # ------------------------------------------------------------- scenario
+
+    async def run_scenario(self, index, project):
+        """One full workflow: deploy burst -> suggestion -> accept -> timer"""
+        name = project["name"]
+        loop = asyncio.get_event_loop()
+
+        # Arm the waiters before injecting so no broadcast can slip past
+        self.detect_waiters[name] = loop.create_future()
+        self.suggest_waiters[name] = loop.create_future()
+
+        # Phase 1: deploy burst
+        injected_at = time.monotonic()
+        lines = [format_event(time.time(), name, f"firebase deploy #scn{index}-{seq}",
+                              str(project["path"]))
+                 for seq in range(self.args.burst)]
+        with open(project["log"], "a") as f:
+            f.writelines(lines)
+
+        try:
+            detected_at = await asyncio.wait_for(self.detect_waiters[name], self.args.phase_timeout)
+        except asyncio.TimeoutError:
+            self.failures.append((name, "detect", "no deploy_detected broadcast"))
+            return
+        self.detect_latencies.append(detected_at - injected_at)
+
+        # Phase 2: grace period + unified suggestion
+        try:
+            suggested_at, notification_id = await asyncio.wait_for(
+                self.suggest_waiters[name], self.args.phase_timeout)
+        except asyncio.TimeoutError:
+            self.failures.append((name, "suggest", "no unified_suggested broadcast"))
+            return
+        self.suggest_latencies.append(suggested_at - detected_at)
+
+        # Phase 3: accept the suggestion (records the interaction, kicks off
+        # redirect handling - the same path the notification window drives)
+        if notification_id:
+            started = time.monotonic()
+            response = await self.send_command("notification-response", {
+                "notification_id": notification_id,
+                "action": "accept",
+            })
+            self.accept_rtts.append(time.monotonic() - started)
+            if not response.get("success"):
+                self.failures.append((name, "accept", str(response)))
+        else:
+            self.failures.append((name, "accept", "suggestion carried no notification_id"))
+
+        # Phase 4: timer run-down. The deploy auto-started a 30-minute timer;
+        # restart it short so the expiry pipeline runs inside the benchmark
+        self.expiry_waiters[name] = loop.create_future()
+        await self.send_command("timer-stop", {"project_name": name})
+        timer_started = time.monotonic()
+        await self.send_command("timer-start", {
+            "project_name": name,
+            "duration_seconds": self.args.timer,
+        })
+        try:
+            expired_at = await asyncio.wait_for(
+                self.expiry_waiters[name], self.args.timer + self.args.phase_timeout)
+            self.timer_drifts.append((expired_at - timer_started) - self.args.timer)
+        except asyncio.TimeoutError:
+            self.failures.append((name, "timer", "no expiry broadcast"))
+
+    # --------------------------------------------------------------- report
+
+    def report(self, wall_seconds, resources_before, resources_after):
+        completed = len(self.timer_drifts)
+        print("")
+        print("📊 [SCENARIO] Results")
+        print("=" * 60)
+        print(f"  scenarios               : {self.args.scenarios} "
+              f"({completed} completed all phases)")
+        print(f"  run duration            : {wall_seconds:.1f}s")
+        if self.detect_latencies:
+            print(f"  detection latency       : {fmt_ms(self.detect_latencies)}")
+        if self.suggest_latencies:
+            print(f"  suggestion latency      : {fmt_ms(self.suggest_latencies)}")
+        if self.accept_rtts:
+            print(f"  accept round-trip       : {fmt_ms(self.accept_rtts)}")
+        if self.timer_drifts:
+            print(f"  timer expiry drift      : {fmt_ms(self.timer_drifts)}")
+
+        rss_before = (resources_before or {}).get("rss_mb")
+        rss_after = (resources_after or {}).get("rss_mb")
+        if rss_before is not None and rss_after is not None:
+            print(f"  backend RSS             : {rss_before:.1f}MB -> {rss_after:.1f}MB "
+                  f"({rss_after - rss_before:+.1f}MB)")
+
+        for name, phase, reason in self.failures:
+            print(f"  ⚠️ {name} failed at {phase}: {reason}")
+
+    async def fetch_memory_stats(self):
+        """Backend memory snapshot, tolerating older backends without it"""
+        try:
+            response = await self.send_command("memory-stats", {}, timeout=5.0)
+            if response.get("success"):
+                return response.get("memory", response)
+        except (asyncio.TimeoutError, Exception):
+            pass
+        return None
+
+    # ------------------------------------------------------------------ run
+
+    async def run(self):
+        await self.connect()
+        reader = asyncio.ensure_future(self.read_messages())
+        try:
+            projects = await self.setup()
+            resources_before = await self.fetch_memory_stats()
+
+            started = time.monotonic()
+            print(f"🚀 [SCENARIO] Running {len(projects)} scenarios "
+                  f"(stagger {self.args.stagger}s, timer {self.args.timer}s)...")
+            tasks = []
+            for index, project in enumerate(projects):
+                tasks.append(asyncio.ensure_future(self.run_scenario(index, project)))
+                await asyncio.sleep(self.args.stagger)
+            await asyncio.gather(*tasks)
+            wall_seconds = time.monotonic() - started
+
+            resources_after = await self.fetch_memory_stats()
+            self.report(wall_seconds, resources_before, resources_after)
+        finally:
+            reader.cancel()
+            if not self.args.keep:
+                try:
+                    await self.send_command("stop-monitoring", {}, timeout=5.0)
+                except Exception:
+                    pass
+                shutil.rmtree(SCENARIO_ROOT, ignore_errors=True)
+            await self.websocket.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Scenario-based end-to-end benchmark using DemoProject clones")
+    parser.add_argument("--scenarios", type=int, default=5,
+                        help="number of DemoProject clones to run (default 5)")
+    parser.add_argument("--burst", type=int, default=3,
+                        help="deploy events injected per scenario (default 3)")
+    parser.add_argument("--stagger", type=float, default=1.0,
+                        help="seconds between scenario starts (default 1)")
+    parser.add_argument("--timer", type=int, default=5,
+                        help="timer run-down duration in seconds (default 5)")
+    parser.add_argument("--phase-timeout", type=float, default=30.0,
+                        help="max wait per workflow phase (default 30)")
+    parser.add_argument("--socket", default=str(DEFAULT_SOCKET), help="backend unix socket path")
+    parser.add_argument("--url", default="ws://localhost:8765", help="TCP fallback WebSocket URL")
+    parser.add_argument("--keep", action="store_true",
+                        help="keep scenario clones and monitoring after the run")
+    args = parser.parse_args()
+
+    if not DEMO_PROJECT.exists():
+        print(f"❌ [SCENARIO] DemoProject not found at {DEMO_PROJECT}")
+        sys.exit(1)
+
+    try:
+        asyncio.run(ScenarioBenchmark(args).run())
+    except KeyboardInterrupt:
+        print("\n🛑 [SCENARIO] Interrupted")
+
+
+if __name__ == "__main__":
+    main()
@@ -3,17 +3,89 @@
 echo "🧹 DeployBot Process Cleanup Script"
 echo "=================================="
 
-# Kill any Python processes related to DeployBot
-echo "🐍 Killing DeployBot Python processes..."
-pkill -f "python.*deploybot" && echo "✅ Python processes killed" || echo "ℹ️  No Python processes found"
+REGISTRY="$HOME/.deploybot/owned_pids.json"
 
-# Kill any processes on port 8765
-echo "🔌 Killing processes on port 8765..."
-lsof -ti:8765 | xargs kill -9 2>/dev/null && echo "✅ Port 8765 processes killed" || echo "ℹ️  No processes on port 8765"
+# Terminate exactly the processes DeployBot registered at spawn time
+# (~/.deploybot/owned_pids.json, written by the Electron process manager
+# and the deploy wrapper). Each PID is verified against its recorded
+# launch token or command line before signalling, since PIDs get recycled.
+if [[ -f "$REGISTRY" ]]; then
+    echo "📒 Using PID registry: $REGISTRY"
+    python3 - "$REGISTRY" <<'PYEOF'
+import json
+import os
+import signal
+import subprocess
+import sys
 
-# Kill any Electron processes related to DeployBot
-echo "⚡ Killing DeployBot Electron processes..."
-pkill -f "electron.*deploybot" && echo "✅ Electron processes killed" || echo "ℹ️  No Electron processes found"
+registry_path = sys.argv[1]
+try:
+    with open(registry_path) as f:
+        entries = json.load(f)
+except (OSError, ValueError):
+    entries = []
+
+def is_ours(entry, pid):
+    """Verify the PID still belongs to DeployBot before touching it"""
+    token = entry.get("token")
+    environ_path = f"/proc/{pid}/environ"
+    if token and os.path.exists(environ_path):
+        try:
+            with open(environ_path, "rb") as f:
+                return token.encode() in f.read()
+        except OSError:
+            pass
+    try:
+        current = subprocess.run(
+            ["ps", "-p", str(pid), "-o", "command="],
+            capture_output=True, text=True, check=True
+        ).stdout.strip()
+    except subprocess.CalledProcessError:
+        return False
+    expected = entry.get("command", "")
+    return (expected and expected in current) or "deploybot" in current.lower()
+
+for entry in entries:
+    pid = entry.get("pid")
+    role = entry.get("role", "process")
+    if not isinstance(pid, int):
+        continue
+    try:
+        os.kill(pid, 0)
+    except OSError:
+        print(f"ℹ️  Registered {role} {pid} already gone")
+        continue
+    if not is_ours(entry, pid):
+        print(f"⚠️  PID {pid} was recycled by another process, skipping")
+        continue
+    try:
+        os.kill(pid, signal.SIGTERM)
+        print(f"✅ Terminated registered {role} {pid}")
+    except OSError:
+        pass
+
+with open(registry_path, "w") as f:
+    json.dump([], f)
+PYEOF
+else
+    echo "ℹ️  No PID registry found at $REGISTRY"
+fi
+
+# Remove a stale backend socket so the next startup binds cleanly
+rm -f "$HOME/.deploybot/backend.sock" 2>/dev/null
+
+# Legacy pattern sweep - only with --sweep, since killing by name pattern
+# can match unrelated processes and spawns several child processes
+if [[ "${1:-}" == "--sweep" ]]; then
+    echo "🐍 Sweeping DeployBot Python processes by pattern..."
+    pkill -f "python.*deploybot" && echo "✅ Python processes killed" || echo "ℹ️  No Python processes found"
+
+    echo "🔌 Killing processes on port 8765..."
+    lsof -ti:8765 | xargs kill -9 2>/dev/null && echo "✅ Port 8765 processes killed" || echo "ℹ️  No processes on port 8765"
+
+    echo "⚡ Killing DeployBot Electron processes..."
+    pkill -f "electron.*deploybot" && echo "✅ Electron processes killed" || echo "ℹ️  No Electron processes found"
+fi
 
 # Show remaining DeployBot-related processes
 echo ""
@@ -22,4 +94,4 @@ ps aux | grep -i deploybot | grep -v grep || echo "ℹ️  No DeployBot processe
 
 echo ""
 echo "✅ Cleanup completed!"
-echo "You can now safely start DeployBot again." 
\ No newline at end of file
+echo "You can now safely start DeployBot again."
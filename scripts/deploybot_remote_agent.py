@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""
+Remote deploy-event agent for DeployBot.
+
+Runs on CI boxes and servers where deploys happen far from the desktop
+DeployBot. The machine uses the standard deploy wrapper (installed by
+deploy_wrapper_setup.py), and this agent tails the wrapper's structured
+deploy logs and forwards DBEV1 event lines to a DeployBot backend over
+one authenticated WebSocket - no remote polling on the DeployBot side,
+and one instance can take events from many agents.
+
+Behavior:
+  - batches event lines (flush on size or interval) into
+    remote-deploy-events commands
+  - buffers while disconnected and replays on reconnect, oldest first
+  - authenticates with the shared token from
+    ~/.deploybot/remote_agent_token (copy the desktop machine's token
+    here, or pass --token-file)
+
+Usage:
+  python3 scripts/deploybot_remote_agent.py --url ws://deploybot-host:8765
+  python3 scripts/deploybot_remote_agent.py --url ws://host:8765 --agent ci-01 \
+      --log ~/builds/myapp/logs/deploy_log.txt
+"""
+
+import argparse
+import asyncio
+import json
+import socket
+import sys
+import time
+from collections import deque
+from pathlib import Path
+
+import websockets
+
+STRUCTURED_EVENT_PREFIX = "DBEV1 "
+SHARD_DIR = Path.home() / ".deploybot" / "deploy_logs"
+DEFAULT_TOKEN_FILE = Path.home() / ".deploybot" / "remote_agent_token"
+
+
+class RemoteAgent:
+    """Tails wrapper deploy logs and forwards DBEV1 lines to the backend"""
+
+    def __init__(self, args):
+        self.args = args
+        self.token = None
+        self.offsets = {}  # path -> byte offset already forwarded
+        self.pending = deque(maxlen=args.buffer_limit)
+        self.message_id = 0
+        self.forwarded = 0
+        self.rejected = 0
+
+    def load_token(self):
+        token_file = Path(self.args.token_file).expanduser()
+        try:
+            self.token = token_file.read_text().strip()
+        except FileNotFoundError:
+            print(f"❌ [AGENT] Token file not found: {token_file}")
+            print("   Copy ~/.deploybot/remote_agent_token from the DeployBot machine.")
+            return False
+        if not self.token:
+            print(f"❌ [AGENT] Token file is empty: {token_file}")
+            return False
+        return True
+
+    def watched_logs(self):
+        """Current set of log files to tail: shard dir plus explicit --log paths"""
+        paths = [Path(p).expanduser() for p in self.args.log]
+        if SHARD_DIR.is_dir():
+            paths.extend(sorted(SHARD_DIR.glob("*.txt")))
+        return [p for p in paths if p.is_file()]
+
+    def collect_new_lines(self):
+        """Read newly appended DBEV1 lines from every watched log"""
+        lines = []
+        for log_path in self.watched_logs():
+            key = str(log_path)
+            try:
+                size = log_path.stat().st_size
+                offset = self.offsets.get(key)
+                if offset is None:
+                    # First sighting: start at the end so old history isn't replayed
+                    self.offsets[key] = size
+                    continue
+                if size < offset:
+                    offset = 0  # Log was rotated or truncated
+                if size == offset:
+                    continue
+
+                with open(log_path, "r") as f:
+                    f.seek(offset)
+                    chunk = f.read()
+                    self.offsets[key] = f.tell()
+
+                for line in chunk.splitlines():
+                    if line.startswith(STRUCTURED_EVENT_PREFIX):
+                        lines.append(line)
+            except OSError as e:
+                print(f"⚠️ [AGENT] Could not read {log_path}: {e}")
+        return lines
+
+    async def send_batch(self, websocket, batch):
+        """Send one remote-deploy-events command and wait for its response"""
+        self.message_id += 1
+        await websocket.send(json.dumps({
+            "command": "remote-deploy-events",
+            "data": {
+                "token": self.token,
+                "agent": self.args.agent,
+                "events": batch,
+            },
+            "messageId": self.message_id,
+        }))
+
+        # Responses may interleave with broadcast frames on a TCP backend
+        while True:
+            reply = json.loads(await asyncio.wait_for(websocket.recv(), timeout=10))
+            if reply.get("type") == "response" and reply.get("messageId") == self.message_id:
+                return reply.get("data", {})
+
+    async def drain_pending(self, websocket):
+        """Replay buffered events oldest-first in batches"""
+        while self.pending:
+            batch = []
+            while self.pending and len(batch) < self.args.batch_size:
+                batch.append(self.pending.popleft())
+
+            result = await self.send_batch(websocket, batch)
+            if not result.get("success"):
+                self.rejected += len(batch)
+                print(f"❌ [AGENT] Batch rejected: {result.get('error', 'unknown error')}")
+                if result.get("error") == "Invalid agent token":
+                    return False
+                continue
+
+            self.forwarded += result.get("accepted", 0)
+            print(f"📤 [AGENT] Forwarded {len(batch)} events "
+                  f"(accepted {result.get('accepted', 0)}, total {self.forwarded})")
+        return True
+
+    async def run(self):
+        """Collect/flush loop with reconnect backoff"""
+        print(f"🌐 [AGENT] DeployBot remote agent '{self.args.agent}' starting")
+        print(f"   backend: {self.args.url}")
+
+        backoff = 1.0
+        while True:
+            try:
+                async with websockets.connect(self.args.url) as websocket:
+                    print("✅ [AGENT] Connected to backend")
+                    backoff = 1.0
+                    last_flush = time.monotonic()
+
+                    while True:
+                        for line in self.collect_new_lines():
+                            self.pending.append(line)
+
+                        now = time.monotonic()
+                        should_flush = self.pending and (
+                            len(self.pending) >= self.args.batch_size
+                            or now - last_flush >= self.args.flush_interval
+                        )
+                        if should_flush:
+                            last_flush = now
+                            if not await self.drain_pending(websocket):
+                                print("🛑 [AGENT] Stopping - backend rejected our token")
+                                return 1
+
+                        await asyncio.sleep(self.args.poll_interval)
+            except KeyboardInterrupt:
+                raise
+            except Exception as e:
+                print(f"🔌 [AGENT] Connection lost ({e}) - retrying in {backoff:.0f}s "
+                      f"({len(self.pending)} events buffered)")
+                await asyncio.sleep(backoff)
+                backoff = min(backoff * 2, 60.0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Forward deploy events to a remote DeployBot")
+    parser.add_argument("--url", required=True,
+                        help="Backend WebSocket URL, e.g. ws://deploybot-host:8765")
+    parser.add_argument("--agent", default=socket.gethostname(),
+                        help="Agent name reported with each batch (default: hostname)")
+    parser.add_argument("--token-file", default=str(DEFAULT_TOKEN_FILE),
+                        help="Shared token file (default: ~/.deploybot/remote_agent_token)")
+    parser.add_argument("--log", action="append", default=[],
+                        help="Extra deploy log to tail (repeatable); the wrapper's "
+                             "shard directory is always watched")
+    parser.add_argument("--batch-size", type=int, default=50,
+                        help="Max events per forwarded batch")
+    parser.add_argument("--flush-interval", type=float, default=0.5,
+                        help="Seconds between flushes when events are pending")
+    parser.add_argument("--poll-interval", type=float, default=0.5,
+                        help="Seconds between log reads")
+    parser.add_argument("--buffer-limit", type=int, default=5000,
+                        help="Max events buffered while disconnected (oldest dropped)")
+    args = parser.parse_args()
+
+    agent = RemoteAgent(args)
+    if not agent.load_token():
+        return 1
+
+    try:
+        return asyncio.run(agent.run()) or 0
+    except KeyboardInterrupt:
+        print(f"\n👋 [AGENT] Stopped ({agent.forwarded} events forwarded)")
+        return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
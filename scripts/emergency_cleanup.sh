@@ -37,6 +37,76 @@ success() {
     echo -e "${GREEN}[SUCCESS]${NC} $1"
 }
 
+# Kill processes from the owned-PID registry first - exact targets written
+# by the process manager and deploy wrapper at spawn time, verified by
+# launch token/command line, no pattern matching involved
+kill_registered_processes() {
+    local registry="$HOME/.deploybot/owned_pids.json"
+    log "📒 Terminating processes from PID registry..."
+
+    if [[ ! -f "$registry" ]]; then
+        log "ℹ️ No PID registry at $registry"
+        return 0
+    fi
+
+    python3 - "$registry" <<'PYEOF' || warning "⚠️ Registry cleanup failed, relying on pattern sweep"
+import json
+import os
+import signal
+import subprocess
+import sys
+
+registry_path = sys.argv[1]
+try:
+    with open(registry_path) as f:
+        entries = json.load(f)
+except (OSError, ValueError):
+    entries = []
+
+def is_ours(entry, pid):
+    token = entry.get("token")
+    environ_path = f"/proc/{pid}/environ"
+    if token and os.path.exists(environ_path):
+        try:
+            with open(environ_path, "rb") as f:
+                return token.encode() in f.read()
+        except OSError:
+            pass
+    try:
+        current = subprocess.run(
+            ["ps", "-p", str(pid), "-o", "command="],
+            capture_output=True, text=True, check=True
+        ).stdout.strip()
+    except subprocess.CalledProcessError:
+        return False
+    expected = entry.get("command", "")
+    return (expected and expected in current) or "deploybot" in current.lower()
+
+for entry in entries:
+    pid = entry.get("pid")
+    role = entry.get("role", "process")
+    if not isinstance(pid, int):
+        continue
+    try:
+        os.kill(pid, 0)
+    except OSError:
+        continue
+    if not is_ours(entry, pid):
+        print(f"PID {pid} was recycled by another process, skipping")
+        continue
+    try:
+        os.kill(pid, signal.SIGKILL)
+        print(f"Killed registered {role} {pid}")
+    except OSError:
+        pass
+
+with open(registry_path, "w") as f:
+    json.dump([], f)
+PYEOF
+
+    success "✅ Registry cleanup completed"
+}
+
 # Force kill all DeployBot related processes
 force_kill_all_deploybot_processes() {
     log "💀 Force killing ALL DeployBot processes..."
@@ -276,7 +346,9 @@ main() {
     
     log "🚀 Beginning emergency cleanup sequence..."
     
-    # Execute cleanup steps
+    # Execute cleanup steps - exact registry kills first, pattern sweep as
+    # the emergency fallback
+    kill_registered_processes
     force_kill_all_deploybot_processes
     aggressive_port_cleanup
     cleanup_temp_directories
@@ -113,6 +113,88 @@ if (fs.existsSync(requirementsFile)) {
   console.log('⚠️ [SETUP] No requirements.txt found, skipping dependency installation');
 }
 
+// Verify the optional uvloop event loop is importable. The backend only
+// uses it when DEPLOYBOT_UVLOOP=1, so a missing wheel is not fatal
+try {
+  execSync(`"${pythonExe}" -c "import uvloop; print(uvloop.__version__)"`, {
+    stdio: 'pipe'
+  });
+  console.log('✅ [SETUP] uvloop available (enable with DEPLOYBOT_UVLOOP=1)');
+} catch (error) {
+  console.log('⚠️ [SETUP] uvloop not available on this platform - backend will use the default asyncio loop');
+}
+
+// Precompile bytecode for the runtime and our backend sources so first
+// launch reads cached .pyc files instead of compiling every module
+const backendDir = path.join(__dirname, '../backend');
+console.log('⚡ [SETUP] Precompiling bytecode (.pyc) for runtime and backend...');
+try {
+  execSync(`"${pythonExe}" -m compileall -q -j 0 "${targetDir}" "${backendDir}"`, {
+    stdio: 'inherit'
+  });
+  console.log('✅ [SETUP] Bytecode precompiled');
+} catch (error) {
+  // compileall exits non-zero if any single file fails; that's not fatal
+  console.log('⚠️ [SETUP] Bytecode precompilation reported errors (continuing)');
+}
+
+// Bundle the backend into a single importable zip archive. zipimport resolves
+// every backend module from one file, so cold start avoids the stat/open storm
+// of directory-based import resolution (deploybot_main.py prefers the archive
+// whenever it's at least as new as the backend sources).
+console.log('🗜️ [SETUP] Building single-file backend archive (deploybot_backend.pyz)...');
+const zipappBuildScript = `
+import pathlib
+import zipfile
+
+backend_dir = pathlib.Path(${JSON.stringify(backendDir)})
+output_path = pathlib.Path(${JSON.stringify(targetDir)}) / 'deploybot_backend.pyz'
+
+with zipfile.ZipFile(output_path, 'w', zipfile.ZIP_DEFLATED) as archive:
+    for source_file in sorted(backend_dir.glob('*.py')):
+        archive.write(source_file, source_file.name)
+
+print(f"{output_path.name}: {output_path.stat().st_size} bytes")
+`;
+
+const zipappBuildPath = path.join(targetDir, 'build_backend_zipapp.py');
+fs.writeFileSync(zipappBuildPath, zipappBuildScript);
+try {
+  execSync(`"${pythonExe}" "${zipappBuildPath}"`, { stdio: 'inherit' });
+  console.log('✅ [SETUP] Backend archive built');
+} catch (error) {
+  console.log('⚠️ [SETUP] Backend archive build failed (continuing with directory imports)');
+}
+fs.unlinkSync(zipappBuildPath);
+
+// Optional C accelerator for deploy-log parsing, built against the bundled
+// CPython headers. monitor.py falls back to its pure-Python regex path when
+// the extension is missing, so a failed build only costs speed.
+console.log('🔨 [SETUP] Building _deploy_parse C accelerator...');
+try {
+  const includeDir = path.join(targetDir, 'include', 'python3.12');
+  const extSuffix = execSync(
+    `"${pythonExe}" -c "import sysconfig; print(sysconfig.get_config_var('EXT_SUFFIX'))"`,
+    { encoding: 'utf8' }
+  ).trim();
+  const acceleratorSource = path.join(backendDir, '_deploy_parse.c');
+  const acceleratorOutput = path.join(backendDir, `_deploy_parse${extSuffix}`);
+  // macOS resolves CPython symbols at load time; Linux links normally
+  const linkFlags = process.platform === 'darwin' ? '-undefined dynamic_lookup' : '';
+
+  execSync(
+    `cc -O2 -shared -fPIC ${linkFlags} -I "${includeDir}" "${acceleratorSource}" -o "${acceleratorOutput}"`,
+    { stdio: 'inherit' }
+  );
+  execSync(
+    `"${pythonExe}" -c "import sys; sys.path.insert(0, r'${backendDir}'); import _deploy_parse; print(_deploy_parse.parse_line('1700000000.5 DEPLOY: firebase deploy [CWD: /tmp]'))"`,
+    { stdio: 'inherit' }
+  );
+  console.log('✅ [SETUP] _deploy_parse accelerator built and verified');
+} catch (error) {
+  console.log('⚠️ [SETUP] _deploy_parse build failed (continuing with pure-Python parser)');
+}
+
 // Test that our backend dependencies are available
 console.log('🧪 [SETUP] Testing backend dependencies...');
 const testDependencies = [
@@ -180,6 +262,36 @@ try {
 // Clean up test script
 fs.unlinkSync(testScriptPath);
 
+// Cold-start budget check: backend launch time is dominated by import time,
+// so measure it here and complain if it regresses past the budget
+const IMPORT_BUDGET_MS = 2000;
+console.log('⏱️ [SETUP] Measuring backend import time...');
+const importTimerScript = `
+import sys
+import time
+
+sys.path.insert(0, ${JSON.stringify(backendDir)})
+start = time.perf_counter()
+import graph  # noqa: F401
+print(int((time.perf_counter() - start) * 1000))
+`;
+
+const importTimerPath = path.join(targetDir, 'measure_import_time.py');
+fs.writeFileSync(importTimerPath, importTimerScript);
+try {
+  const output = execSync(`"${pythonExe}" "${importTimerPath}"`, { encoding: 'utf8' });
+  const lines = output.trim().split('\n');
+  const importMs = parseInt(lines[lines.length - 1], 10);
+  if (importMs > IMPORT_BUDGET_MS) {
+    console.log(`⚠️ [SETUP] Backend import took ${importMs}ms - over the ${IMPORT_BUDGET_MS}ms budget, check for new module-level imports`);
+  } else {
+    console.log(`✅ [SETUP] Backend import time: ${importMs}ms (budget: ${IMPORT_BUDGET_MS}ms)`);
+  }
+} catch (error) {
+  console.log('⚠️ [SETUP] Could not measure backend import time (continuing)');
+}
+fs.unlinkSync(importTimerPath);
+
 console.log('🎉 [SETUP] Embedded Python runtime setup completed successfully!');
 console.log(`📍 [SETUP] Runtime location: ${targetDir}`);
 console.log(`🐍 [SETUP] Python executable: ${pythonExe}`);